@@ -0,0 +1,2967 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * html_entities_table.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_html_entities.py. Do not edit. */
+
+/* Hash and displace tables of the 2125 named character references, without
+ * their '&' and ';'. The low 10 bits of the hash select a displacement,
+ * which moves the names of that bucket to free slots. A slot holds the
+ * index of its entity plus one, or zero if it is free. An entity stands for
+ * one code point, or two if the second is not zero.
+ */
+#define HTML_ENTITY_COUNT 2125
+#define HTML_ENTITY_MAX_SIZE 31
+#define HTML_ENTITY_BUCKET_BITS 10
+#define HTML_ENTITY_SLOT_BITS 12
+
+static const uint8_t html_entity_disp[1 << HTML_ENTITY_BUCKET_BITS] = {
+	4, 2, 2, 0, 1, 4, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+	5, 1, 1, 0, 0, 2, 0, 0, 1, 2, 0, 5, 0, 0, 0, 2,
+	0, 2, 0, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 2,
+	1, 0, 2, 1, 0, 0, 0, 2, 0, 3, 0, 0, 6, 0, 1, 1,
+	3, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 0, 1, 3,
+	0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 2, 2, 0, 0, 1, 0,
+	1, 0, 0, 0, 4, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+	0, 3, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 7, 2, 1,
+	0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 1, 4, 2, 2, 1,
+	0, 2, 2, 1, 2, 2, 1, 2, 0, 1, 0, 4, 3, 0, 1, 0,
+	3, 2, 0, 3, 1, 0, 0, 0, 1, 2, 1, 1, 2, 1, 0, 0,
+	0, 0, 7, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1,
+	0, 0, 0, 1, 0, 1, 3, 1, 2, 0, 3, 0, 0, 2, 2, 0,
+	0, 0, 1, 1, 0, 0, 0, 1, 3, 2, 2, 2, 1, 2, 2, 4,
+	1, 0, 0, 0, 0, 1, 3, 4, 0, 0, 1, 2, 1, 0, 0, 1,
+	0, 2, 2, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2,
+	0, 0, 0, 0, 0, 1, 3, 2, 2, 2, 0, 0, 0, 0, 1, 0,
+	0, 1, 1, 0, 1, 0, 0, 3, 2, 0, 2, 0, 2, 0, 0, 0,
+	1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0,
+	0, 1, 1, 0, 1, 3, 0, 0, 0, 0, 3, 0, 1, 0, 2, 2,
+	1, 1, 1, 1, 1, 0, 0, 0, 0, 2, 0, 0, 2, 1, 0, 0,
+	13, 0, 1, 4, 0, 1, 3, 0, 1, 1, 3, 3, 2, 4, 3, 0,
+	1, 2, 0, 1, 3, 0, 0, 1, 1, 0, 0, 0, 0, 1, 3, 0,
+	1, 0, 1, 0, 1, 4, 5, 1, 0, 4, 0, 2, 0, 0, 0, 1,
+	2, 0, 1, 2, 0, 1, 1, 1, 3, 3, 0, 1, 1, 0, 2, 0,
+	1, 7, 0, 0, 0, 1, 2, 0, 4, 0, 0, 0, 1, 2, 3, 0,
+	2, 0, 1, 4, 0, 1, 0, 0, 0, 0, 2, 5, 5, 1, 1, 12,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 7, 3, 0, 2, 0, 0, 6,
+	0, 2, 1, 0, 0, 2, 0, 0, 2, 2, 3, 6, 0, 4, 0, 1,
+	1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0,
+	1, 0, 1, 2, 0, 0, 1, 0, 0, 2, 0, 3, 1, 0, 0, 1,
+	3, 6, 0, 1, 3, 1, 4, 0, 1, 3, 0, 0, 2, 5, 0, 0,
+	0, 0, 2, 2, 0, 1, 0, 1, 1, 0, 1, 0, 0, 2, 1, 0,
+	6, 1, 0, 2, 3, 13, 2, 3, 1, 0, 2, 1, 1, 2, 2, 0,
+	1, 1, 6, 0, 1, 1, 3, 3, 0, 3, 2, 1, 4, 0, 4, 3,
+	0, 0, 0, 1, 0, 3, 0, 0, 2, 1, 1, 0, 0, 0, 0, 1,
+	3, 12, 2, 0, 0, 2, 3, 0, 2, 0, 0, 0, 7, 0, 0, 1,
+	0, 1, 1, 2, 2, 1, 0, 8, 1, 0, 0, 2, 0, 3, 3, 0,
+	0, 5, 0, 1, 0, 0, 0, 1, 0, 2, 0, 1, 2, 4, 0, 0,
+	0, 3, 1, 0, 0, 0, 0, 10, 1, 0, 0, 1, 0, 0, 4, 0,
+	0, 1, 0, 0, 0, 0, 0, 3, 0, 1, 1, 0, 3, 0, 0, 0,
+	1, 0, 3, 3, 1, 1, 0, 8, 3, 1, 1, 0, 1, 3, 4, 2,
+	0, 0, 0, 2, 0, 0, 0, 1, 0, 3, 4, 0, 0, 1, 0, 0,
+	5, 0, 0, 0, 2, 1, 4, 0, 0, 0, 5, 2, 0, 1, 0, 0,
+	4, 3, 0, 1, 3, 2, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0,
+	1, 1, 2, 0, 0, 1, 0, 0, 1, 0, 8, 0, 0, 4, 3, 3,
+	0, 0, 2, 0, 3, 1, 2, 1, 2, 0, 1, 1, 0, 2, 1, 0,
+	2, 0, 0, 7, 1, 0, 2, 2, 3, 0, 0, 2, 1, 3, 1, 2,
+	4, 4, 0, 0, 0, 2, 2, 0, 0, 0, 1, 3, 0, 6, 0, 3,
+	1, 0, 0, 1, 0, 0, 4, 0, 2, 0, 5, 1, 0, 0, 0, 3,
+	0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 3, 0, 0, 1,
+	0, 1, 7, 0, 0, 2, 0, 4, 1, 0, 12, 0, 0, 2, 0, 0,
+	2, 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 0, 1, 3, 2, 0,
+	0, 9, 0, 0, 1, 2, 1, 1, 0, 1, 4, 4, 0, 1, 0, 0,
+	1, 10, 0, 0, 0, 1, 0, 2, 1, 5, 8, 1, 0, 0, 1, 0,
+	1, 1, 1, 4, 0, 0, 0, 0, 2, 1, 0, 1, 2, 0, 2, 0,
+	1, 1, 0, 10, 0, 0, 0, 3, 0, 1, 0, 1, 2, 2, 3, 5,
+	1, 1, 1, 0, 3, 0, 0, 0, 0, 1, 0, 0, 1, 2, 3, 2,
+	2, 2, 0, 1, 1, 0, 2, 0, 5, 2, 0, 3, 0, 0, 0, 0,
+	0, 0, 0, 3, 1, 0, 5, 2, 0, 1, 1, 0, 0, 2, 1, 6,
+	5, 1, 2, 1, 0, 0, 1, 0, 0, 0, 3, 1, 0, 0, 0, 1,
+	6, 7, 0, 1, 0, 0, 2, 2, 1, 0, 1, 3, 2, 1, 3, 5,
+	6, 1, 0, 1, 2, 0, 5, 4, 0, 4, 0, 0, 1, 0, 6, 0,
+	0, 0, 1, 2, 0, 3, 0, 2, 1, 1, 0, 2, 5, 5, 2, 6,
+};
+
+static const uint16_t html_entity_slot[1 << HTML_ENTITY_SLOT_BITS] = {
+	618, 0, 0, 1090, 302, 444, 484, 0, 314, 0, 832, 1560, 1157, 283, 304, 0,
+	309, 1685, 2060, 0, 1400, 72, 0, 108, 0, 0, 327, 0, 1027, 0, 721, 0,
+	0, 1719, 428, 257, 1731, 0, 0, 446, 0, 0, 765, 0, 0, 0, 0, 0,
+	1454, 0, 1106, 1297, 544, 0, 0, 0, 974, 1123, 0, 1085, 0, 362, 2098, 697,
+	0, 345, 0, 2082, 1273, 1651, 465, 1878, 1296, 0, 1098, 1144, 0, 1644, 0, 0,
+	249, 0, 1457, 955, 0, 0, 1276, 0, 0, 1120, 0, 439, 0, 431, 116, 1631,
+	567, 1580, 159, 510, 0, 0, 0, 1125, 0, 1087, 0, 0, 343, 0, 0, 1885,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 565, 0, 0, 1919, 0, 0,
+	1908, 0, 1823, 0, 0, 1832, 0, 0, 1255, 502, 820, 0, 0, 0, 958, 1368,
+	488, 0, 188, 0, 2080, 0, 0, 68, 0, 2031, 0, 500, 1288, 0, 0, 0,
+	0, 0, 1355, 326, 1119, 1353, 0, 1042, 1096, 0, 1649, 669, 692, 0, 1611, 0,
+	723, 0, 1732, 0, 335, 0, 0, 0, 0, 301, 0, 0, 0, 0, 724, 0,
+	0, 0, 270, 0, 0, 0, 248, 0, 0, 0, 0, 0, 0, 1601, 914, 1006,
+	725, 720, 0, 74, 195, 935, 2011, 1758, 0, 0, 60, 756, 466, 1229, 726, 1720,
+	0, 1230, 0, 1678, 0, 0, 0, 0, 1033, 2014, 0, 1531, 0, 1435, 0, 2121,
+	0, 0, 280, 0, 533, 2058, 495, 1415, 1778, 0, 1614, 97, 330, 0, 0, 157,
+	163, 104, 0, 0, 0, 0, 237, 940, 1301, 1892, 1721, 1916, 1675, 0, 392, 1184,
+	1007, 0, 0, 0, 971, 170, 0, 993, 0, 1204, 0, 1864, 557, 0, 2083, 0,
+	166, 0, 2022, 477, 0, 0, 1303, 0, 0, 0, 1684, 921, 0, 0, 0, 0,
+	0, 0, 1612, 1356, 0, 1586, 0, 0, 2026, 1705, 0, 746, 193, 966, 1431, 2069,
+	453, 0, 0, 1233, 645, 1173, 0, 0, 1414, 222, 0, 657, 387, 1066, 1195, 804,
+	212, 1740, 927, 0, 0, 0, 2108, 2068, 0, 0, 0, 1169, 1630, 0, 0, 0,
+	0, 1746, 0, 0, 847, 1516, 0, 0, 0, 0, 1562, 900, 1105, 1219, 0, 0,
+	45, 35, 1985, 0, 1192, 0, 664, 0, 139, 300, 1480, 0, 340, 1330, 1723, 1482,
+	0, 0, 94, 1485, 1495, 1821, 0, 0, 0, 0, 1076, 1981, 1136, 1494, 478, 2041,
+	0, 668, 0, 1017, 1479, 1075, 0, 1447, 0, 1271, 265, 953, 0, 0, 0, 1154,
+	0, 0, 1668, 0, 722, 719, 401, 0, 0, 0, 1965, 0, 1381, 0, 891, 0,
+	0, 576, 1603, 1598, 0, 140, 236, 0, 1203, 64, 0, 1853, 1592, 1064, 1316, 715,
+	0, 926, 0, 701, 1338, 0, 0, 1067, 134, 0, 969, 0, 1339, 1223, 0, 493,
+	956, 1604, 75, 908, 1511, 350, 0, 1390, 588, 0, 982, 146, 2076, 0, 0, 0,
+	0, 589, 0, 0, 0, 0, 0, 0, 0, 226, 0, 1979, 0, 1975, 0, 0,
+	486, 0, 0, 1391, 516, 568, 0, 1019, 197, 0, 0, 0, 0, 0, 0, 0,
+	0, 545, 1347, 0, 566, 912, 555, 1363, 0, 0, 0, 0, 71, 0, 0, 0,
+	1084, 0, 0, 0, 0, 0, 1819, 458, 0, 0, 660, 182, 929, 0, 0, 393,
+	1514, 0, 242, 1422, 609, 643, 995, 0, 856, 671, 0, 652, 2124, 1658, 0, 0,
+	666, 0, 12, 0, 0, 0, 1332, 0, 0, 1151, 0, 600, 0, 1247, 1701, 0,
+	1527, 0, 1168, 0, 0, 0, 0, 685, 571, 469, 1595, 127, 0, 0, 117, 1159,
+	1294, 559, 0, 0, 1272, 1540, 463, 0, 2089, 1323, 0, 1266, 1815, 86, 0, 0,
+	2059, 1716, 0, 1980, 2000, 0, 603, 0, 434, 290, 2071, 0, 194, 445, 0, 1833,
+	0, 558, 1818, 1976, 0, 0, 1200, 0, 807, 757, 1817, 203, 0, 829, 2100, 1519,
+	0, 1554, 1729, 1263, 0, 1397, 0, 0, 0, 0, 485, 1249, 0, 1357, 1769, 0,
+	1924, 0, 822, 0, 0, 1032, 0, 747, 385, 0, 0, 160, 87, 857, 0, 1655,
+	2039, 1751, 0, 1287, 952, 476, 1869, 0, 0, 1713, 1036, 0, 961, 0, 0, 729,
+	1925, 2049, 490, 0, 1037, 0, 1556, 1780, 1962, 1579, 162, 0, 1417, 0, 0, 572,
+	1202, 1460, 809, 0, 238, 0, 0, 1848, 0, 462, 0, 1841, 0, 311, 0, 0,
+	0, 129, 0, 228, 714, 0, 0, 0, 0, 1784, 547, 404, 0, 36, 0, 0,
+	438, 0, 0, 938, 399, 0, 1707, 0, 1887, 0, 779, 1021, 740, 1074, 0, 0,
+	0, 0, 0, 0, 682, 148, 736, 2046, 2113, 1005, 337, 1500, 0, 1030, 0, 774,
+	14, 0, 980, 0, 711, 875, 762, 0, 0, 0, 1001, 224, 1436, 649, 0, 0,
+	0, 0, 0, 1616, 0, 0, 1613, 1807, 0, 2020, 686, 0, 1487, 0, 1041, 1957,
+	556, 0, 578, 0, 1904, 1664, 0, 537, 152, 0, 22, 635, 1361, 0, 0, 155,
+	0, 0, 1615, 0, 0, 1766, 672, 2099, 0, 213, 0, 1714, 0, 1275, 0, 0,
+	0, 0, 1872, 0, 0, 0, 216, 0, 2095, 397, 0, 707, 1215, 0, 0, 1927,
+	323, 1992, 0, 2013, 0, 965, 0, 0, 2120, 0, 0, 1856, 0, 0, 0, 0,
+	243, 679, 1750, 0, 1424, 211, 0, 2003, 1859, 2101, 1808, 322, 93, 0, 0, 472,
+	5, 1010, 0, 63, 1755, 0, 0, 0, 640, 868, 78, 106, 0, 59, 0, 0,
+	1018, 199, 0, 0, 634, 0, 0, 0, 0, 582, 0, 2070, 0, 0, 210, 0,
+	1691, 0, 0, 805, 1642, 0, 0, 1971, 0, 817, 863, 915, 0, 1476, 0, 0,
+	0, 0, 1109, 615, 196, 0, 1365, 183, 513, 0, 0, 2125, 492, 0, 0, 0,
+	1796, 0, 0, 0, 421, 1078, 1420, 215, 1000, 333, 937, 1103, 1959, 0, 2091, 0,
+	0, 0, 0, 1931, 1620, 0, 0, 0, 0, 1858, 749, 2056, 189, 1575, 0, 209,
+	0, 0, 0, 1068, 1786, 0, 0, 0, 750, 0, 1231, 375, 0, 1790, 0, 1583,
+	0, 619, 1313, 1695, 0, 2084, 1947, 0, 617, 0, 0, 0, 1116, 0, 0, 2116,
+	753, 2010, 0, 1912, 2110, 398, 0, 748, 1850, 0, 0, 706, 0, 0, 0, 373,
+	1196, 0, 0, 574, 1814, 1201, 279, 2103, 0, 0, 989, 0, 0, 223, 849, 1426,
+	0, 0, 2122, 0, 0, 1359, 1838, 0, 0, 119, 1346, 0, 0, 1875, 298, 0,
+	1553, 1039, 0, 0, 310, 0, 1002, 0, 620, 1528, 797, 0, 0, 1379, 1995, 0,
+	850, 1194, 0, 450, 0, 977, 0, 0, 0, 0, 0, 1834, 1663, 2040, 0, 1474,
+	0, 1517, 0, 1185, 957, 49, 0, 1524, 1419, 0, 0, 0, 1388, 1083, 0, 0,
+	1813, 0, 0, 0, 812, 548, 0, 395, 1464, 852, 0, 1529, 1278, 1493, 2007, 1405,
+	1489, 0, 1051, 913, 0, 0, 0, 0, 552, 1882, 1228, 0, 1805, 0, 0, 0,
+	0, 0, 447, 0, 0, 295, 0, 0, 1374, 808, 1089, 0, 1861, 0, 0, 0,
+	0, 1930, 0, 0, 0, 0, 361, 1945, 0, 1407, 0, 1926, 1523, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1452, 0, 934, 0, 893, 0, 2012, 0, 0, 2123,
+	925, 234, 1783, 0, 1243, 763, 0, 0, 186, 0, 0, 0, 0, 760, 1220, 1989,
+	171, 0, 1851, 1997, 1944, 0, 0, 535, 0, 0, 0, 2002, 0, 2072, 1648, 0,
+	1244, 0, 0, 1280, 661, 56, 1550, 0, 777, 176, 178, 1161, 570, 167, 1712, 1293,
+	0, 1212, 1830, 1141, 1826, 0, 0, 1561, 0, 0, 1915, 1449, 0, 0, 0, 0,
+	0, 0, 230, 1747, 0, 441, 0, 790, 0, 0, 1670, 0, 0, 0, 0, 1348,
+	147, 0, 0, 0, 0, 658, 0, 881, 761, 793, 0, 0, 0, 0, 0, 0,
+	1197, 0, 0, 0, 1794, 0, 991, 0, 0, 0, 0, 835, 776, 0, 1071, 2088,
+	0, 0, 0, 0, 0, 0, 1868, 0, 1909, 538, 0, 0, 1248, 0, 1080, 27,
+	758, 1065, 0, 2066, 1139, 1779, 0, 501, 1217, 1216, 1124, 0, 430, 2009, 0, 272,
+	0, 281, 29, 198, 0, 1069, 0, 0, 125, 84, 550, 0, 0, 0, 255, 621,
+	0, 0, 1416, 0, 0, 963, 1498, 1854, 0, 2053, 0, 1311, 0, 0, 0, 0,
+	613, 0, 0, 98, 79, 0, 342, 2027, 268, 741, 1876, 0, 418, 0, 0, 751,
+	778, 0, 0, 0, 244, 0, 551, 0, 259, 584, 0, 1045, 1104, 0, 0, 0,
+	69, 0, 562, 1877, 0, 1073, 0, 0, 0, 177, 0, 449, 0, 263, 0, 1647,
+	2105, 0, 521, 0, 0, 0, 0, 470, 1100, 0, 0, 0, 1771, 0, 0, 419,
+	0, 0, 82, 0, 718, 2109, 0, 680, 573, 959, 1548, 0, 844, 526, 507, 0,
+	0, 0, 0, 0, 593, 0, 1686, 0, 1703, 0, 0, 2044, 1360, 0, 0, 0,
+	631, 0, 150, 0, 1803, 1490, 2096, 0, 628, 0, 0, 0, 383, 0, 0, 25,
+	1453, 0, 1385, 0, 1652, 1305, 872, 1382, 479, 978, 1099, 208, 266, 834, 0, 0,
+	1760, 1617, 0, 0, 0, 0, 77, 0, 0, 0, 0, 1029, 1158, 0, 278, 0,
+	0, 0, 0, 0, 0, 256, 816, 320, 180, 0, 0, 0, 0, 0, 1621, 1130,
+	0, 0, 0, 0, 0, 1506, 899, 0, 0, 0, 0, 0, 0, 76, 553, 0,
+	1999, 941, 827, 0, 0, 855, 1026, 1129, 773, 0, 882, 602, 18, 1914, 2073, 624,
+	0, 0, 0, 0, 0, 0, 0, 1913, 591, 0, 0, 0, 839, 1753, 253, 1170,
+	0, 0, 1905, 0, 0, 837, 1393, 1770, 2081, 65, 1984, 227, 0, 783, 1767, 0,
+	240, 0, 1911, 1602, 297, 1409, 1829, 0, 1166, 1269, 946, 0, 0, 429, 440, 1465,
+	1700, 1801, 0, 1547, 0, 0, 531, 0, 675, 1292, 0, 1541, 0, 0, 0, 1236,
+	0, 0, 0, 1370, 0, 0, 1086, 1782, 0, 0, 814, 0, 848, 0, 303, 0,
+	0, 0, 1340, 0, 1564, 1508, 673, 0, 577, 877, 0, 0, 0, 11, 389, 408,
+	0, 1530, 0, 1910, 0, 0, 0, 515, 1451, 0, 0, 0, 1961, 0, 34, 1880,
+	633, 0, 1906, 0, 274, 461, 0, 0, 0, 831, 1481, 379, 0, 481, 0, 0,
+	1542, 245, 0, 716, 1543, 0, 232, 0, 0, 1728, 771, 0, 214, 1991, 365, 0,
+	1633, 0, 1974, 648, 360, 0, 1253, 0, 42, 2087, 1329, 1258, 0, 0, 201, 80,
+	0, 0, 0, 0, 0, 1358, 1050, 0, 0, 0, 580, 1640, 0, 0, 23, 455,
+	1250, 1384, 202, 702, 843, 0, 0, 0, 0, 0, 0, 886, 1245, 0, 0, 37,
+	0, 802, 930, 1213, 0, 0, 1011, 0, 41, 0, 0, 0, 2118, 581, 328, 1492,
+	541, 0, 0, 0, 731, 0, 0, 1055, 1863, 88, 0, 0, 1694, 0, 782, 316,
+	0, 0, 0, 207, 473, 1252, 358, 1226, 0, 1207, 110, 909, 497, 1907, 1643, 1499,
+	1896, 897, 120, 121, 728, 0, 0, 1893, 1988, 0, 846, 0, 1182, 1891, 1964, 271,
+	0, 646, 0, 1322, 0, 0, 0, 1865, 0, 641, 0, 1855, 0, 1922, 730, 0,
+	355, 0, 0, 0, 0, 0, 0, 292, 0, 329, 0, 737, 1689, 352, 0, 81,
+	0, 0, 939, 191, 710, 1943, 1512, 1752, 1518, 0, 0, 0, 0, 0, 0, 2077,
+	0, 0, 0, 0, 1948, 0, 1839, 0, 1756, 0, 0, 0, 1635, 1108, 0, 1486,
+	1191, 665, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1333, 1587, 0, 546, 0,
+	0, 0, 509, 0, 2050, 1097, 1928, 1568, 874, 1241, 0, 892, 1448, 0, 451, 0,
+	1274, 40, 975, 0, 0, 0, 0, 0, 1748, 0, 0, 1933, 0, 0, 0, 0,
+	0, 2037, 0, 880, 391, 321, 1998, 149, 1504, 0, 0, 0, 187, 363, 1150, 433,
+	569, 0, 764, 1843, 616, 1299, 0, 1521, 1117, 0, 1289, 0, 0, 696, 1532, 0,
+	1683, 1174, 0, 0, 9, 1936, 1725, 894, 319, 1845, 1990, 0, 53, 1505, 1795, 0,
+	0, 1411, 0, 0, 0, 0, 1672, 190, 0, 1932, 1842, 0, 1038, 0, 0, 0,
+	860, 374, 599, 1107, 118, 0, 0, 0, 1846, 0, 936, 1645, 2048, 0, 1392, 44,
+	998, 1172, 54, 0, 0, 0, 0, 656, 0, 0, 0, 308, 0, 670, 1224, 833,
+	1376, 0, 1788, 0, 1234, 944, 0, 0, 0, 0, 0, 0, 1198, 0, 0, 1164,
+	0, 0, 0, 0, 0, 2008, 1238, 0, 0, 0, 2054, 1610, 0, 610, 587, 0,
+	1308, 100, 1309, 1418, 0, 0, 1537, 713, 491, 0, 1102, 0, 561, 0, 0, 1571,
+	0, 0, 0, 1636, 0, 1488, 1625, 585, 755, 0, 1450, 967, 684, 1867, 0, 1973,
+	1444, 0, 594, 262, 0, 1994, 0, 0, 0, 1046, 888, 0, 0, 32, 0, 0,
+	0, 456, 0, 962, 0, 0, 0, 0, 0, 0, 1341, 0, 0, 0, 2061, 0,
+	460, 1209, 0, 0, 1189, 1088, 0, 0, 0, 0, 0, 0, 0, 1940, 1986, 0,
+	0, 137, 0, 1208, 1659, 0, 145, 1162, 0, 0, 0, 1138, 0, 1160, 2055, 0,
+	0, 0, 2067, 0, 0, 0, 0, 0, 0, 457, 0, 0, 0, 0, 1310, 951,
+	1873, 1373, 0, 1884, 233, 0, 1031, 1597, 1270, 0, 0, 0, 1584, 0, 625, 1232,
+	0, 0, 0, 0, 1671, 910, 512, 1137, 858, 0, 0, 0, 0, 0, 416, 0,
+	0, 654, 0, 0, 0, 0, 0, 0, 267, 62, 0, 153, 0, 0, 15, 0,
+	0, 0, 92, 744, 0, 623, 377, 0, 0, 1004, 165, 1594, 0, 0, 1432, 0,
+	0, 1526, 662, 1569, 0, 1284, 1657, 0, 475, 674, 2033, 0, 443, 1317, 0, 0,
+	0, 0, 131, 0, 780, 0, 787, 0, 1143, 1954, 2006, 532, 950, 0, 90, 0,
+	0, 0, 0, 0, 828, 0, 474, 911, 0, 0, 1727, 1605, 1058, 614, 48, 0,
+	403, 0, 992, 0, 0, 435, 0, 2104, 113, 1295, 0, 0, 0, 2074, 851, 0,
+	0, 2063, 0, 0, 922, 0, 1380, 1475, 1708, 0, 1567, 0, 0, 0, 528, 0,
+	1127, 0, 0, 799, 142, 0, 332, 775, 0, 717, 1917, 1802, 0, 0, 0, 0,
+	386, 1281, 0, 786, 0, 766, 883, 0, 1825, 1406, 689, 1507, 0, 1883, 2086, 2079,
+	525, 1946, 0, 126, 1774, 1785, 0, 0, 325, 1113, 1318, 250, 901, 1187, 0, 254,
+	0, 164, 994, 0, 0, 964, 1797, 1835, 1483, 0, 0, 1, 810, 2023, 1938, 2024,
+	1660, 0, 0, 0, 0, 1789, 2090, 976, 823, 1918, 114, 693, 0, 1126, 0, 0,
+	0, 448, 549, 0, 0, 997, 2111, 1461, 1557, 1403, 0, 1222, 1966, 990, 0, 1455,
+	0, 0, 1847, 0, 1765, 0, 0, 0, 2028, 0, 0, 703, 838, 1142, 0, 842,
+	225, 3, 1759, 0, 0, 924, 1509, 0, 1935, 1762, 0, 1558, 1439, 229, 0, 1354,
+	768, 181, 1235, 866, 437, 0, 0, 0, 0, 630, 1593, 2035, 0, 626, 1149, 627,
+	0, 0, 518, 498, 31, 277, 1325, 0, 0, 1860, 0, 794, 1430, 0, 0, 0,
+	1372, 536, 0, 742, 687, 0, 51, 0, 754, 1852, 0, 1889, 1328, 898, 411, 0,
+	2034, 0, 132, 0, 341, 0, 0, 0, 1265, 813, 0, 985, 0, 0, 1590, 7,
+	1715, 0, 1618, 0, 0, 1978, 1458, 0, 407, 796, 1459, 107, 0, 0, 1081, 0,
+	1680, 43, 0, 743, 0, 1386, 784, 0, 0, 0, 0, 0, 6, 1205, 0, 0,
+	0, 659, 2115, 390, 0, 0, 0, 0, 0, 534, 0, 1886, 47, 0, 0, 1697,
+	0, 0, 0, 0, 172, 0, 1654, 0, 0, 0, 0, 0, 0, 192, 0, 2112,
+	0, 0, 1401, 0, 218, 0, 0, 0, 0, 0, 638, 1094, 1972, 0, 1757, 0,
+	0, 1471, 0, 1724, 0, 487, 1307, 0, 1468, 945, 1473, 0, 788, 0, 1739, 632,
+	0, 1091, 0, 1881, 349, 1551, 0, 0, 334, 0, 0, 0, 642, 1690, 0, 1257,
+	0, 0, 0, 1898, 0, 273, 0, 1934, 0, 0, 0, 676, 0, 0, 2001, 0,
+	1698, 0, 1221, 0, 0, 0, 1871, 0, 0, 1093, 1025, 0, 0, 0, 1576, 745,
+	0, 1183, 0, 0, 1549, 688, 801, 1389, 845, 1956, 0, 592, 1923, 598, 1970, 0,
+	0, 2051, 17, 73, 1738, 0, 1165, 0, 1844, 0, 1711, 0, 0, 970, 0, 0,
+	168, 21, 0, 0, 0, 0, 1520, 895, 2102, 1903, 983, 1472, 1336, 0, 57, 0,
+	1377, 0, 1394, 0, 1824, 0, 1362, 0, 1754, 0, 705, 0, 0, 0, 0, 0,
+	205, 1627, 824, 1591, 0, 0, 0, 4, 185, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 644, 0, 1175, 0, 0, 1623, 1153, 0, 0, 590, 0, 1210, 0,
+	1497, 0, 0, 0, 0, 0, 1199, 0, 0, 1775, 563, 734, 0, 0, 0, 0,
+	2045, 1484, 678, 0, 468, 0, 1145, 0, 1900, 0, 1812, 0, 2078, 46, 206, 1425,
+	1894, 0, 1536, 16, 1820, 1704, 351, 1268, 1135, 0, 1387, 0, 1696, 0, 0, 896,
+	0, 0, 0, 0, 0, 1491, 0, 1622, 0, 0, 919, 0, 318, 353, 0, 0,
+	0, 0, 135, 0, 0, 0, 1781, 0, 0, 1062, 0, 947, 89, 1737, 2016, 0,
+	0, 0, 0, 0, 0, 854, 312, 0, 424, 0, 1741, 770, 1726, 1155, 410, 864,
+	1434, 732, 973, 0, 0, 338, 1733, 0, 0, 0, 1410, 0, 0, 289, 1749, 0,
+	0, 426, 1020, 2106, 759, 1034, 1888, 1446, 359, 1131, 0, 368, 331, 102, 1702, 2005,
+	0, 0, 601, 286, 0, 0, 0, 1334, 0, 0, 0, 0, 0, 1095, 285, 24,
+	1745, 0, 0, 0, 0, 1920, 0, 999, 1955, 0, 184, 0, 0, 873, 1321, 1312,
+	372, 655, 0, 0, 0, 315, 1792, 2057, 1181, 0, 0, 1566, 1692, 0, 0, 1261,
+	136, 246, 0, 95, 738, 0, 26, 1462, 417, 339, 0, 1570, 0, 496, 1440, 0,
+	1993, 0, 0, 1211, 0, 1743, 0, 867, 651, 2021, 1879, 0, 0, 0, 928, 622,
+	0, 0, 0, 0, 0, 0, 727, 0, 0, 61, 0, 520, 0, 0, 0, 1024,
+	0, 0, 0, 154, 1013, 522, 231, 0, 247, 0, 1259, 66, 1022, 0, 175, 0,
+	735, 1121, 0, 1666, 1043, 0, 454, 427, 1515, 1763, 986, 0, 1188, 1177, 1559, 0,
+	575, 0, 699, 0, 0, 0, 543, 0, 1710, 0, 0, 1687, 1963, 85, 0, 1951,
+	0, 1677, 1555, 1768, 1544, 0, 1552, 0, 0, 1324, 932, 0, 0, 870, 1193, 0,
+	0, 0, 1688, 1674, 0, 0, 0, 239, 0, 981, 0, 0, 639, 0, 1656, 1563,
+	1101, 1395, 1709, 1661, 2029, 1599, 252, 382, 527, 0, 0, 0, 1264, 1179, 949, 296,
+	1063, 0, 0, 0, 564, 0, 1344, 1070, 933, 0, 0, 1306, 1178, 0, 542, 112,
+	111, 0, 1443, 0, 0, 0, 0, 1942, 1082, 885, 0, 637, 1077, 20, 0, 529,
+	0, 0, 0, 0, 0, 0, 0, 1632, 0, 291, 0, 0, 1147, 366, 889, 0,
+	695, 0, 0, 0, 1467, 0, 0, 1122, 708, 0, 0, 0, 344, 1242, 0, 128,
+	0, 815, 0, 1588, 1148, 1156, 2038, 39, 1706, 931, 1290, 0, 1277, 0, 0, 0,
+	0, 1319, 0, 0, 0, 517, 1146, 0, 0, 0, 903, 1546, 0, 0, 306, 0,
+	0, 0, 0, 0, 1206, 101, 0, 0, 0, 1949, 0, 690, 124, 916, 425, 0,
+	0, 0, 0, 464, 0, 704, 0, 0, 0, 1163, 2047, 0, 489, 0, 0, 0,
+	0, 1619, 1939, 1437, 494, 0, 1639, 0, 0, 0, 712, 0, 1929, 0, 0, 241,
+	1638, 0, 0, 0, 96, 1761, 1798, 0, 554, 1987, 0, 0, 523, 826, 0, 0,
+	396, 0, 1048, 459, 0, 0, 0, 0, 1412, 2052, 0, 394, 0, 1369, 173, 0,
+	1378, 1996, 0, 579, 0, 595, 0, 0, 1171, 0, 0, 130, 0, 0, 378, 1421,
+	0, 261, 0, 2043, 511, 0, 269, 0, 405, 1764, 0, 293, 667, 1793, 275, 0,
+	1351, 2107, 0, 1742, 1110, 0, 0, 1044, 0, 0, 0, 0, 920, 1722, 0, 0,
+	1937, 1012, 0, 1014, 1327, 1015, 305, 1186, 0, 381, 0, 1921, 0, 0, 0, 1291,
+	636, 0, 884, 380, 0, 0, 0, 0, 677, 1628, 400, 0, 0, 2030, 406, 1736,
+	33, 0, 698, 0, 819, 30, 0, 0, 376, 0, 1522, 0, 0, 1730, 1167, 0,
+	0, 0, 55, 1304, 0, 968, 1983, 1345, 0, 0, 103, 1816, 0, 0, 1679, 0,
+	0, 1982, 0, 876, 0, 918, 371, 0, 1585, 0, 1857, 0, 1699, 0, 1286, 0,
+	1111, 1545, 503, 0, 1901, 0, 0, 0, 0, 0, 1849, 0, 650, 0, 402, 781,
+	1456, 1902, 467, 1960, 1897, 1822, 818, 115, 0, 694, 988, 0, 0, 1053, 0, 0,
+	1314, 2025, 0, 1040, 414, 1828, 0, 0, 346, 169, 887, 0, 0, 0, 1665, 2032,
+	861, 1423, 364, 0, 1646, 0, 0, 1267, 0, 0, 1227, 0, 0, 1609, 681, 52,
+	0, 1836, 0, 0, 0, 0, 629, 0, 691, 0, 0, 605, 0, 1427, 865, 1804,
+	972, 0, 890, 0, 158, 840, 0, 0, 0, 606, 1429, 200, 2085, 0, 1003, 1350,
+	0, 612, 50, 0, 151, 0, 0, 144, 0, 282, 1950, 217, 307, 1364, 0, 0,
+	235, 0, 0, 0, 0, 0, 789, 0, 0, 1669, 0, 0, 0, 0, 0, 0,
+	1772, 1572, 0, 1152, 0, 1629, 2075, 13, 91, 0, 1057, 0, 0, 220, 596, 1442,
+	767, 1092, 0, 0, 0, 0, 1059, 942, 1433, 1596, 480, 905, 0, 1953, 604, 0,
+	0, 862, 0, 0, 0, 0, 0, 1600, 0, 1607, 1441, 902, 0, 0, 0, 413,
+	2114, 1734, 19, 2093, 830, 948, 0, 0, 1968, 608, 0, 1870, 0, 482, 1256, 0,
+	0, 611, 859, 1008, 683, 0, 1539, 0, 0, 264, 954, 1118, 204, 0, 560, 1240,
+	0, 2042, 2, 0, 0, 0, 2092, 0, 1478, 1371, 1028, 0, 0, 0, 313, 960,
+	0, 0, 0, 0, 906, 347, 1375, 0, 1283, 0, 0, 0, 1477, 0, 709, 0,
+	0, 1735, 0, 0, 0, 367, 1016, 607, 58, 1399, 1246, 811, 1469, 0, 0, 0,
+	0, 0, 2018, 0, 0, 0, 317, 0, 1800, 258, 1977, 1023, 0, 1577, 276, 0,
+	0, 1574, 0, 0, 0, 1899, 1589, 0, 422, 0, 0, 1237, 0, 294, 904, 1009,
+	1502, 647, 0, 471, 0, 1060, 1035, 324, 1866, 530, 1298, 1061, 1413, 423, 2097, 0,
+	663, 0, 0, 0, 0, 174, 0, 1134, 1466, 1626, 409, 0, 357, 1693, 0, 0,
+	0, 0, 219, 0, 0, 1326, 0, 0, 0, 0, 0, 0, 0, 1662, 2019, 1534,
+	0, 0, 0, 1682, 0, 1115, 821, 800, 0, 105, 1052, 806, 0, 0, 0, 1054,
+	0, 0, 0, 1624, 260, 0, 1470, 1653, 0, 0, 0, 0, 0, 0, 1260, 0,
+	0, 1967, 0, 2036, 583, 803, 1578, 83, 907, 1895, 0, 1581, 0, 99, 0, 0,
+	0, 0, 432, 8, 1810, 0, 0, 0, 923, 0, 1366, 287, 0, 0, 1827, 1806,
+	0, 1952, 0, 0, 1180, 0, 979, 0, 1565, 0, 369, 1676, 1606, 1831, 1251, 772,
+	1279, 871, 519, 0, 1072, 0, 0, 984, 0, 506, 1079, 1396, 122, 752, 0, 1343,
+	2004, 0, 0, 0, 1791, 0, 2017, 878, 0, 0, 1383, 1282, 0, 1525, 1503, 141,
+	504, 499, 1862, 1114, 0, 1573, 0, 0, 1799, 1777, 825, 1634, 0, 0, 0, 1367,
+	0, 1809, 1404, 70, 0, 442, 1773, 0, 384, 1331, 483, 1428, 0, 67, 0, 879,
+	1445, 0, 0, 0, 2015, 0, 0, 109, 0, 356, 0, 795, 0, 0, 1533, 700,
+	0, 508, 0, 0, 0, 299, 0, 0, 0, 0, 0, 597, 0, 1140, 1969, 0,
+	0, 0, 0, 0, 0, 0, 586, 1302, 0, 0, 1402, 1463, 1315, 539, 0, 420,
+	996, 0, 0, 0, 0, 156, 138, 1941, 0, 1776, 769, 524, 0, 0, 0, 1681,
+	1787, 0, 0, 1128, 1214, 0, 0, 0, 0, 0, 0, 0, 0, 653, 0, 540,
+	0, 1056, 0, 0, 1408, 0, 412, 0, 0, 288, 1717, 1352, 0, 0, 0, 0,
+	284, 0, 1342, 1112, 739, 1349, 436, 0, 1398, 10, 798, 1513, 1510, 0, 1650, 1337,
+	792, 0, 0, 0, 0, 38, 415, 1190, 917, 0, 1608, 0, 1335, 1718, 1890, 143,
+	1667, 251, 1958, 869, 0, 0, 0, 0, 0, 0, 354, 0, 2062, 0, 0, 785,
+	0, 0, 0, 0, 1320, 0, 0, 1874, 0, 0, 0, 1049, 733, 1285, 1133, 133,
+	0, 348, 1840, 1047, 28, 1262, 0, 0, 505, 0, 1254, 1176, 1582, 0, 791, 0,
+	0, 987, 1501, 1496, 0, 0, 370, 0, 0, 0, 0, 0, 0, 0, 452, 0,
+	2065, 1535, 123, 514, 0, 1538, 2064, 0, 0, 0, 0, 0, 0, 0, 0, 161,
+	0, 0, 0, 0, 1218, 0, 0, 0, 2119, 853, 0, 0, 0, 221, 0, 0,
+	179, 0, 0, 0, 943, 1225, 0, 1641, 2094, 0, 1637, 2117, 0, 0, 1837, 1438,
+	1132, 841, 0, 1811, 1673, 836, 388, 0, 0, 1744, 336, 0, 0, 1239, 0, 1300,
+};
+
+static const char html_entity_names[] =
+	"AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApply"
+	"FunctionAringAscrAssignAtildeAumlBackslashBarvBarwedBcyBecauseBe"
+	"rnoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCapCapitalDiffer"
+	"entialDCayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChi"
+	"CircleDotCircleMinusCirclePlusCircleTimesClockwiseContourIntegra"
+	"lCloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintC"
+	"ontourIntegralCopfCoproductCounterClockwiseContourIntegralCrossC"
+	"scrCupCupCapDDDDotrahdDJcyDScyDZcyDaggerDarrDashvDcaronDcyDelDel"
+	"taDfrDiacriticalAcuteDiacriticalDotDiacriticalDoubleAcuteDiacrit"
+	"icalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqu"
+	"alDoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDo"
+	"ubleLeftRightArrowDoubleLeftTeeDoubleLongLeftArrowDoubleLongLeft"
+	"RightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTeeDoub"
+	"leUpArrowDoubleUpDownArrowDoubleVerticalBarDownArrowDownArrowBar"
+	"DownArrowUpArrowDownBreveDownLeftRightVectorDownLeftTeeVectorDow"
+	"nLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDow"
+	"nRightVectorBarDownTeeDownTeeArrowDownarrowDscrDstrokENGETHEacut"
+	"eEcaronEcircEcyEdotEfrEgraveElementEmacrEmptySmallSquareEmptyVer"
+	"ySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsimEt"
+	"aEumlExistsExponentialEFcyFfrFilledSmallSquareFilledVerySmallSqu"
+	"areFopfForAllFouriertrfFscrGJcyGTGammaGammadGbreveGcedilGcircGcy"
+	"GdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqualGreater"
+	"GreaterGreaterLessGreaterSlantEqualGreaterTildeGscrGtHARDcyHacek"
+	"HatHcircHfrHilbertSpaceHopfHorizontalLineHscrHstrokHumpDownHumpH"
+	"umpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacrImaginary"
+	"IImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogon"
+	"IopfIotaIscrItildeIukcyIumlJcircJcyJfrJopfJscrJsercyJukcyKHcyKJc"
+	"yKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrfLarrLc"
+	"aronLcedilLcyLeftAngleBracketLeftArrowLeftArrowBarLeftArrowRight"
+	"ArrowLeftCeilingLeftDoubleBracketLeftDownTeeVectorLeftDownVector"
+	"LeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLe"
+	"ftTeeArrowLeftTeeVectorLeftTriangleLeftTriangleBarLeftTriangleEq"
+	"ualLeftUpDownVectorLeftUpTeeVectorLeftUpVectorLeftUpVectorBarLef"
+	"tVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreaterLessF"
+	"ullEqualLessGreaterLessLessLessSlantEqualLessTildeLfrLlLleftarro"
+	"wLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarro"
+	"wLongleftrightarrowLongrightarrowLopfLowerLeftArrowLowerRightArr"
+	"owLscrLshLstrokLtMapMcyMediumSpaceMellintrfMfrMinusPlusMopfMscrM"
+	"uNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNegativeThickSpaceN"
+	"egativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreaterNestedL"
+	"essLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruentNotCu"
+	"pCapNotDoubleVerticalBarNotElementNotEqualNotEqualTildeNotExists"
+	"NotGreaterNotGreaterEqualNotGreaterFullEqualNotGreaterGreaterNot"
+	"GreaterLessNotGreaterSlantEqualNotGreaterTildeNotHumpDownHumpNot"
+	"HumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNo"
+	"tLessNotLessEqualNotLessGreaterNotLessLessNotLessSlantEqualNotLe"
+	"ssTildeNotNestedGreaterGreaterNotNestedLessLessNotPrecedesNotPre"
+	"cedesEqualNotPrecedesSlantEqualNotReverseElementNotRightTriangle"
+	"NotRightTriangleBarNotRightTriangleEqualNotSquareSubsetNotSquare"
+	"SubsetEqualNotSquareSupersetNotSquareSupersetEqualNotSubsetNotSu"
+	"bsetEqualNotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucc"
+	"eedsTildeNotSupersetNotSupersetEqualNotTildeNotTildeEqualNotTild"
+	"eFullEqualNotTildeTildeNotVerticalBarNscrNtildeNuOEligOacuteOcir"
+	"cOcyOdblacOfrOgraveOmacrOmegaOmicronOopfOpenCurlyDoubleQuoteOpen"
+	"CurlyQuoteOrOscrOslashOtildeOtimesOumlOverBarOverBraceOverBracke"
+	"tOverParenthesisPartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPrP"
+	"recedesPrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductP"
+	"roportionProportionalPscrPsiQUOTQfrQopfQscrRBarrREGRacuteRangRar"
+	"rRarrtlRcaronRcedilRcyReReverseElementReverseEquilibriumReverseU"
+	"pEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightA"
+	"rrowLeftArrowRightCeilingRightDoubleBracketRightDownTeeVectorRig"
+	"htDownVectorRightDownVectorBarRightFloorRightTeeRightTeeArrowRig"
+	"htTeeVectorRightTriangleRightTriangleBarRightTriangleEqualRightU"
+	"pDownVectorRightUpTeeVectorRightUpVectorRightUpVectorBarRightVec"
+	"torRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRul"
+	"eDelayedSHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDown"
+	"ArrowShortLeftArrowShortRightArrowShortUpArrowSigmaSmallCircleSo"
+	"pfSqrtSquareSquareIntersectionSquareSubsetSquareSubsetEqualSquar"
+	"eSupersetSquareSupersetEqualSquareUnionSscrStarSubSubsetSubsetEq"
+	"ualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatS"
+	"umSupSupersetSupersetEqualSupsetTHORNTRADETSHcyTScyTabTauTcaronT"
+	"cedilTcyTfrThereforeThetaThickSpaceThinSpaceTildeTildeEqualTilde"
+	"FullEqualTildeTildeTopfTripleDotTscrTstrokUacuteUarrUarrocirUbrc"
+	"yUbreveUcircUcyUdblacUfrUgraveUmacrUnderBarUnderBraceUnderBracke"
+	"tUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrow"
+	"DownArrowUpDownArrowUpEquilibriumUpTeeUpTeeArrowUparrowUpdownarr"
+	"owUpperLeftArrowUpperRightArrowUpsiUpsilonUringUscrUtildeUumlVDa"
+	"shVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVertical"
+	"SeparatorVerticalTildeVeryThinSpaceVfrVopfVscrVvdashWcircWedgeWf"
+	"rWopfWscrXfrXiXopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopfYscrYumlZ"
+	"HcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabrevea"
+	"cacEacdacircacuteacyaeligafafragravealefsymalephalphaamacramalga"
+	"mpandandandanddandslopeandvangangeangleangmsdangmsdaaangmsdabang"
+	"msdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvb"
+	"dangsphangstangzarraogonaopfapapEapacirapeapidaposapproxapproxeq"
+	"aringascrastasympasympeqatildeaumlawconintawintbNotbackcongbacke"
+	"psilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkb"
+	"congbcybdquobecausbecausebemptyvbepsibernoubetabethbetweenbfrbig"
+	"capbigcircbigcupbigodotbigoplusbigotimesbigsqcupbigstarbigtriang"
+	"ledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblack"
+	"squareblacktriangleblacktriangledownblacktriangleleftblacktriang"
+	"lerightblankblk12blk14blk34blockbnebnequivbnotbopfbotbottombowti"
+	"eboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxU"
+	"rboxVboxVHboxVLboxVRboxVhboxVlboxVrboxboxboxdLboxdRboxdlboxdrbox"
+	"hboxhDboxhUboxhdboxhuboxminusboxplusboxtimesboxuLboxuRboxulboxur"
+	"boxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsim"
+	"bsimebsolbsolbbsolhsubbullbulletbumpbumpEbumpebumpeqcacutecapcap"
+	"andcapbrcupcapcapcapcupcapdotcapscaretcaronccapsccaronccedilccir"
+	"cccupsccupssmcdotcedilcemptyvcentcenterdotcfrchcycheckcheckmarkc"
+	"hicircirEcirccirceqcirclearrowleftcirclearrowrightcircledRcircle"
+	"dScircledastcircledcirccircleddashcirecirfnintcirmidcirscirclubs"
+	"clubsuitcoloncolonecoloneqcommacommatcompcompfncomplementcomplex"
+	"escongcongdotconintcopfcoprodcopycopysrcrarrcrosscscrcsubcsubecs"
+	"upcsupectdotcudarrlcudarrrcueprcuesccularrcularrpcupcupbrcapcupc"
+	"apcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyv"
+	"eecurlywedgecurrencurvearrowleftcurvearrowrightcuveecuwedcwconin"
+	"tcwintcylctydArrdHardaggerdalethdarrdashdashvdbkarowdblacdcarond"
+	"cyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdia"
+	"monddiamondsuitdiamsdiedigammadisindivdividedivideontimesdivonxd"
+	"jcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplusdotsquar"
+	"edoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoon"
+	"rightdrbkarowdrcorndrcropdscrdscydsoldstrokdtdotdtridtrifduarrdu"
+	"hardwangledzcydzigrarreDDoteDoteacuteeasterecaronecirecircecolon"
+	"ecyedoteeefDotefregegraveegsegsdotelelintersellelselsdotemacremp"
+	"tyemptysetemptyvemspemsp13emsp14engenspeogoneopfepareparslepluse"
+	"psiepsilonepsiveqcirceqcoloneqsimeqslantgtreqslantlessequalseque"
+	"stequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexcle"
+	"xistexpectationexponentialefallingdotseqfcyfemaleffiligffligffll"
+	"igffrfiligfjligflatflligfltnsfnoffopfforallforkforkvfpartintfrac"
+	"12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38fr"
+	"ac45frac56frac58frac78fraslfrownfscrgEgElgacutegammagammadgapgbr"
+	"evegcircgcygdotgegelgeqgeqqgeqslantgesgesccgesdotgesdotogesdotol"
+	"geslgeslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneq"
+	"qgnsimgopfgravegscrgsimgsimegsimlgtgtccgtcirgtdotgtlPargtquestgt"
+	"rapproxgtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnE"
+	"hArrhairsphalfhamilthardcyharrharrcirharrwhbarhcircheartsheartsu"
+	"ithellipherconhfrhksearowhkswarowhoarrhomththookleftarrowhookrig"
+	"htarrowhopfhorbarhscrhslashhstrokhybullhypheniacuteicicircicyiec"
+	"yiexcliffifrigraveiiiiiintiiintiinfiniiotaijligimacrimageimaglin"
+	"eimagpartimathimofimpedinincareinfininfintieinodotintintcalinteg"
+	"ersintercalintlarhkintprodiocyiogoniopfiotaiprodiquestiscrisinis"
+	"inEisindotisinsisinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfj"
+	"scrjsercyjukcykappakappavkcedilkcykfrkgreenkhcykjcykopfkscrlAarr"
+	"lArrlAtaillBarrlElEglHarlacutelaemptyvlagranlambdalanglangdlangl"
+	"elaplaquolarrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtlla"
+	"tlataillatelateslbarrlbbrklbracelbracklbrkelbrksldlbrkslulcaronl"
+	"cedillceillcublcyldcaldquoldquorldrdharldrusharldshleleftarrowle"
+	"ftarrowtailleftharpoondownleftharpoonupleftleftarrowsleftrightar"
+	"rowleftrightarrowsleftrightharpoonsleftrightsquigarrowleftthreet"
+	"imeslegleqleqqleqslantleslescclesdotlesdotolesdotorlesglesgesles"
+	"sapproxlessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlg"
+	"lgElhardlharulharullhblkljcyllllarrllcornerllhardlltrilmidotlmou"
+	"stlmoustachelnElnaplnapproxlnelneqlneqqlnsimloangloarrlobrklongl"
+	"eftarrowlongleftrightarrowlongmapstolongrightarrowlooparrowleftl"
+	"ooparrowrightloparlopflopluslotimeslowastlowbarlozlozengelozflpa"
+	"rlparltlrarrlrcornerlrharlrhardlrmlrtrilsaquolscrlshlsimlsimelsi"
+	"mglsqblsquolsquorlstrokltltccltcirltdotlthreeltimesltlarrltquest"
+	"ltrParltriltrieltriflurdsharluruharlvertneqqlvnEmDDotmacrmalemal"
+	"tmaltesemapmapstomapstodownmapstoleftmapstoupmarkermcommamcymdas"
+	"hmeasuredanglemfrmhomicromidmidastmidcirmiddotminusminusbminusdm"
+	"inusdumlcpmldrmnplusmodelsmopfmpmscrmstposmumultimapmumapnGgnGtn"
+	"GtvnLeftarrownLeftrightarrownLlnLtnLtvnRightarrownVDashnVdashnab"
+	"lanacutenangnapnapEnapidnaposnapproxnaturnaturalnaturalsnbspnbum"
+	"pnbumpencapncaronncedilncongncongdotncupncyndashneneArrnearhknea"
+	"rrnearrownedotnequivnesearnesimnexistnexistsnfrngEngengeqngeqqng"
+	"eqslantngesngsimngtngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnl"
+	"arrnldrnlenleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnl"
+	"simnltnltrinltrienmidnopfnotnotinnotinEnotindotnotinvanotinvbnot"
+	"invcnotninotnivanotnivbnotnivcnparnparallelnparslnpartnpolintnpr"
+	"nprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrownrtrinrtr"
+	"ienscnsccuenscenscrnshortmidnshortparallelnsimnsimensimeqnsmidns"
+	"parnsqsubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqqnsuccns"
+	"ucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlgntria"
+	"ngleleftntrianglelefteqntrianglerightntrianglerighteqnunumnumero"
+	"numspnvDashnvHarrnvapnvdashnvgenvgtnvinfinnvlArrnvlenvltnvltrien"
+	"vrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastociroc"
+	"ircocyodashodblacodivodotodsoldoeligofcirofrogonograveogtohbaroh"
+	"mointolarrolcirolcrossolineoltomacromegaomicronomidominusoopfopa"
+	"roperpoplusororarrordorderorderofordfordmorigoforororslopeorvosc"
+	"roslashosolotildeotimesotimesasoumlovbarparparaparallelparsimpar"
+	"slpartpcypercntperiodpermilperppertenkpfrphiphivphmmatphonepipit"
+	"chforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdu"
+	"pluseplusmnplussimplustwopmpointintpopfpoundprprEprapprcueprepre"
+	"cprecapproxpreccurlyeqpreceqprecnapproxprecneqqprecnsimprecsimpr"
+	"imeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptopr"
+	"simprurelpscrpsipuncspqfrqintqopfqprimeqscrquaternionsquatintque"
+	"stquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradicraemptyvrang"
+	"rangdrangerangleraquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarr"
+	"lprarrplrarrsimrarrtlrarrwratailratiorationalsrbarrrbbrkrbracerb"
+	"rackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdcardldharrdquor"
+	"dquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrhar"
+	"urharulrhorhovrightarrowrightarrowtailrightharpoondownrightharpo"
+	"onuprightleftarrowsrightleftharpoonsrightrightarrowsrightsquigar"
+	"rowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustacher"
+	"nmidroangroarrrobrkroparropfroplusrotimesrparrpargtrppolintrrarr"
+	"rsaquorscrrshrsqbrsquorsquorrthreertimesrtrirtriertrifrtriltriru"
+	"luharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscn"
+	"simscpolintscsimscysdotsdotbsdoteseArrsearhksearrsearrowsectsemi"
+	"seswarsetminussetmnsextsfrsfrownsharpshchcyshcyshortmidshortpara"
+	"llelshysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimn"
+	"esimplussimrarrslarrsmallsetminussmashpsmeparslsmidsmilesmtsmtes"
+	"mtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcapsqcapssqcupsq"
+	"cupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsq"
+	"usquaresquarfsqufsrarrsscrssetmnssmilesstarfstarstarfstraighteps"
+	"ilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnEsubnesub"
+	"plussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsu"
+	"bsubsupsuccsuccapproxsucccurlyeqsucceqsuccnapproxsuccneqqsuccnsi"
+	"msuccsimsumsungsupsup1sup2sup3supEsupdotsupdsubsupesupedotsuphso"
+	"lsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqqsu"
+	"psetneqsupsetneqqsupsimsupsubsupsupswArrswarhkswarrswarrowswnwar"
+	"szligtargettautbrktcarontcediltcytdottelrectfrthere4thereforethe"
+	"tathetasymthetavthickapproxthicksimthinspthkapthksimthorntildeti"
+	"mestimesbtimesbartimesdtinttoeatoptopbottopcirtopftopforktosatpr"
+	"imetradetriangletriangledowntrianglelefttrianglelefteqtriangleqt"
+	"rianglerighttrianglerighteqtridottrietriminustriplustrisbtritime"
+	"trpeziumtscrtscytshcytstroktwixttwoheadleftarrowtwoheadrightarro"
+	"wuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudharufishtufru"
+	"graveuharluharruhblkulcornulcornerulcropultriumacrumluogonuopfup"
+	"arrowupdownarrowupharpoonleftupharpoonrightuplusupsiupsihupsilon"
+	"upuparrowsurcornurcornerurcropuringurtriuscrutdotutildeutriutrif"
+	"uuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarkappavarnot"
+	"hingvarphivarpivarproptovarrvarrhovarsigmavarsubsetneqvarsubsetn"
+	"eqqvarsupsetneqvarsupsetneqqvarthetavartriangleleftvartriangleri"
+	"ghtvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsupvopfv"
+	"propvrtrivscrvsubnEvsubnevsupnEvsupnevzigzagwcircwedbarwedgewedg"
+	"eqweierpwfrwopfwpwrwreathwscrxcapxcircxcupxdtrixfrxhArrxharrxixl"
+	"ArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusx"
+	"utrixveexwedgeyacuteyacyycircycyyenyfryicyyopfyscryucyyumlzacute"
+	"zcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj"
+;
+
+static const uint16_t html_entity_offset[HTML_ENTITY_COUNT] = {
+	0, 5, 8, 14, 20, 25, 28, 31, 37, 42, 47, 50, 55, 59, 72, 77,
+	81, 87, 93, 97, 106, 110, 116, 119, 126, 136, 140, 143, 147, 152, 156, 162,
+	166, 170, 176, 179, 199, 206, 212, 218, 223, 230, 234, 241, 250, 253, 256, 265,
+	276, 286, 297, 321, 342, 357, 362, 368, 377, 383, 398, 402, 411, 442, 447, 451,
+	454, 460, 462, 470, 474, 478, 482, 488, 492, 497, 503, 506, 509, 514, 517, 533,
+	547, 569, 585, 601, 608, 621, 625, 628, 634, 642, 663, 672, 687, 702, 722, 735,
+	754, 778, 798, 814, 828, 841, 858, 875, 884, 896, 912, 921, 940, 957, 971, 988,
+	1006, 1021, 1039, 1046, 1058, 1067, 1071, 1077, 1080, 1083, 1089, 1095, 1100, 1103, 1107, 1110,
+	1116, 1123, 1128, 1144, 1164, 1169, 1173, 1180, 1185, 1195, 1206, 1210, 1214, 1217, 1221, 1227,
+	1239, 1242, 1245, 1262, 1283, 1287, 1293, 1303, 1307, 1311, 1313, 1318, 1324, 1330, 1336, 1341,
+	1344, 1348, 1351, 1353, 1357, 1369, 1385, 1401, 1415, 1426, 1443, 1455, 1459, 1461, 1467, 1472,
+	1475, 1480, 1483, 1495, 1499, 1513, 1517, 1523, 1535, 1544, 1548, 1553, 1557, 1563, 1568, 1571,
+	1575, 1578, 1584, 1586, 1591, 1601, 1608, 1611, 1619, 1631, 1645, 1659, 1664, 1668, 1672, 1676,
+	1682, 1687, 1691, 1696, 1699, 1702, 1706, 1710, 1716, 1721, 1725, 1729, 1734, 1740, 1743, 1746,
+	1750, 1754, 1758, 1760, 1766, 1772, 1776, 1786, 1790, 1796, 1802, 1805, 1821, 1830, 1842, 1861,
+	1872, 1889, 1906, 1920, 1937, 1946, 1960, 1975, 1982, 1994, 2007, 2019, 2034, 2051, 2067, 2082,
+	2094, 2109, 2119, 2132, 2141, 2155, 2171, 2184, 2195, 2203, 2217, 2226, 2229, 2231, 2241, 2247,
+	2260, 2278, 2292, 2305, 2323, 2337, 2341, 2355, 2370, 2374, 2377, 2383, 2385, 2388, 2391, 2402,
+	2411, 2414, 2423, 2427, 2431, 2433, 2437, 2443, 2449, 2455, 2458, 2477, 2495, 2512, 2533, 2553,
+	2567, 2574, 2577, 2584, 2600, 2604, 2607, 2619, 2628, 2648, 2658, 2666, 2679, 2688, 2698, 2713,
+	2732, 2749, 2763, 2783, 2798, 2813, 2825, 2840, 2858, 2878, 2885, 2897, 2911, 2922, 2939, 2951,
+	2974, 2991, 3002, 3018, 3039, 3056, 3072, 3091, 3112, 3127, 3147, 3164, 3186, 3195, 3209, 3220,
+	3236, 3257, 3273, 3284, 3300, 3308, 3321, 3338, 3351, 3365, 3369, 3375, 3377, 3382, 3388, 3393,
+	3396, 3402, 3405, 3411, 3416, 3421, 3428, 3432, 3452, 3466, 3468, 3472, 3478, 3484, 3490, 3494,
+	3501, 3510, 3521, 3536, 3544, 3547, 3550, 3553, 3555, 3564, 3577, 3581, 3583, 3591, 3604, 3622,
+	3635, 3640, 3647, 3657, 3669, 3673, 3676, 3680, 3683, 3687, 3691, 3696, 3699, 3705, 3709, 3713,
+	3719, 3725, 3731, 3734, 3736, 3750, 3768, 3788, 3791, 3794, 3811, 3821, 3834, 3853, 3865, 3883,
+	3901, 3916, 3934, 3944, 3952, 3965, 3979, 3992, 4008, 4026, 4043, 4059, 4072, 4088, 4099, 4113,
+	4123, 4127, 4139, 4150, 4154, 4157, 4168, 4174, 4178, 4184, 4190, 4192, 4198, 4204, 4209, 4212,
+	4215, 4229, 4243, 4258, 4270, 4275, 4286, 4290, 4294, 4300, 4318, 4330, 4347, 4361, 4380, 4391,
+	4395, 4399, 4402, 4408, 4419, 4427, 4440, 4458, 4471, 4479, 4482, 4485, 4493, 4506, 4512, 4517,
+	4522, 4527, 4531, 4534, 4537, 4543, 4549, 4552, 4555, 4564, 4569, 4579, 4588, 4593, 4603, 4617,
+	4627, 4631, 4640, 4644, 4650, 4656, 4660, 4668, 4673, 4679, 4684, 4687, 4693, 4696, 4702, 4707,
+	4715, 4725, 4737, 4753, 4758, 4767, 4772, 4776, 4783, 4793, 4809, 4820, 4833, 4838, 4848, 4855,
+	4866, 4880, 4895, 4899, 4906, 4911, 4915, 4921, 4925, 4930, 4934, 4937, 4942, 4948, 4951, 4957,
+	4961, 4972, 4984, 5001, 5014, 5027, 5030, 5034, 5038, 5044, 5049, 5054, 5057, 5061, 5065, 5068,
+	5070, 5074, 5078, 5082, 5086, 5090, 5096, 5101, 5104, 5107, 5111, 5115, 5119, 5123, 5129, 5135,
+	5138, 5142, 5156, 5160, 5163, 5167, 5171, 5177, 5183, 5185, 5188, 5191, 5196, 5201, 5204, 5209,
+	5211, 5214, 5220, 5227, 5232, 5237, 5242, 5247, 5250, 5253, 5259, 5263, 5271, 5275, 5278, 5282,
+	5287, 5293, 5301, 5309, 5317, 5325, 5333, 5341, 5349, 5357, 5362, 5369, 5377, 5383, 5388, 5395,
+	5400, 5404, 5406, 5409, 5415, 5418, 5422, 5426, 5432, 5440, 5445, 5449, 5452, 5457, 5464, 5470,
+	5474, 5482, 5487, 5491, 5499, 5510, 5519, 5526, 5535, 5541, 5547, 5555, 5559, 5567, 5572, 5575,
+	5580, 5586, 5593, 5600, 5605, 5611, 5615, 5619, 5626, 5629, 5635, 5642, 5648, 5655, 5663, 5672,
+	5680, 5687, 5702, 5715, 5723, 5729, 5737, 5743, 5755, 5766, 5779, 5796, 5813, 5831, 5836, 5841,
+	5846, 5851, 5856, 5859, 5866, 5870, 5874, 5877, 5883, 5889, 5894, 5899, 5904, 5909, 5913, 5918,
+	5923, 5928, 5933, 5938, 5943, 5948, 5953, 5957, 5962, 5967, 5972, 5977, 5982, 5987, 5993, 5998,
+	6003, 6008, 6013, 6017, 6022, 6027, 6032, 6037, 6045, 6052, 6060, 6065, 6070, 6075, 6080, 6084,
+	6089, 6094, 6099, 6104, 6109, 6114, 6120, 6125, 6131, 6135, 6140, 6144, 6149, 6153, 6158, 6166,
+	6170, 6176, 6180, 6185, 6190, 6196, 6202, 6205, 6211, 6219, 6225, 6231, 6237, 6241, 6246, 6251,
+	6256, 6262, 6268, 6273, 6278, 6285, 6289, 6294, 6301, 6305, 6314, 6317, 6321, 6326, 6335, 6338,
+	6341, 6345, 6349, 6355, 6370, 6386, 6394, 6402, 6412, 6423, 6434, 6438, 6446, 6452, 6459, 6464,
+	6472, 6477, 6483, 6490, 6495, 6501, 6505, 6511, 6521, 6530, 6534, 6541, 6547, 6551, 6557, 6561,
+	6567, 6572, 6577, 6581, 6585, 6590, 6594, 6599, 6604, 6611, 6618, 6623, 6628, 6634, 6641, 6644,
+	6652, 6658, 6664, 6670, 6675, 6679, 6685, 6692, 6703, 6714, 6722, 6732, 6738, 6752, 6767, 6772,
+	6777, 6785, 6790, 6796, 6800, 6804, 6810, 6816, 6820, 6824, 6829, 6836, 6841, 6847, 6850, 6852,
+	6859, 6864, 6871, 6874, 6879, 6886, 6892, 6895, 6900, 6905, 6909, 6916, 6927, 6932, 6935, 6942,
+	6947, 6950, 6956, 6969, 6975, 6979, 6985, 6991, 6997, 7001, 7004, 7009, 7017, 7025, 7032, 7041,
+	7055, 7064, 7078, 7093, 7109, 7117, 7123, 7129, 7133, 7137, 7141, 7147, 7152, 7156, 7161, 7166,
+	7171, 7178, 7182, 7190, 7195, 7199, 7205, 7211, 7217, 7221, 7226, 7232, 7235, 7239, 7241, 7246,
+	7249, 7251, 7257, 7260, 7266, 7268, 7276, 7279, 7282, 7288, 7293, 7298, 7306, 7312, 7316, 7322,
+	7328, 7331, 7335, 7340, 7344, 7348, 7354, 7359, 7363, 7370, 7375, 7381, 7388, 7393, 7403, 7414,
+	7420, 7426, 7431, 7438, 7446, 7451, 7456, 7460, 7465, 7469, 7472, 7475, 7479, 7483, 7487, 7492,
+	7503, 7515, 7528, 7531, 7537, 7543, 7548, 7554, 7557, 7562, 7567, 7571, 7576, 7581, 7585, 7589,
+	7595, 7599, 7604, 7612, 7618, 7624, 7630, 7636, 7642, 7648, 7654, 7660, 7666, 7672, 7678, 7684,
+	7690, 7696, 7702, 7707, 7712, 7716, 7718, 7721, 7727, 7732, 7738, 7741, 7747, 7752, 7755, 7759,
+	7761, 7764, 7767, 7771, 7779, 7782, 7787, 7793, 7800, 7808, 7812, 7818, 7821, 7823, 7826, 7831,
+	7835, 7837, 7840, 7843, 7846, 7849, 7853, 7861, 7864, 7868, 7873, 7878, 7882, 7887, 7891, 7895,
+	7900, 7905, 7907, 7911, 7916, 7921, 7927, 7934, 7943, 7949, 7955, 7964, 7974, 7981, 7987, 7996,
+	8000, 8004, 8010, 8014, 8020, 8026, 8030, 8037, 8042, 8046, 8051, 8057, 8066, 8072, 8078, 8081,
+	8089, 8097, 8102, 8108, 8121, 8135, 8139, 8145, 8149, 8155, 8161, 8167, 8173, 8179, 8181, 8186,
+	8189, 8193, 8198, 8201, 8204, 8210, 8212, 8218, 8223, 8229, 8234, 8239, 8244, 8249, 8257, 8265,
+	8270, 8274, 8279, 8281, 8287, 8292, 8300, 8306, 8309, 8315, 8323, 8331, 8339, 8346, 8350, 8355,
+	8359, 8363, 8368, 8374, 8378, 8382, 8387, 8394, 8399, 8405, 8410, 8412, 8418, 8423, 8427, 8432,
+	8435, 8438, 8443, 8447, 8451, 8457, 8462, 8467, 8473, 8479, 8482, 8485, 8491, 8495, 8499, 8503,
+	8507, 8512, 8516, 8522, 8527, 8529, 8532, 8536, 8542, 8550, 8556, 8562, 8566, 8571, 8577, 8580,
+	8585, 8589, 8594, 8601, 8607, 8613, 8619, 8625, 8632, 8638, 8641, 8647, 8651, 8656, 8661, 8666,
+	8672, 8678, 8683, 8690, 8697, 8703, 8709, 8714, 8718, 8721, 8725, 8730, 8736, 8743, 8751, 8755,
+	8757, 8766, 8779, 8794, 8807, 8821, 8835, 8850, 8867, 8886, 8900, 8903, 8906, 8910, 8918, 8921,
+	8926, 8932, 8939, 8947, 8951, 8957, 8967, 8974, 8983, 8993, 9000, 9007, 9013, 9019, 9022, 9024,
+	9027, 9032, 9037, 9043, 9048, 9052, 9054, 9059, 9067, 9073, 9078, 9084, 9090, 9100, 9103, 9107,
+	9115, 9118, 9122, 9127, 9132, 9137, 9142, 9147, 9160, 9178, 9188, 9202, 9215, 9229, 9234, 9238,
+	9244, 9251, 9257, 9263, 9266, 9273, 9277, 9281, 9287, 9292, 9300, 9305, 9311, 9314, 9319, 9325,
+	9329, 9332, 9336, 9341, 9346, 9350, 9355, 9361, 9367, 9369, 9373, 9378, 9383, 9389, 9395, 9401,
+	9408, 9414, 9418, 9423, 9428, 9436, 9443, 9452, 9456, 9461, 9465, 9469, 9473, 9480, 9483, 9489,
+	9499, 9509, 9517, 9523, 9529, 9532, 9537, 9550, 9553, 9556, 9561, 9564, 9570, 9576, 9582, 9587,
+	9593, 9599, 9606, 9610, 9614, 9620, 9626, 9630, 9632, 9636, 9642, 9644, 9652, 9657, 9660, 9663,
+	9667, 9677, 9692, 9695, 9698, 9702, 9713, 9719, 9725, 9730, 9736, 9740, 9743, 9747, 9752, 9757,
+	9764, 9769, 9776, 9784, 9788, 9793, 9799, 9803, 9809, 9815, 9820, 9828, 9832, 9835, 9840, 9842,
+	9847, 9853, 9858, 9865, 9870, 9876, 9882, 9887, 9893, 9900, 9903, 9906, 9909, 9913, 9918, 9927,
+	9931, 9936, 9939, 9943, 9948, 9953, 9958, 9960, 9963, 9967, 9970, 9974, 9979, 9982, 9987, 9991,
+	9994, 10004, 10019, 10023, 10028, 10037, 10041, 10046, 10051, 10054, 10059, 10065, 10069, 10073, 10076, 10081,
+	10087, 10095, 10102, 10109, 10116, 10121, 10128, 10135, 10142, 10146, 10155, 10161, 10166, 10173, 10176, 10182,
+	10186, 10191, 10198, 10203, 10208, 10214, 10220, 10231, 10236, 10242, 10245, 10251, 10255, 10259, 10268, 10282,
+	10286, 10291, 10297, 10302, 10307, 10314, 10321, 10325, 10330, 10335, 10342, 10351, 10361, 10366, 10373, 10377,
+	10382, 10387, 10394, 10403, 10413, 10417, 10423, 10427, 10440, 10455, 10469, 10485, 10487, 10490, 10496, 10501,
+	10507, 10513, 10517, 10523, 10527, 10531, 10538, 10544, 10548, 10552, 10559, 10565, 10572, 10577, 10582, 10588,
+	10593, 10600, 10606, 10608, 10614, 10618, 10622, 10627, 10630, 10635, 10641, 10645, 10649, 10655, 10660, 10665,
+	10668, 10672, 10678, 10681, 10686, 10689, 10693, 10698, 10703, 10710, 10715, 10718, 10723, 10728, 10735, 10739,
+	10745, 10749, 10753, 10758, 10763, 10765, 10770, 10773, 10778, 10785, 10789, 10793, 10799, 10803, 10810, 10813,
+	10817, 10823, 10827, 10833, 10839, 10847, 10851, 10856, 10859, 10863, 10871, 10877, 10882, 10886, 10889, 10895,
+	10901, 10907, 10911, 10918, 10921, 10924, 10928, 10934, 10939, 10941, 10950, 10953, 10959, 10966, 10972, 10976,
+	10984, 10989, 10996, 11002, 11008, 11013, 11019, 11026, 11033, 11035, 11043, 11047, 11052, 11054, 11057, 11061,
+	11066, 11069, 11073, 11083, 11094, 11100, 11111, 11119, 11127, 11134, 11139, 11145, 11149, 11154, 11160, 11164,
+	11172, 11180, 11188, 11192, 11198, 11203, 11209, 11213, 11216, 11222, 11225, 11229, 11233, 11239, 11243, 11254,
+	11261, 11266, 11273, 11277, 11282, 11286, 11292, 11297, 11301, 11305, 11311, 11316, 11324, 11328, 11333, 11338,
+	11344, 11349, 11353, 11359, 11364, 11371, 11376, 11382, 11388, 11394, 11400, 11407, 11413, 11418, 11424, 11429,
+	11438, 11443, 11448, 11454, 11460, 11465, 11472, 11479, 11485, 11491, 11496, 11500, 11503, 11507, 11514, 11519,
+	11525, 11529, 11533, 11540, 11548, 11553, 11557, 11560, 11566, 11572, 11575, 11580, 11585, 11591, 11594, 11598,
+	11608, 11622, 11638, 11652, 11667, 11684, 11700, 11715, 11730, 11734, 11746, 11751, 11756, 11759, 11765, 11775,
+	11780, 11785, 11790, 11795, 11800, 11804, 11810, 11817, 11821, 11827, 11835, 11840, 11846, 11850, 11853, 11857,
+	11862, 11868, 11874, 11880, 11884, 11889, 11894, 11902, 11909, 11911, 11917, 11922, 11924, 11927, 11931, 11937,
+	11942, 11945, 11951, 11956, 11960, 11965, 11971, 11979, 11984, 11987, 11991, 11996, 12001, 12006, 12012, 12017,
+	12024, 12028, 12032, 12038, 12046, 12051, 12055, 12058, 12064, 12069, 12075, 12079, 12087, 12100, 12103, 12108,
+	12114, 12120, 12123, 12129, 12133, 12138, 12142, 12147, 12151, 12156, 12161, 12168, 12175, 12180, 12193, 12199,
+	12207, 12211, 12216, 12219, 12223, 12228, 12234, 12237, 12241, 12247, 12251, 12257, 12266, 12270, 12275, 12281,
+	12286, 12292, 12297, 12303, 12311, 12321, 12326, 12332, 12340, 12350, 12353, 12359, 12365, 12369, 12374, 12378,
+	12384, 12390, 12396, 12400, 12405, 12420, 12431, 12436, 12439, 12443, 12449, 12453, 12460, 12467, 12472, 12477,
+	12484, 12491, 12497, 12505, 12514, 12523, 12533, 12539, 12545, 12551, 12555, 12565, 12576, 12582, 12593, 12601,
+	12609, 12616, 12619, 12623, 12626, 12630, 12634, 12638, 12642, 12648, 12655, 12659, 12666, 12673, 12680, 12687,
+	12694, 12699, 12704, 12711, 12717, 12725, 12734, 12743, 12753, 12759, 12765, 12771, 12776, 12782, 12787, 12794,
+	12800, 12805, 12811, 12814, 12818, 12824, 12830, 12833, 12837, 12843, 12846, 12852, 12861, 12866, 12874, 12880,
+	12891, 12899, 12905, 12910, 12916, 12921, 12926, 12931, 12937, 12945, 12951, 12955, 12959, 12962, 12968, 12974,
+	12978, 12985, 12989, 12995, 13000, 13008, 13020, 13032, 13046, 13055, 13068, 13083, 13089, 13093, 13101, 13108,
+	13113, 13120, 13128, 13132, 13136, 13141, 13147, 13152, 13168, 13185, 13189, 13193, 13199, 13203, 13208, 13214,
+	13219, 13222, 13227, 13233, 13238, 13244, 13247, 13253, 13258, 13263, 13268, 13274, 13282, 13288, 13293, 13298,
+	13301, 13306, 13310, 13317, 13328, 13341, 13355, 13360, 13364, 13369, 13376, 13386, 13392, 13400, 13406, 13411,
+	13416, 13420, 13425, 13431, 13435, 13440, 13445, 13449, 13456, 13460, 13464, 13469, 13474, 13480, 13490, 13498,
+	13508, 13514, 13519, 13528, 13532, 13538, 13546, 13558, 13571, 13583, 13596, 13604, 13619, 13635, 13638, 13643,
+	13646, 13652, 13657, 13663, 13669, 13673, 13676, 13681, 13686, 13691, 13695, 13700, 13705, 13709, 13715, 13721,
+	13727, 13733, 13740, 13745, 13751, 13756, 13762, 13768, 13771, 13775, 13777, 13779, 13785, 13789, 13793, 13798,
+	13802, 13807, 13810, 13815, 13820, 13822, 13827, 13832, 13836, 13840, 13845, 13849, 13855, 13861, 13866, 13871,
+	13875, 13881, 13887, 13892, 13896, 13902, 13908, 13912, 13917, 13920, 13923, 13926, 13930, 13934, 13938, 13942,
+	13946, 13952, 13958, 13961, 13965, 13971, 13975, 13978, 13982, 13989, 13993, 13997, 14000,
+};
+
+static const uint8_t html_entity_size[HTML_ENTITY_COUNT] = {
+	5, 3, 6, 6, 5, 3, 3, 6, 5, 5, 3, 5, 4, 13, 5, 4,
+	6, 6, 4, 9, 4, 6, 3, 7, 10, 4, 3, 4, 5, 4, 6, 4,
+	4, 6, 3, 20, 7, 6, 6, 5, 7, 4, 7, 9, 3, 3, 9, 11,
+	10, 11, 24, 21, 15, 5, 6, 9, 6, 15, 4, 9, 31, 5, 4, 3,
+	6, 2, 8, 4, 4, 4, 6, 4, 5, 6, 3, 3, 5, 3, 16, 14,
+	22, 16, 16, 7, 13, 4, 3, 6, 8, 21, 9, 15, 15, 20, 13, 19,
+	24, 20, 16, 14, 13, 17, 17, 9, 12, 16, 9, 19, 17, 14, 17, 18,
+	15, 18, 7, 12, 9, 4, 6, 3, 3, 6, 6, 5, 3, 4, 3, 6,
+	7, 5, 16, 20, 5, 4, 7, 5, 10, 11, 4, 4, 3, 4, 6, 12,
+	3, 3, 17, 21, 4, 6, 10, 4, 4, 2, 5, 6, 6, 6, 5, 3,
+	4, 3, 2, 4, 12, 16, 16, 14, 11, 17, 12, 4, 2, 6, 5, 3,
+	5, 3, 12, 4, 14, 4, 6, 12, 9, 4, 5, 4, 6, 5, 3, 4,
+	3, 6, 2, 5, 10, 7, 3, 8, 12, 14, 14, 5, 4, 4, 4, 6,
+	5, 4, 5, 3, 3, 4, 4, 6, 5, 4, 4, 5, 6, 3, 3, 4,
+	4, 4, 2, 6, 6, 4, 10, 4, 6, 6, 3, 16, 9, 12, 19, 11,
+	17, 17, 14, 17, 9, 14, 15, 7, 12, 13, 12, 15, 17, 16, 15, 12,
+	15, 10, 13, 9, 14, 16, 13, 11, 8, 14, 9, 3, 2, 10, 6, 13,
+	18, 14, 13, 18, 14, 4, 14, 15, 4, 3, 6, 2, 3, 3, 11, 9,
+	3, 9, 4, 4, 2, 4, 6, 6, 6, 3, 19, 18, 17, 21, 20, 14,
+	7, 3, 7, 16, 4, 3, 12, 9, 20, 10, 8, 13, 9, 10, 15, 19,
+	17, 14, 20, 15, 15, 12, 15, 18, 20, 7, 12, 14, 11, 17, 12, 23,
+	17, 11, 16, 21, 17, 16, 19, 21, 15, 20, 17, 22, 9, 14, 11, 16,
+	21, 16, 11, 16, 8, 13, 17, 13, 14, 4, 6, 2, 5, 6, 5, 3,
+	6, 3, 6, 5, 5, 7, 4, 20, 14, 2, 4, 6, 6, 6, 4, 7,
+	9, 11, 15, 8, 3, 3, 3, 2, 9, 13, 4, 2, 8, 13, 18, 13,
+	5, 7, 10, 12, 4, 3, 4, 3, 4, 4, 5, 3, 6, 4, 4, 6,
+	6, 6, 3, 2, 14, 18, 20, 3, 3, 17, 10, 13, 19, 12, 18, 18,
+	15, 18, 10, 8, 13, 14, 13, 16, 18, 17, 16, 13, 16, 11, 14, 10,
+	4, 12, 11, 4, 3, 11, 6, 4, 6, 6, 2, 6, 6, 5, 3, 3,
+	14, 14, 15, 12, 5, 11, 4, 4, 6, 18, 12, 17, 14, 19, 11, 4,
+	4, 3, 6, 11, 8, 13, 18, 13, 8, 3, 3, 8, 13, 6, 5, 5,
+	5, 4, 3, 3, 6, 6, 3, 3, 9, 5, 10, 9, 5, 10, 14, 10,
+	4, 9, 4, 6, 6, 4, 8, 5, 6, 5, 3, 6, 3, 6, 5, 8,
+	10, 12, 16, 5, 9, 5, 4, 7, 10, 16, 11, 13, 5, 10, 7, 11,
+	14, 15, 4, 7, 5, 4, 6, 4, 5, 4, 3, 5, 6, 3, 6, 4,
+	11, 12, 17, 13, 13, 3, 4, 4, 6, 5, 5, 3, 4, 4, 3, 2,
+	4, 4, 4, 4, 4, 6, 5, 3, 3, 4, 4, 4, 4, 6, 6, 3,
+	4, 14, 4, 3, 4, 4, 6, 6, 2, 3, 3, 5, 5, 3, 5, 2,
+	3, 6, 7, 5, 5, 5, 5, 3, 3, 6, 4, 8, 4, 3, 4, 5,
+	6, 8, 8, 8, 8, 8, 8, 8, 8, 5, 7, 8, 6, 5, 7, 5,
+	4, 2, 3, 6, 3, 4, 4, 6, 8, 5, 4, 3, 5, 7, 6, 4,
+	8, 5, 4, 8, 11, 9, 7, 9, 6, 6, 8, 4, 8, 5, 3, 5,
+	6, 7, 7, 5, 6, 4, 4, 7, 3, 6, 7, 6, 7, 8, 9, 8,
+	7, 15, 13, 8, 6, 8, 6, 12, 11, 13, 17, 17, 18, 5, 5, 5,
+	5, 5, 3, 7, 4, 4, 3, 6, 6, 5, 5, 5, 5, 4, 5, 5,
+	5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 6, 5, 5,
+	5, 5, 4, 5, 5, 5, 5, 8, 7, 8, 5, 5, 5, 5, 4, 5,
+	5, 5, 5, 5, 5, 6, 5, 6, 4, 5, 4, 5, 4, 5, 8, 4,
+	6, 4, 5, 5, 6, 6, 3, 6, 8, 6, 6, 6, 4, 5, 5, 5,
+	6, 6, 5, 5, 7, 4, 5, 7, 4, 9, 3, 4, 5, 9, 3, 3,
+	4, 4, 6, 15, 16, 8, 8, 10, 11, 11, 4, 8, 6, 7, 5, 8,
+	5, 6, 7, 5, 6, 4, 6, 10, 9, 4, 7, 6, 4, 6, 4, 6,
+	5, 5, 4, 4, 5, 4, 5, 5, 7, 7, 5, 5, 6, 7, 3, 8,
+	6, 6, 6, 5, 4, 6, 7, 11, 11, 8, 10, 6, 14, 15, 5, 5,
+	8, 5, 6, 4, 4, 6, 6, 4, 4, 5, 7, 5, 6, 3, 2, 7,
+	5, 7, 3, 5, 7, 6, 3, 5, 5, 4, 7, 11, 5, 3, 7, 5,
+	3, 6, 13, 6, 4, 6, 6, 6, 4, 3, 5, 8, 8, 7, 9, 14,
+	9, 14, 15, 16, 8, 6, 6, 4, 4, 4, 6, 5, 4, 5, 5, 5,
+	7, 4, 8, 5, 4, 6, 6, 6, 4, 5, 6, 3, 4, 2, 5, 3,
+	2, 6, 3, 6, 2, 8, 3, 3, 6, 5, 5, 8, 6, 4, 6, 6,
+	3, 4, 5, 4, 4, 6, 5, 4, 7, 5, 6, 7, 5, 10, 11, 6,
+	6, 5, 7, 8, 5, 5, 4, 5, 4, 3, 3, 4, 4, 4, 5, 11,
+	12, 13, 3, 6, 6, 5, 6, 3, 5, 5, 4, 5, 5, 4, 4, 6,
+	4, 5, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 5, 5, 4, 2, 3, 6, 5, 6, 3, 6, 5, 3, 4, 2,
+	3, 3, 4, 8, 3, 5, 6, 7, 8, 4, 6, 3, 2, 3, 5, 4,
+	2, 3, 3, 3, 3, 4, 8, 3, 4, 5, 5, 4, 5, 4, 4, 5,
+	5, 2, 4, 5, 5, 6, 7, 9, 6, 6, 9, 10, 7, 6, 9, 4,
+	4, 6, 4, 6, 6, 4, 7, 5, 4, 5, 6, 9, 6, 6, 3, 8,
+	8, 5, 6, 13, 14, 4, 6, 4, 6, 6, 6, 6, 6, 2, 5, 3,
+	4, 5, 3, 3, 6, 2, 6, 5, 6, 5, 5, 5, 5, 8, 8, 5,
+	4, 5, 2, 6, 5, 8, 6, 3, 6, 8, 8, 8, 7, 4, 5, 4,
+	4, 5, 6, 4, 4, 5, 7, 5, 6, 5, 2, 6, 5, 4, 5, 3,
+	3, 5, 4, 4, 6, 5, 5, 6, 6, 3, 3, 6, 4, 4, 4, 4,
+	5, 4, 6, 5, 2, 3, 4, 6, 8, 6, 6, 4, 5, 6, 3, 5,
+	4, 5, 7, 6, 6, 6, 6, 7, 6, 3, 6, 4, 5, 5, 5, 6,
+	6, 5, 7, 7, 6, 6, 5, 4, 3, 4, 5, 6, 7, 8, 4, 2,
+	9, 13, 15, 13, 14, 14, 15, 17, 19, 14, 3, 3, 4, 8, 3, 5,
+	6, 7, 8, 4, 6, 10, 7, 9, 10, 7, 7, 6, 6, 3, 2, 3,
+	5, 5, 6, 5, 4, 2, 5, 8, 6, 5, 6, 6, 10, 3, 4, 8,
+	3, 4, 5, 5, 5, 5, 5, 13, 18, 10, 14, 13, 14, 5, 4, 6,
+	7, 6, 6, 3, 7, 4, 4, 6, 5, 8, 5, 6, 3, 5, 6, 4,
+	3, 4, 5, 5, 4, 5, 6, 6, 2, 4, 5, 5, 6, 6, 6, 7,
+	6, 4, 5, 5, 8, 7, 9, 4, 5, 4, 4, 4, 7, 3, 6, 10,
+	10, 8, 6, 6, 3, 5, 13, 3, 3, 5, 3, 6, 6, 6, 5, 6,
+	6, 7, 4, 4, 6, 6, 4, 2, 4, 6, 2, 8, 5, 3, 3, 4,
+	10, 15, 3, 3, 4, 11, 6, 6, 5, 6, 4, 3, 4, 5, 5, 7,
+	5, 7, 8, 4, 5, 6, 4, 6, 6, 5, 8, 4, 3, 5, 2, 5,
+	6, 5, 7, 5, 6, 6, 5, 6, 7, 3, 3, 3, 4, 5, 9, 4,
+	5, 3, 4, 5, 5, 5, 2, 3, 4, 3, 4, 5, 3, 5, 4, 3,
+	10, 15, 4, 5, 9, 4, 5, 5, 3, 5, 6, 4, 4, 3, 5, 6,
+	8, 7, 7, 7, 5, 7, 7, 7, 4, 9, 6, 5, 7, 3, 6, 4,
+	5, 7, 5, 5, 6, 6, 11, 5, 6, 3, 6, 4, 4, 9, 14, 4,
+	5, 6, 5, 5, 7, 7, 4, 5, 5, 7, 9, 10, 5, 7, 4, 5,
+	5, 7, 9, 10, 4, 6, 4, 13, 15, 14, 16, 2, 3, 6, 5, 6,
+	6, 4, 6, 4, 4, 7, 6, 4, 4, 7, 6, 7, 5, 5, 6, 5,
+	7, 6, 2, 6, 4, 4, 5, 3, 5, 6, 4, 4, 6, 5, 5, 3,
+	4, 6, 3, 5, 3, 4, 5, 5, 7, 5, 3, 5, 5, 7, 4, 6,
+	4, 4, 5, 5, 2, 5, 3, 5, 7, 4, 4, 6, 4, 7, 3, 4,
+	6, 4, 6, 6, 8, 4, 5, 3, 4, 8, 6, 5, 4, 3, 6, 6,
+	6, 4, 7, 3, 3, 4, 6, 5, 2, 9, 3, 6, 7, 6, 4, 8,
+	5, 7, 6, 6, 5, 6, 7, 7, 2, 8, 4, 5, 2, 3, 4, 5,
+	3, 4, 10, 11, 6, 11, 8, 8, 7, 5, 6, 4, 5, 6, 4, 8,
+	8, 8, 4, 6, 5, 6, 4, 3, 6, 3, 4, 4, 6, 4, 11, 7,
+	5, 7, 4, 5, 4, 6, 5, 4, 4, 6, 5, 8, 4, 5, 5, 6,
+	5, 4, 6, 5, 7, 5, 6, 6, 6, 6, 7, 6, 5, 6, 5, 9,
+	5, 5, 6, 6, 5, 7, 7, 6, 6, 5, 4, 3, 4, 7, 5, 6,
+	4, 4, 7, 8, 5, 4, 3, 6, 6, 3, 5, 5, 6, 3, 4, 10,
+	14, 16, 14, 15, 17, 16, 15, 15, 4, 12, 5, 5, 3, 6, 10, 5,
+	5, 5, 5, 5, 4, 6, 7, 4, 6, 8, 5, 6, 4, 3, 4, 5,
+	6, 6, 6, 4, 5, 5, 8, 7, 2, 6, 5, 2, 3, 4, 6, 5,
+	3, 6, 5, 4, 5, 6, 8, 5, 3, 4, 5, 5, 5, 6, 5, 7,
+	4, 4, 6, 8, 5, 4, 3, 6, 5, 6, 4, 8, 13, 3, 5, 6,
+	6, 3, 6, 4, 5, 4, 5, 4, 5, 5, 7, 7, 5, 13, 6, 8,
+	4, 5, 3, 4, 5, 6, 3, 4, 6, 4, 6, 9, 4, 5, 6, 5,
+	6, 5, 6, 8, 10, 5, 6, 8, 10, 3, 6, 6, 4, 5, 4, 6,
+	6, 6, 4, 5, 15, 11, 5, 3, 4, 6, 4, 7, 7, 5, 5, 7,
+	7, 6, 8, 9, 9, 10, 6, 6, 6, 4, 10, 11, 6, 11, 8, 8,
+	7, 3, 4, 3, 4, 4, 4, 4, 6, 7, 4, 7, 7, 7, 7, 7,
+	5, 5, 7, 6, 8, 9, 9, 10, 6, 6, 6, 5, 6, 5, 7, 6,
+	5, 6, 3, 4, 6, 6, 3, 4, 6, 3, 6, 9, 5, 8, 6, 11,
+	8, 6, 5, 6, 5, 5, 5, 6, 8, 6, 4, 4, 3, 6, 6, 4,
+	7, 4, 6, 5, 8, 12, 12, 14, 9, 13, 15, 6, 4, 8, 7, 5,
+	7, 8, 4, 4, 5, 6, 5, 16, 17, 4, 4, 6, 4, 5, 6, 5,
+	3, 5, 6, 5, 6, 3, 6, 5, 5, 5, 6, 8, 6, 5, 5, 3,
+	5, 4, 7, 11, 13, 14, 5, 4, 5, 7, 10, 6, 8, 6, 5, 5,
+	4, 5, 6, 4, 5, 5, 4, 7, 4, 4, 5, 5, 6, 10, 8, 10,
+	6, 5, 9, 4, 6, 8, 12, 13, 12, 13, 8, 15, 16, 3, 5, 3,
+	6, 5, 6, 6, 4, 3, 5, 5, 5, 4, 5, 5, 4, 6, 6, 6,
+	6, 7, 5, 6, 5, 6, 6, 3, 4, 2, 2, 6, 4, 4, 5, 4,
+	5, 3, 5, 5, 2, 5, 5, 4, 4, 5, 4, 6, 6, 5, 5, 4,
+	6, 6, 5, 4, 6, 6, 4, 5, 3, 3, 3, 4, 4, 4, 4, 4,
+	6, 6, 3, 4, 6, 4, 3, 4, 7, 4, 4, 3, 4,
+};
+
+static const uint32_t html_entity_code_points[HTML_ENTITY_COUNT][2] = {
+	{ 0xc6, 0x0 },  /* AElig */
+	{ 0x26, 0x0 },  /* AMP */
+	{ 0xc1, 0x0 },  /* Aacute */
+	{ 0x102, 0x0 },  /* Abreve */
+	{ 0xc2, 0x0 },  /* Acirc */
+	{ 0x410, 0x0 },  /* Acy */
+	{ 0x1d504, 0x0 },  /* Afr */
+	{ 0xc0, 0x0 },  /* Agrave */
+	{ 0x391, 0x0 },  /* Alpha */
+	{ 0x100, 0x0 },  /* Amacr */
+	{ 0x2a53, 0x0 },  /* And */
+	{ 0x104, 0x0 },  /* Aogon */
+	{ 0x1d538, 0x0 },  /* Aopf */
+	{ 0x2061, 0x0 },  /* ApplyFunction */
+	{ 0xc5, 0x0 },  /* Aring */
+	{ 0x1d49c, 0x0 },  /* Ascr */
+	{ 0x2254, 0x0 },  /* Assign */
+	{ 0xc3, 0x0 },  /* Atilde */
+	{ 0xc4, 0x0 },  /* Auml */
+	{ 0x2216, 0x0 },  /* Backslash */
+	{ 0x2ae7, 0x0 },  /* Barv */
+	{ 0x2306, 0x0 },  /* Barwed */
+	{ 0x411, 0x0 },  /* Bcy */
+	{ 0x2235, 0x0 },  /* Because */
+	{ 0x212c, 0x0 },  /* Bernoullis */
+	{ 0x392, 0x0 },  /* Beta */
+	{ 0x1d505, 0x0 },  /* Bfr */
+	{ 0x1d539, 0x0 },  /* Bopf */
+	{ 0x2d8, 0x0 },  /* Breve */
+	{ 0x212c, 0x0 },  /* Bscr */
+	{ 0x224e, 0x0 },  /* Bumpeq */
+	{ 0x427, 0x0 },  /* CHcy */
+	{ 0xa9, 0x0 },  /* COPY */
+	{ 0x106, 0x0 },  /* Cacute */
+	{ 0x22d2, 0x0 },  /* Cap */
+	{ 0x2145, 0x0 },  /* CapitalDifferentialD */
+	{ 0x212d, 0x0 },  /* Cayleys */
+	{ 0x10c, 0x0 },  /* Ccaron */
+	{ 0xc7, 0x0 },  /* Ccedil */
+	{ 0x108, 0x0 },  /* Ccirc */
+	{ 0x2230, 0x0 },  /* Cconint */
+	{ 0x10a, 0x0 },  /* Cdot */
+	{ 0xb8, 0x0 },  /* Cedilla */
+	{ 0xb7, 0x0 },  /* CenterDot */
+	{ 0x212d, 0x0 },  /* Cfr */
+	{ 0x3a7, 0x0 },  /* Chi */
+	{ 0x2299, 0x0 },  /* CircleDot */
+	{ 0x2296, 0x0 },  /* CircleMinus */
+	{ 0x2295, 0x0 },  /* CirclePlus */
+	{ 0x2297, 0x0 },  /* CircleTimes */
+	{ 0x2232, 0x0 },  /* ClockwiseContourIntegral */
+	{ 0x201d, 0x0 },  /* CloseCurlyDoubleQuote */
+	{ 0x2019, 0x0 },  /* CloseCurlyQuote */
+	{ 0x2237, 0x0 },  /* Colon */
+	{ 0x2a74, 0x0 },  /* Colone */
+	{ 0x2261, 0x0 },  /* Congruent */
+	{ 0x222f, 0x0 },  /* Conint */
+	{ 0x222e, 0x0 },  /* ContourIntegral */
+	{ 0x2102, 0x0 },  /* Copf */
+	{ 0x2210, 0x0 },  /* Coproduct */
+	{ 0x2233, 0x0 },  /* CounterClockwiseContourIntegral */
+	{ 0x2a2f, 0x0 },  /* Cross */
+	{ 0x1d49e, 0x0 },  /* Cscr */
+	{ 0x22d3, 0x0 },  /* Cup */
+	{ 0x224d, 0x0 },  /* CupCap */
+	{ 0x2145, 0x0 },  /* DD */
+	{ 0x2911, 0x0 },  /* DDotrahd */
+	{ 0x402, 0x0 },  /* DJcy */
+	{ 0x405, 0x0 },  /* DScy */
+	{ 0x40f, 0x0 },  /* DZcy */
+	{ 0x2021, 0x0 },  /* Dagger */
+	{ 0x21a1, 0x0 },  /* Darr */
+	{ 0x2ae4, 0x0 },  /* Dashv */
+	{ 0x10e, 0x0 },  /* Dcaron */
+	{ 0x414, 0x0 },  /* Dcy */
+	{ 0x2207, 0x0 },  /* Del */
+	{ 0x394, 0x0 },  /* Delta */
+	{ 0x1d507, 0x0 },  /* Dfr */
+	{ 0xb4, 0x0 },  /* DiacriticalAcute */
+	{ 0x2d9, 0x0 },  /* DiacriticalDot */
+	{ 0x2dd, 0x0 },  /* DiacriticalDoubleAcute */
+	{ 0x60, 0x0 },  /* DiacriticalGrave */
+	{ 0x2dc, 0x0 },  /* DiacriticalTilde */
+	{ 0x22c4, 0x0 },  /* Diamond */
+	{ 0x2146, 0x0 },  /* DifferentialD */
+	{ 0x1d53b, 0x0 },  /* Dopf */
+	{ 0xa8, 0x0 },  /* Dot */
+	{ 0x20dc, 0x0 },  /* DotDot */
+	{ 0x2250, 0x0 },  /* DotEqual */
+	{ 0x222f, 0x0 },  /* DoubleContourIntegral */
+	{ 0xa8, 0x0 },  /* DoubleDot */
+	{ 0x21d3, 0x0 },  /* DoubleDownArrow */
+	{ 0x21d0, 0x0 },  /* DoubleLeftArrow */
+	{ 0x21d4, 0x0 },  /* DoubleLeftRightArrow */
+	{ 0x2ae4, 0x0 },  /* DoubleLeftTee */
+	{ 0x27f8, 0x0 },  /* DoubleLongLeftArrow */
+	{ 0x27fa, 0x0 },  /* DoubleLongLeftRightArrow */
+	{ 0x27f9, 0x0 },  /* DoubleLongRightArrow */
+	{ 0x21d2, 0x0 },  /* DoubleRightArrow */
+	{ 0x22a8, 0x0 },  /* DoubleRightTee */
+	{ 0x21d1, 0x0 },  /* DoubleUpArrow */
+	{ 0x21d5, 0x0 },  /* DoubleUpDownArrow */
+	{ 0x2225, 0x0 },  /* DoubleVerticalBar */
+	{ 0x2193, 0x0 },  /* DownArrow */
+	{ 0x2913, 0x0 },  /* DownArrowBar */
+	{ 0x21f5, 0x0 },  /* DownArrowUpArrow */
+	{ 0x311, 0x0 },  /* DownBreve */
+	{ 0x2950, 0x0 },  /* DownLeftRightVector */
+	{ 0x295e, 0x0 },  /* DownLeftTeeVector */
+	{ 0x21bd, 0x0 },  /* DownLeftVector */
+	{ 0x2956, 0x0 },  /* DownLeftVectorBar */
+	{ 0x295f, 0x0 },  /* DownRightTeeVector */
+	{ 0x21c1, 0x0 },  /* DownRightVector */
+	{ 0x2957, 0x0 },  /* DownRightVectorBar */
+	{ 0x22a4, 0x0 },  /* DownTee */
+	{ 0x21a7, 0x0 },  /* DownTeeArrow */
+	{ 0x21d3, 0x0 },  /* Downarrow */
+	{ 0x1d49f, 0x0 },  /* Dscr */
+	{ 0x110, 0x0 },  /* Dstrok */
+	{ 0x14a, 0x0 },  /* ENG */
+	{ 0xd0, 0x0 },  /* ETH */
+	{ 0xc9, 0x0 },  /* Eacute */
+	{ 0x11a, 0x0 },  /* Ecaron */
+	{ 0xca, 0x0 },  /* Ecirc */
+	{ 0x42d, 0x0 },  /* Ecy */
+	{ 0x116, 0x0 },  /* Edot */
+	{ 0x1d508, 0x0 },  /* Efr */
+	{ 0xc8, 0x0 },  /* Egrave */
+	{ 0x2208, 0x0 },  /* Element */
+	{ 0x112, 0x0 },  /* Emacr */
+	{ 0x25fb, 0x0 },  /* EmptySmallSquare */
+	{ 0x25ab, 0x0 },  /* EmptyVerySmallSquare */
+	{ 0x118, 0x0 },  /* Eogon */
+	{ 0x1d53c, 0x0 },  /* Eopf */
+	{ 0x395, 0x0 },  /* Epsilon */
+	{ 0x2a75, 0x0 },  /* Equal */
+	{ 0x2242, 0x0 },  /* EqualTilde */
+	{ 0x21cc, 0x0 },  /* Equilibrium */
+	{ 0x2130, 0x0 },  /* Escr */
+	{ 0x2a73, 0x0 },  /* Esim */
+	{ 0x397, 0x0 },  /* Eta */
+	{ 0xcb, 0x0 },  /* Euml */
+	{ 0x2203, 0x0 },  /* Exists */
+	{ 0x2147, 0x0 },  /* ExponentialE */
+	{ 0x424, 0x0 },  /* Fcy */
+	{ 0x1d509, 0x0 },  /* Ffr */
+	{ 0x25fc, 0x0 },  /* FilledSmallSquare */
+	{ 0x25aa, 0x0 },  /* FilledVerySmallSquare */
+	{ 0x1d53d, 0x0 },  /* Fopf */
+	{ 0x2200, 0x0 },  /* ForAll */
+	{ 0x2131, 0x0 },  /* Fouriertrf */
+	{ 0x2131, 0x0 },  /* Fscr */
+	{ 0x403, 0x0 },  /* GJcy */
+	{ 0x3e, 0x0 },  /* GT */
+	{ 0x393, 0x0 },  /* Gamma */
+	{ 0x3dc, 0x0 },  /* Gammad */
+	{ 0x11e, 0x0 },  /* Gbreve */
+	{ 0x122, 0x0 },  /* Gcedil */
+	{ 0x11c, 0x0 },  /* Gcirc */
+	{ 0x413, 0x0 },  /* Gcy */
+	{ 0x120, 0x0 },  /* Gdot */
+	{ 0x1d50a, 0x0 },  /* Gfr */
+	{ 0x22d9, 0x0 },  /* Gg */
+	{ 0x1d53e, 0x0 },  /* Gopf */
+	{ 0x2265, 0x0 },  /* GreaterEqual */
+	{ 0x22db, 0x0 },  /* GreaterEqualLess */
+	{ 0x2267, 0x0 },  /* GreaterFullEqual */
+	{ 0x2aa2, 0x0 },  /* GreaterGreater */
+	{ 0x2277, 0x0 },  /* GreaterLess */
+	{ 0x2a7e, 0x0 },  /* GreaterSlantEqual */
+	{ 0x2273, 0x0 },  /* GreaterTilde */
+	{ 0x1d4a2, 0x0 },  /* Gscr */
+	{ 0x226b, 0x0 },  /* Gt */
+	{ 0x42a, 0x0 },  /* HARDcy */
+	{ 0x2c7, 0x0 },  /* Hacek */
+	{ 0x5e, 0x0 },  /* Hat */
+	{ 0x124, 0x0 },  /* Hcirc */
+	{ 0x210c, 0x0 },  /* Hfr */
+	{ 0x210b, 0x0 },  /* HilbertSpace */
+	{ 0x210d, 0x0 },  /* Hopf */
+	{ 0x2500, 0x0 },  /* HorizontalLine */
+	{ 0x210b, 0x0 },  /* Hscr */
+	{ 0x126, 0x0 },  /* Hstrok */
+	{ 0x224e, 0x0 },  /* HumpDownHump */
+	{ 0x224f, 0x0 },  /* HumpEqual */
+	{ 0x415, 0x0 },  /* IEcy */
+	{ 0x132, 0x0 },  /* IJlig */
+	{ 0x401, 0x0 },  /* IOcy */
+	{ 0xcd, 0x0 },  /* Iacute */
+	{ 0xce, 0x0 },  /* Icirc */
+	{ 0x418, 0x0 },  /* Icy */
+	{ 0x130, 0x0 },  /* Idot */
+	{ 0x2111, 0x0 },  /* Ifr */
+	{ 0xcc, 0x0 },  /* Igrave */
+	{ 0x2111, 0x0 },  /* Im */
+	{ 0x12a, 0x0 },  /* Imacr */
+	{ 0x2148, 0x0 },  /* ImaginaryI */
+	{ 0x21d2, 0x0 },  /* Implies */
+	{ 0x222c, 0x0 },  /* Int */
+	{ 0x222b, 0x0 },  /* Integral */
+	{ 0x22c2, 0x0 },  /* Intersection */
+	{ 0x2063, 0x0 },  /* InvisibleComma */
+	{ 0x2062, 0x0 },  /* InvisibleTimes */
+	{ 0x12e, 0x0 },  /* Iogon */
+	{ 0x1d540, 0x0 },  /* Iopf */
+	{ 0x399, 0x0 },  /* Iota */
+	{ 0x2110, 0x0 },  /* Iscr */
+	{ 0x128, 0x0 },  /* Itilde */
+	{ 0x406, 0x0 },  /* Iukcy */
+	{ 0xcf, 0x0 },  /* Iuml */
+	{ 0x134, 0x0 },  /* Jcirc */
+	{ 0x419, 0x0 },  /* Jcy */
+	{ 0x1d50d, 0x0 },  /* Jfr */
+	{ 0x1d541, 0x0 },  /* Jopf */
+	{ 0x1d4a5, 0x0 },  /* Jscr */
+	{ 0x408, 0x0 },  /* Jsercy */
+	{ 0x404, 0x0 },  /* Jukcy */
+	{ 0x425, 0x0 },  /* KHcy */
+	{ 0x40c, 0x0 },  /* KJcy */
+	{ 0x39a, 0x0 },  /* Kappa */
+	{ 0x136, 0x0 },  /* Kcedil */
+	{ 0x41a, 0x0 },  /* Kcy */
+	{ 0x1d50e, 0x0 },  /* Kfr */
+	{ 0x1d542, 0x0 },  /* Kopf */
+	{ 0x1d4a6, 0x0 },  /* Kscr */
+	{ 0x409, 0x0 },  /* LJcy */
+	{ 0x3c, 0x0 },  /* LT */
+	{ 0x139, 0x0 },  /* Lacute */
+	{ 0x39b, 0x0 },  /* Lambda */
+	{ 0x27ea, 0x0 },  /* Lang */
+	{ 0x2112, 0x0 },  /* Laplacetrf */
+	{ 0x219e, 0x0 },  /* Larr */
+	{ 0x13d, 0x0 },  /* Lcaron */
+	{ 0x13b, 0x0 },  /* Lcedil */
+	{ 0x41b, 0x0 },  /* Lcy */
+	{ 0x27e8, 0x0 },  /* LeftAngleBracket */
+	{ 0x2190, 0x0 },  /* LeftArrow */
+	{ 0x21e4, 0x0 },  /* LeftArrowBar */
+	{ 0x21c6, 0x0 },  /* LeftArrowRightArrow */
+	{ 0x2308, 0x0 },  /* LeftCeiling */
+	{ 0x27e6, 0x0 },  /* LeftDoubleBracket */
+	{ 0x2961, 0x0 },  /* LeftDownTeeVector */
+	{ 0x21c3, 0x0 },  /* LeftDownVector */
+	{ 0x2959, 0x0 },  /* LeftDownVectorBar */
+	{ 0x230a, 0x0 },  /* LeftFloor */
+	{ 0x2194, 0x0 },  /* LeftRightArrow */
+	{ 0x294e, 0x0 },  /* LeftRightVector */
+	{ 0x22a3, 0x0 },  /* LeftTee */
+	{ 0x21a4, 0x0 },  /* LeftTeeArrow */
+	{ 0x295a, 0x0 },  /* LeftTeeVector */
+	{ 0x22b2, 0x0 },  /* LeftTriangle */
+	{ 0x29cf, 0x0 },  /* LeftTriangleBar */
+	{ 0x22b4, 0x0 },  /* LeftTriangleEqual */
+	{ 0x2951, 0x0 },  /* LeftUpDownVector */
+	{ 0x2960, 0x0 },  /* LeftUpTeeVector */
+	{ 0x21bf, 0x0 },  /* LeftUpVector */
+	{ 0x2958, 0x0 },  /* LeftUpVectorBar */
+	{ 0x21bc, 0x0 },  /* LeftVector */
+	{ 0x2952, 0x0 },  /* LeftVectorBar */
+	{ 0x21d0, 0x0 },  /* Leftarrow */
+	{ 0x21d4, 0x0 },  /* Leftrightarrow */
+	{ 0x22da, 0x0 },  /* LessEqualGreater */
+	{ 0x2266, 0x0 },  /* LessFullEqual */
+	{ 0x2276, 0x0 },  /* LessGreater */
+	{ 0x2aa1, 0x0 },  /* LessLess */
+	{ 0x2a7d, 0x0 },  /* LessSlantEqual */
+	{ 0x2272, 0x0 },  /* LessTilde */
+	{ 0x1d50f, 0x0 },  /* Lfr */
+	{ 0x22d8, 0x0 },  /* Ll */
+	{ 0x21da, 0x0 },  /* Lleftarrow */
+	{ 0x13f, 0x0 },  /* Lmidot */
+	{ 0x27f5, 0x0 },  /* LongLeftArrow */
+	{ 0x27f7, 0x0 },  /* LongLeftRightArrow */
+	{ 0x27f6, 0x0 },  /* LongRightArrow */
+	{ 0x27f8, 0x0 },  /* Longleftarrow */
+	{ 0x27fa, 0x0 },  /* Longleftrightarrow */
+	{ 0x27f9, 0x0 },  /* Longrightarrow */
+	{ 0x1d543, 0x0 },  /* Lopf */
+	{ 0x2199, 0x0 },  /* LowerLeftArrow */
+	{ 0x2198, 0x0 },  /* LowerRightArrow */
+	{ 0x2112, 0x0 },  /* Lscr */
+	{ 0x21b0, 0x0 },  /* Lsh */
+	{ 0x141, 0x0 },  /* Lstrok */
+	{ 0x226a, 0x0 },  /* Lt */
+	{ 0x2905, 0x0 },  /* Map */
+	{ 0x41c, 0x0 },  /* Mcy */
+	{ 0x205f, 0x0 },  /* MediumSpace */
+	{ 0x2133, 0x0 },  /* Mellintrf */
+	{ 0x1d510, 0x0 },  /* Mfr */
+	{ 0x2213, 0x0 },  /* MinusPlus */
+	{ 0x1d544, 0x0 },  /* Mopf */
+	{ 0x2133, 0x0 },  /* Mscr */
+	{ 0x39c, 0x0 },  /* Mu */
+	{ 0x40a, 0x0 },  /* NJcy */
+	{ 0x143, 0x0 },  /* Nacute */
+	{ 0x147, 0x0 },  /* Ncaron */
+	{ 0x145, 0x0 },  /* Ncedil */
+	{ 0x41d, 0x0 },  /* Ncy */
+	{ 0x200b, 0x0 },  /* NegativeMediumSpace */
+	{ 0x200b, 0x0 },  /* NegativeThickSpace */
+	{ 0x200b, 0x0 },  /* NegativeThinSpace */
+	{ 0x200b, 0x0 },  /* NegativeVeryThinSpace */
+	{ 0x226b, 0x0 },  /* NestedGreaterGreater */
+	{ 0x226a, 0x0 },  /* NestedLessLess */
+	{ 0xa, 0x0 },  /* NewLine */
+	{ 0x1d511, 0x0 },  /* Nfr */
+	{ 0x2060, 0x0 },  /* NoBreak */
+	{ 0xa0, 0x0 },  /* NonBreakingSpace */
+	{ 0x2115, 0x0 },  /* Nopf */
+	{ 0x2aec, 0x0 },  /* Not */
+	{ 0x2262, 0x0 },  /* NotCongruent */
+	{ 0x226d, 0x0 },  /* NotCupCap */
+	{ 0x2226, 0x0 },  /* NotDoubleVerticalBar */
+	{ 0x2209, 0x0 },  /* NotElement */
+	{ 0x2260, 0x0 },  /* NotEqual */
+	{ 0x2242, 0x338 },  /* NotEqualTilde */
+	{ 0x2204, 0x0 },  /* NotExists */
+	{ 0x226f, 0x0 },  /* NotGreater */
+	{ 0x2271, 0x0 },  /* NotGreaterEqual */
+	{ 0x2267, 0x338 },  /* NotGreaterFullEqual */
+	{ 0x226b, 0x338 },  /* NotGreaterGreater */
+	{ 0x2279, 0x0 },  /* NotGreaterLess */
+	{ 0x2a7e, 0x338 },  /* NotGreaterSlantEqual */
+	{ 0x2275, 0x0 },  /* NotGreaterTilde */
+	{ 0x224e, 0x338 },  /* NotHumpDownHump */
+	{ 0x224f, 0x338 },  /* NotHumpEqual */
+	{ 0x22ea, 0x0 },  /* NotLeftTriangle */
+	{ 0x29cf, 0x338 },  /* NotLeftTriangleBar */
+	{ 0x22ec, 0x0 },  /* NotLeftTriangleEqual */
+	{ 0x226e, 0x0 },  /* NotLess */
+	{ 0x2270, 0x0 },  /* NotLessEqual */
+	{ 0x2278, 0x0 },  /* NotLessGreater */
+	{ 0x226a, 0x338 },  /* NotLessLess */
+	{ 0x2a7d, 0x338 },  /* NotLessSlantEqual */
+	{ 0x2274, 0x0 },  /* NotLessTilde */
+	{ 0x2aa2, 0x338 },  /* NotNestedGreaterGreater */
+	{ 0x2aa1, 0x338 },  /* NotNestedLessLess */
+	{ 0x2280, 0x0 },  /* NotPrecedes */
+	{ 0x2aaf, 0x338 },  /* NotPrecedesEqual */
+	{ 0x22e0, 0x0 },  /* NotPrecedesSlantEqual */
+	{ 0x220c, 0x0 },  /* NotReverseElement */
+	{ 0x22eb, 0x0 },  /* NotRightTriangle */
+	{ 0x29d0, 0x338 },  /* NotRightTriangleBar */
+	{ 0x22ed, 0x0 },  /* NotRightTriangleEqual */
+	{ 0x228f, 0x338 },  /* NotSquareSubset */
+	{ 0x22e2, 0x0 },  /* NotSquareSubsetEqual */
+	{ 0x2290, 0x338 },  /* NotSquareSuperset */
+	{ 0x22e3, 0x0 },  /* NotSquareSupersetEqual */
+	{ 0x2282, 0x20d2 },  /* NotSubset */
+	{ 0x2288, 0x0 },  /* NotSubsetEqual */
+	{ 0x2281, 0x0 },  /* NotSucceeds */
+	{ 0x2ab0, 0x338 },  /* NotSucceedsEqual */
+	{ 0x22e1, 0x0 },  /* NotSucceedsSlantEqual */
+	{ 0x227f, 0x338 },  /* NotSucceedsTilde */
+	{ 0x2283, 0x20d2 },  /* NotSuperset */
+	{ 0x2289, 0x0 },  /* NotSupersetEqual */
+	{ 0x2241, 0x0 },  /* NotTilde */
+	{ 0x2244, 0x0 },  /* NotTildeEqual */
+	{ 0x2247, 0x0 },  /* NotTildeFullEqual */
+	{ 0x2249, 0x0 },  /* NotTildeTilde */
+	{ 0x2224, 0x0 },  /* NotVerticalBar */
+	{ 0x1d4a9, 0x0 },  /* Nscr */
+	{ 0xd1, 0x0 },  /* Ntilde */
+	{ 0x39d, 0x0 },  /* Nu */
+	{ 0x152, 0x0 },  /* OElig */
+	{ 0xd3, 0x0 },  /* Oacute */
+	{ 0xd4, 0x0 },  /* Ocirc */
+	{ 0x41e, 0x0 },  /* Ocy */
+	{ 0x150, 0x0 },  /* Odblac */
+	{ 0x1d512, 0x0 },  /* Ofr */
+	{ 0xd2, 0x0 },  /* Ograve */
+	{ 0x14c, 0x0 },  /* Omacr */
+	{ 0x3a9, 0x0 },  /* Omega */
+	{ 0x39f, 0x0 },  /* Omicron */
+	{ 0x1d546, 0x0 },  /* Oopf */
+	{ 0x201c, 0x0 },  /* OpenCurlyDoubleQuote */
+	{ 0x2018, 0x0 },  /* OpenCurlyQuote */
+	{ 0x2a54, 0x0 },  /* Or */
+	{ 0x1d4aa, 0x0 },  /* Oscr */
+	{ 0xd8, 0x0 },  /* Oslash */
+	{ 0xd5, 0x0 },  /* Otilde */
+	{ 0x2a37, 0x0 },  /* Otimes */
+	{ 0xd6, 0x0 },  /* Ouml */
+	{ 0x203e, 0x0 },  /* OverBar */
+	{ 0x23de, 0x0 },  /* OverBrace */
+	{ 0x23b4, 0x0 },  /* OverBracket */
+	{ 0x23dc, 0x0 },  /* OverParenthesis */
+	{ 0x2202, 0x0 },  /* PartialD */
+	{ 0x41f, 0x0 },  /* Pcy */
+	{ 0x1d513, 0x0 },  /* Pfr */
+	{ 0x3a6, 0x0 },  /* Phi */
+	{ 0x3a0, 0x0 },  /* Pi */
+	{ 0xb1, 0x0 },  /* PlusMinus */
+	{ 0x210c, 0x0 },  /* Poincareplane */
+	{ 0x2119, 0x0 },  /* Popf */
+	{ 0x2abb, 0x0 },  /* Pr */
+	{ 0x227a, 0x0 },  /* Precedes */
+	{ 0x2aaf, 0x0 },  /* PrecedesEqual */
+	{ 0x227c, 0x0 },  /* PrecedesSlantEqual */
+	{ 0x227e, 0x0 },  /* PrecedesTilde */
+	{ 0x2033, 0x0 },  /* Prime */
+	{ 0x220f, 0x0 },  /* Product */
+	{ 0x2237, 0x0 },  /* Proportion */
+	{ 0x221d, 0x0 },  /* Proportional */
+	{ 0x1d4ab, 0x0 },  /* Pscr */
+	{ 0x3a8, 0x0 },  /* Psi */
+	{ 0x22, 0x0 },  /* QUOT */
+	{ 0x1d514, 0x0 },  /* Qfr */
+	{ 0x211a, 0x0 },  /* Qopf */
+	{ 0x1d4ac, 0x0 },  /* Qscr */
+	{ 0x2910, 0x0 },  /* RBarr */
+	{ 0xae, 0x0 },  /* REG */
+	{ 0x154, 0x0 },  /* Racute */
+	{ 0x27eb, 0x0 },  /* Rang */
+	{ 0x21a0, 0x0 },  /* Rarr */
+	{ 0x2916, 0x0 },  /* Rarrtl */
+	{ 0x158, 0x0 },  /* Rcaron */
+	{ 0x156, 0x0 },  /* Rcedil */
+	{ 0x420, 0x0 },  /* Rcy */
+	{ 0x211c, 0x0 },  /* Re */
+	{ 0x220b, 0x0 },  /* ReverseElement */
+	{ 0x21cb, 0x0 },  /* ReverseEquilibrium */
+	{ 0x296f, 0x0 },  /* ReverseUpEquilibrium */
+	{ 0x211c, 0x0 },  /* Rfr */
+	{ 0x3a1, 0x0 },  /* Rho */
+	{ 0x27e9, 0x0 },  /* RightAngleBracket */
+	{ 0x2192, 0x0 },  /* RightArrow */
+	{ 0x21e5, 0x0 },  /* RightArrowBar */
+	{ 0x21c4, 0x0 },  /* RightArrowLeftArrow */
+	{ 0x2309, 0x0 },  /* RightCeiling */
+	{ 0x27e7, 0x0 },  /* RightDoubleBracket */
+	{ 0x295d, 0x0 },  /* RightDownTeeVector */
+	{ 0x21c2, 0x0 },  /* RightDownVector */
+	{ 0x2955, 0x0 },  /* RightDownVectorBar */
+	{ 0x230b, 0x0 },  /* RightFloor */
+	{ 0x22a2, 0x0 },  /* RightTee */
+	{ 0x21a6, 0x0 },  /* RightTeeArrow */
+	{ 0x295b, 0x0 },  /* RightTeeVector */
+	{ 0x22b3, 0x0 },  /* RightTriangle */
+	{ 0x29d0, 0x0 },  /* RightTriangleBar */
+	{ 0x22b5, 0x0 },  /* RightTriangleEqual */
+	{ 0x294f, 0x0 },  /* RightUpDownVector */
+	{ 0x295c, 0x0 },  /* RightUpTeeVector */
+	{ 0x21be, 0x0 },  /* RightUpVector */
+	{ 0x2954, 0x0 },  /* RightUpVectorBar */
+	{ 0x21c0, 0x0 },  /* RightVector */
+	{ 0x2953, 0x0 },  /* RightVectorBar */
+	{ 0x21d2, 0x0 },  /* Rightarrow */
+	{ 0x211d, 0x0 },  /* Ropf */
+	{ 0x2970, 0x0 },  /* RoundImplies */
+	{ 0x21db, 0x0 },  /* Rrightarrow */
+	{ 0x211b, 0x0 },  /* Rscr */
+	{ 0x21b1, 0x0 },  /* Rsh */
+	{ 0x29f4, 0x0 },  /* RuleDelayed */
+	{ 0x429, 0x0 },  /* SHCHcy */
+	{ 0x428, 0x0 },  /* SHcy */
+	{ 0x42c, 0x0 },  /* SOFTcy */
+	{ 0x15a, 0x0 },  /* Sacute */
+	{ 0x2abc, 0x0 },  /* Sc */
+	{ 0x160, 0x0 },  /* Scaron */
+	{ 0x15e, 0x0 },  /* Scedil */
+	{ 0x15c, 0x0 },  /* Scirc */
+	{ 0x421, 0x0 },  /* Scy */
+	{ 0x1d516, 0x0 },  /* Sfr */
+	{ 0x2193, 0x0 },  /* ShortDownArrow */
+	{ 0x2190, 0x0 },  /* ShortLeftArrow */
+	{ 0x2192, 0x0 },  /* ShortRightArrow */
+	{ 0x2191, 0x0 },  /* ShortUpArrow */
+	{ 0x3a3, 0x0 },  /* Sigma */
+	{ 0x2218, 0x0 },  /* SmallCircle */
+	{ 0x1d54a, 0x0 },  /* Sopf */
+	{ 0x221a, 0x0 },  /* Sqrt */
+	{ 0x25a1, 0x0 },  /* Square */
+	{ 0x2293, 0x0 },  /* SquareIntersection */
+	{ 0x228f, 0x0 },  /* SquareSubset */
+	{ 0x2291, 0x0 },  /* SquareSubsetEqual */
+	{ 0x2290, 0x0 },  /* SquareSuperset */
+	{ 0x2292, 0x0 },  /* SquareSupersetEqual */
+	{ 0x2294, 0x0 },  /* SquareUnion */
+	{ 0x1d4ae, 0x0 },  /* Sscr */
+	{ 0x22c6, 0x0 },  /* Star */
+	{ 0x22d0, 0x0 },  /* Sub */
+	{ 0x22d0, 0x0 },  /* Subset */
+	{ 0x2286, 0x0 },  /* SubsetEqual */
+	{ 0x227b, 0x0 },  /* Succeeds */
+	{ 0x2ab0, 0x0 },  /* SucceedsEqual */
+	{ 0x227d, 0x0 },  /* SucceedsSlantEqual */
+	{ 0x227f, 0x0 },  /* SucceedsTilde */
+	{ 0x220b, 0x0 },  /* SuchThat */
+	{ 0x2211, 0x0 },  /* Sum */
+	{ 0x22d1, 0x0 },  /* Sup */
+	{ 0x2283, 0x0 },  /* Superset */
+	{ 0x2287, 0x0 },  /* SupersetEqual */
+	{ 0x22d1, 0x0 },  /* Supset */
+	{ 0xde, 0x0 },  /* THORN */
+	{ 0x2122, 0x0 },  /* TRADE */
+	{ 0x40b, 0x0 },  /* TSHcy */
+	{ 0x426, 0x0 },  /* TScy */
+	{ 0x9, 0x0 },  /* Tab */
+	{ 0x3a4, 0x0 },  /* Tau */
+	{ 0x164, 0x0 },  /* Tcaron */
+	{ 0x162, 0x0 },  /* Tcedil */
+	{ 0x422, 0x0 },  /* Tcy */
+	{ 0x1d517, 0x0 },  /* Tfr */
+	{ 0x2234, 0x0 },  /* Therefore */
+	{ 0x398, 0x0 },  /* Theta */
+	{ 0x205f, 0x200a },  /* ThickSpace */
+	{ 0x2009, 0x0 },  /* ThinSpace */
+	{ 0x223c, 0x0 },  /* Tilde */
+	{ 0x2243, 0x0 },  /* TildeEqual */
+	{ 0x2245, 0x0 },  /* TildeFullEqual */
+	{ 0x2248, 0x0 },  /* TildeTilde */
+	{ 0x1d54b, 0x0 },  /* Topf */
+	{ 0x20db, 0x0 },  /* TripleDot */
+	{ 0x1d4af, 0x0 },  /* Tscr */
+	{ 0x166, 0x0 },  /* Tstrok */
+	{ 0xda, 0x0 },  /* Uacute */
+	{ 0x219f, 0x0 },  /* Uarr */
+	{ 0x2949, 0x0 },  /* Uarrocir */
+	{ 0x40e, 0x0 },  /* Ubrcy */
+	{ 0x16c, 0x0 },  /* Ubreve */
+	{ 0xdb, 0x0 },  /* Ucirc */
+	{ 0x423, 0x0 },  /* Ucy */
+	{ 0x170, 0x0 },  /* Udblac */
+	{ 0x1d518, 0x0 },  /* Ufr */
+	{ 0xd9, 0x0 },  /* Ugrave */
+	{ 0x16a, 0x0 },  /* Umacr */
+	{ 0x5f, 0x0 },  /* UnderBar */
+	{ 0x23df, 0x0 },  /* UnderBrace */
+	{ 0x23b5, 0x0 },  /* UnderBracket */
+	{ 0x23dd, 0x0 },  /* UnderParenthesis */
+	{ 0x22c3, 0x0 },  /* Union */
+	{ 0x228e, 0x0 },  /* UnionPlus */
+	{ 0x172, 0x0 },  /* Uogon */
+	{ 0x1d54c, 0x0 },  /* Uopf */
+	{ 0x2191, 0x0 },  /* UpArrow */
+	{ 0x2912, 0x0 },  /* UpArrowBar */
+	{ 0x21c5, 0x0 },  /* UpArrowDownArrow */
+	{ 0x2195, 0x0 },  /* UpDownArrow */
+	{ 0x296e, 0x0 },  /* UpEquilibrium */
+	{ 0x22a5, 0x0 },  /* UpTee */
+	{ 0x21a5, 0x0 },  /* UpTeeArrow */
+	{ 0x21d1, 0x0 },  /* Uparrow */
+	{ 0x21d5, 0x0 },  /* Updownarrow */
+	{ 0x2196, 0x0 },  /* UpperLeftArrow */
+	{ 0x2197, 0x0 },  /* UpperRightArrow */
+	{ 0x3d2, 0x0 },  /* Upsi */
+	{ 0x3a5, 0x0 },  /* Upsilon */
+	{ 0x16e, 0x0 },  /* Uring */
+	{ 0x1d4b0, 0x0 },  /* Uscr */
+	{ 0x168, 0x0 },  /* Utilde */
+	{ 0xdc, 0x0 },  /* Uuml */
+	{ 0x22ab, 0x0 },  /* VDash */
+	{ 0x2aeb, 0x0 },  /* Vbar */
+	{ 0x412, 0x0 },  /* Vcy */
+	{ 0x22a9, 0x0 },  /* Vdash */
+	{ 0x2ae6, 0x0 },  /* Vdashl */
+	{ 0x22c1, 0x0 },  /* Vee */
+	{ 0x2016, 0x0 },  /* Verbar */
+	{ 0x2016, 0x0 },  /* Vert */
+	{ 0x2223, 0x0 },  /* VerticalBar */
+	{ 0x7c, 0x0 },  /* VerticalLine */
+	{ 0x2758, 0x0 },  /* VerticalSeparator */
+	{ 0x2240, 0x0 },  /* VerticalTilde */
+	{ 0x200a, 0x0 },  /* VeryThinSpace */
+	{ 0x1d519, 0x0 },  /* Vfr */
+	{ 0x1d54d, 0x0 },  /* Vopf */
+	{ 0x1d4b1, 0x0 },  /* Vscr */
+	{ 0x22aa, 0x0 },  /* Vvdash */
+	{ 0x174, 0x0 },  /* Wcirc */
+	{ 0x22c0, 0x0 },  /* Wedge */
+	{ 0x1d51a, 0x0 },  /* Wfr */
+	{ 0x1d54e, 0x0 },  /* Wopf */
+	{ 0x1d4b2, 0x0 },  /* Wscr */
+	{ 0x1d51b, 0x0 },  /* Xfr */
+	{ 0x39e, 0x0 },  /* Xi */
+	{ 0x1d54f, 0x0 },  /* Xopf */
+	{ 0x1d4b3, 0x0 },  /* Xscr */
+	{ 0x42f, 0x0 },  /* YAcy */
+	{ 0x407, 0x0 },  /* YIcy */
+	{ 0x42e, 0x0 },  /* YUcy */
+	{ 0xdd, 0x0 },  /* Yacute */
+	{ 0x176, 0x0 },  /* Ycirc */
+	{ 0x42b, 0x0 },  /* Ycy */
+	{ 0x1d51c, 0x0 },  /* Yfr */
+	{ 0x1d550, 0x0 },  /* Yopf */
+	{ 0x1d4b4, 0x0 },  /* Yscr */
+	{ 0x178, 0x0 },  /* Yuml */
+	{ 0x416, 0x0 },  /* ZHcy */
+	{ 0x179, 0x0 },  /* Zacute */
+	{ 0x17d, 0x0 },  /* Zcaron */
+	{ 0x417, 0x0 },  /* Zcy */
+	{ 0x17b, 0x0 },  /* Zdot */
+	{ 0x200b, 0x0 },  /* ZeroWidthSpace */
+	{ 0x396, 0x0 },  /* Zeta */
+	{ 0x2128, 0x0 },  /* Zfr */
+	{ 0x2124, 0x0 },  /* Zopf */
+	{ 0x1d4b5, 0x0 },  /* Zscr */
+	{ 0xe1, 0x0 },  /* aacute */
+	{ 0x103, 0x0 },  /* abreve */
+	{ 0x223e, 0x0 },  /* ac */
+	{ 0x223e, 0x333 },  /* acE */
+	{ 0x223f, 0x0 },  /* acd */
+	{ 0xe2, 0x0 },  /* acirc */
+	{ 0xb4, 0x0 },  /* acute */
+	{ 0x430, 0x0 },  /* acy */
+	{ 0xe6, 0x0 },  /* aelig */
+	{ 0x2061, 0x0 },  /* af */
+	{ 0x1d51e, 0x0 },  /* afr */
+	{ 0xe0, 0x0 },  /* agrave */
+	{ 0x2135, 0x0 },  /* alefsym */
+	{ 0x2135, 0x0 },  /* aleph */
+	{ 0x3b1, 0x0 },  /* alpha */
+	{ 0x101, 0x0 },  /* amacr */
+	{ 0x2a3f, 0x0 },  /* amalg */
+	{ 0x26, 0x0 },  /* amp */
+	{ 0x2227, 0x0 },  /* and */
+	{ 0x2a55, 0x0 },  /* andand */
+	{ 0x2a5c, 0x0 },  /* andd */
+	{ 0x2a58, 0x0 },  /* andslope */
+	{ 0x2a5a, 0x0 },  /* andv */
+	{ 0x2220, 0x0 },  /* ang */
+	{ 0x29a4, 0x0 },  /* ange */
+	{ 0x2220, 0x0 },  /* angle */
+	{ 0x2221, 0x0 },  /* angmsd */
+	{ 0x29a8, 0x0 },  /* angmsdaa */
+	{ 0x29a9, 0x0 },  /* angmsdab */
+	{ 0x29aa, 0x0 },  /* angmsdac */
+	{ 0x29ab, 0x0 },  /* angmsdad */
+	{ 0x29ac, 0x0 },  /* angmsdae */
+	{ 0x29ad, 0x0 },  /* angmsdaf */
+	{ 0x29ae, 0x0 },  /* angmsdag */
+	{ 0x29af, 0x0 },  /* angmsdah */
+	{ 0x221f, 0x0 },  /* angrt */
+	{ 0x22be, 0x0 },  /* angrtvb */
+	{ 0x299d, 0x0 },  /* angrtvbd */
+	{ 0x2222, 0x0 },  /* angsph */
+	{ 0xc5, 0x0 },  /* angst */
+	{ 0x237c, 0x0 },  /* angzarr */
+	{ 0x105, 0x0 },  /* aogon */
+	{ 0x1d552, 0x0 },  /* aopf */
+	{ 0x2248, 0x0 },  /* ap */
+	{ 0x2a70, 0x0 },  /* apE */
+	{ 0x2a6f, 0x0 },  /* apacir */
+	{ 0x224a, 0x0 },  /* ape */
+	{ 0x224b, 0x0 },  /* apid */
+	{ 0x27, 0x0 },  /* apos */
+	{ 0x2248, 0x0 },  /* approx */
+	{ 0x224a, 0x0 },  /* approxeq */
+	{ 0xe5, 0x0 },  /* aring */
+	{ 0x1d4b6, 0x0 },  /* ascr */
+	{ 0x2a, 0x0 },  /* ast */
+	{ 0x2248, 0x0 },  /* asymp */
+	{ 0x224d, 0x0 },  /* asympeq */
+	{ 0xe3, 0x0 },  /* atilde */
+	{ 0xe4, 0x0 },  /* auml */
+	{ 0x2233, 0x0 },  /* awconint */
+	{ 0x2a11, 0x0 },  /* awint */
+	{ 0x2aed, 0x0 },  /* bNot */
+	{ 0x224c, 0x0 },  /* backcong */
+	{ 0x3f6, 0x0 },  /* backepsilon */
+	{ 0x2035, 0x0 },  /* backprime */
+	{ 0x223d, 0x0 },  /* backsim */
+	{ 0x22cd, 0x0 },  /* backsimeq */
+	{ 0x22bd, 0x0 },  /* barvee */
+	{ 0x2305, 0x0 },  /* barwed */
+	{ 0x2305, 0x0 },  /* barwedge */
+	{ 0x23b5, 0x0 },  /* bbrk */
+	{ 0x23b6, 0x0 },  /* bbrktbrk */
+	{ 0x224c, 0x0 },  /* bcong */
+	{ 0x431, 0x0 },  /* bcy */
+	{ 0x201e, 0x0 },  /* bdquo */
+	{ 0x2235, 0x0 },  /* becaus */
+	{ 0x2235, 0x0 },  /* because */
+	{ 0x29b0, 0x0 },  /* bemptyv */
+	{ 0x3f6, 0x0 },  /* bepsi */
+	{ 0x212c, 0x0 },  /* bernou */
+	{ 0x3b2, 0x0 },  /* beta */
+	{ 0x2136, 0x0 },  /* beth */
+	{ 0x226c, 0x0 },  /* between */
+	{ 0x1d51f, 0x0 },  /* bfr */
+	{ 0x22c2, 0x0 },  /* bigcap */
+	{ 0x25ef, 0x0 },  /* bigcirc */
+	{ 0x22c3, 0x0 },  /* bigcup */
+	{ 0x2a00, 0x0 },  /* bigodot */
+	{ 0x2a01, 0x0 },  /* bigoplus */
+	{ 0x2a02, 0x0 },  /* bigotimes */
+	{ 0x2a06, 0x0 },  /* bigsqcup */
+	{ 0x2605, 0x0 },  /* bigstar */
+	{ 0x25bd, 0x0 },  /* bigtriangledown */
+	{ 0x25b3, 0x0 },  /* bigtriangleup */
+	{ 0x2a04, 0x0 },  /* biguplus */
+	{ 0x22c1, 0x0 },  /* bigvee */
+	{ 0x22c0, 0x0 },  /* bigwedge */
+	{ 0x290d, 0x0 },  /* bkarow */
+	{ 0x29eb, 0x0 },  /* blacklozenge */
+	{ 0x25aa, 0x0 },  /* blacksquare */
+	{ 0x25b4, 0x0 },  /* blacktriangle */
+	{ 0x25be, 0x0 },  /* blacktriangledown */
+	{ 0x25c2, 0x0 },  /* blacktriangleleft */
+	{ 0x25b8, 0x0 },  /* blacktriangleright */
+	{ 0x2423, 0x0 },  /* blank */
+	{ 0x2592, 0x0 },  /* blk12 */
+	{ 0x2591, 0x0 },  /* blk14 */
+	{ 0x2593, 0x0 },  /* blk34 */
+	{ 0x2588, 0x0 },  /* block */
+	{ 0x3d, 0x20e5 },  /* bne */
+	{ 0x2261, 0x20e5 },  /* bnequiv */
+	{ 0x2310, 0x0 },  /* bnot */
+	{ 0x1d553, 0x0 },  /* bopf */
+	{ 0x22a5, 0x0 },  /* bot */
+	{ 0x22a5, 0x0 },  /* bottom */
+	{ 0x22c8, 0x0 },  /* bowtie */
+	{ 0x2557, 0x0 },  /* boxDL */
+	{ 0x2554, 0x0 },  /* boxDR */
+	{ 0x2556, 0x0 },  /* boxDl */
+	{ 0x2553, 0x0 },  /* boxDr */
+	{ 0x2550, 0x0 },  /* boxH */
+	{ 0x2566, 0x0 },  /* boxHD */
+	{ 0x2569, 0x0 },  /* boxHU */
+	{ 0x2564, 0x0 },  /* boxHd */
+	{ 0x2567, 0x0 },  /* boxHu */
+	{ 0x255d, 0x0 },  /* boxUL */
+	{ 0x255a, 0x0 },  /* boxUR */
+	{ 0x255c, 0x0 },  /* boxUl */
+	{ 0x2559, 0x0 },  /* boxUr */
+	{ 0x2551, 0x0 },  /* boxV */
+	{ 0x256c, 0x0 },  /* boxVH */
+	{ 0x2563, 0x0 },  /* boxVL */
+	{ 0x2560, 0x0 },  /* boxVR */
+	{ 0x256b, 0x0 },  /* boxVh */
+	{ 0x2562, 0x0 },  /* boxVl */
+	{ 0x255f, 0x0 },  /* boxVr */
+	{ 0x29c9, 0x0 },  /* boxbox */
+	{ 0x2555, 0x0 },  /* boxdL */
+	{ 0x2552, 0x0 },  /* boxdR */
+	{ 0x2510, 0x0 },  /* boxdl */
+	{ 0x250c, 0x0 },  /* boxdr */
+	{ 0x2500, 0x0 },  /* boxh */
+	{ 0x2565, 0x0 },  /* boxhD */
+	{ 0x2568, 0x0 },  /* boxhU */
+	{ 0x252c, 0x0 },  /* boxhd */
+	{ 0x2534, 0x0 },  /* boxhu */
+	{ 0x229f, 0x0 },  /* boxminus */
+	{ 0x229e, 0x0 },  /* boxplus */
+	{ 0x22a0, 0x0 },  /* boxtimes */
+	{ 0x255b, 0x0 },  /* boxuL */
+	{ 0x2558, 0x0 },  /* boxuR */
+	{ 0x2518, 0x0 },  /* boxul */
+	{ 0x2514, 0x0 },  /* boxur */
+	{ 0x2502, 0x0 },  /* boxv */
+	{ 0x256a, 0x0 },  /* boxvH */
+	{ 0x2561, 0x0 },  /* boxvL */
+	{ 0x255e, 0x0 },  /* boxvR */
+	{ 0x253c, 0x0 },  /* boxvh */
+	{ 0x2524, 0x0 },  /* boxvl */
+	{ 0x251c, 0x0 },  /* boxvr */
+	{ 0x2035, 0x0 },  /* bprime */
+	{ 0x2d8, 0x0 },  /* breve */
+	{ 0xa6, 0x0 },  /* brvbar */
+	{ 0x1d4b7, 0x0 },  /* bscr */
+	{ 0x204f, 0x0 },  /* bsemi */
+	{ 0x223d, 0x0 },  /* bsim */
+	{ 0x22cd, 0x0 },  /* bsime */
+	{ 0x5c, 0x0 },  /* bsol */
+	{ 0x29c5, 0x0 },  /* bsolb */
+	{ 0x27c8, 0x0 },  /* bsolhsub */
+	{ 0x2022, 0x0 },  /* bull */
+	{ 0x2022, 0x0 },  /* bullet */
+	{ 0x224e, 0x0 },  /* bump */
+	{ 0x2aae, 0x0 },  /* bumpE */
+	{ 0x224f, 0x0 },  /* bumpe */
+	{ 0x224f, 0x0 },  /* bumpeq */
+	{ 0x107, 0x0 },  /* cacute */
+	{ 0x2229, 0x0 },  /* cap */
+	{ 0x2a44, 0x0 },  /* capand */
+	{ 0x2a49, 0x0 },  /* capbrcup */
+	{ 0x2a4b, 0x0 },  /* capcap */
+	{ 0x2a47, 0x0 },  /* capcup */
+	{ 0x2a40, 0x0 },  /* capdot */
+	{ 0x2229, 0xfe00 },  /* caps */
+	{ 0x2041, 0x0 },  /* caret */
+	{ 0x2c7, 0x0 },  /* caron */
+	{ 0x2a4d, 0x0 },  /* ccaps */
+	{ 0x10d, 0x0 },  /* ccaron */
+	{ 0xe7, 0x0 },  /* ccedil */
+	{ 0x109, 0x0 },  /* ccirc */
+	{ 0x2a4c, 0x0 },  /* ccups */
+	{ 0x2a50, 0x0 },  /* ccupssm */
+	{ 0x10b, 0x0 },  /* cdot */
+	{ 0xb8, 0x0 },  /* cedil */
+	{ 0x29b2, 0x0 },  /* cemptyv */
+	{ 0xa2, 0x0 },  /* cent */
+	{ 0xb7, 0x0 },  /* centerdot */
+	{ 0x1d520, 0x0 },  /* cfr */
+	{ 0x447, 0x0 },  /* chcy */
+	{ 0x2713, 0x0 },  /* check */
+	{ 0x2713, 0x0 },  /* checkmark */
+	{ 0x3c7, 0x0 },  /* chi */
+	{ 0x25cb, 0x0 },  /* cir */
+	{ 0x29c3, 0x0 },  /* cirE */
+	{ 0x2c6, 0x0 },  /* circ */
+	{ 0x2257, 0x0 },  /* circeq */
+	{ 0x21ba, 0x0 },  /* circlearrowleft */
+	{ 0x21bb, 0x0 },  /* circlearrowright */
+	{ 0xae, 0x0 },  /* circledR */
+	{ 0x24c8, 0x0 },  /* circledS */
+	{ 0x229b, 0x0 },  /* circledast */
+	{ 0x229a, 0x0 },  /* circledcirc */
+	{ 0x229d, 0x0 },  /* circleddash */
+	{ 0x2257, 0x0 },  /* cire */
+	{ 0x2a10, 0x0 },  /* cirfnint */
+	{ 0x2aef, 0x0 },  /* cirmid */
+	{ 0x29c2, 0x0 },  /* cirscir */
+	{ 0x2663, 0x0 },  /* clubs */
+	{ 0x2663, 0x0 },  /* clubsuit */
+	{ 0x3a, 0x0 },  /* colon */
+	{ 0x2254, 0x0 },  /* colone */
+	{ 0x2254, 0x0 },  /* coloneq */
+	{ 0x2c, 0x0 },  /* comma */
+	{ 0x40, 0x0 },  /* commat */
+	{ 0x2201, 0x0 },  /* comp */
+	{ 0x2218, 0x0 },  /* compfn */
+	{ 0x2201, 0x0 },  /* complement */
+	{ 0x2102, 0x0 },  /* complexes */
+	{ 0x2245, 0x0 },  /* cong */
+	{ 0x2a6d, 0x0 },  /* congdot */
+	{ 0x222e, 0x0 },  /* conint */
+	{ 0x1d554, 0x0 },  /* copf */
+	{ 0x2210, 0x0 },  /* coprod */
+	{ 0xa9, 0x0 },  /* copy */
+	{ 0x2117, 0x0 },  /* copysr */
+	{ 0x21b5, 0x0 },  /* crarr */
+	{ 0x2717, 0x0 },  /* cross */
+	{ 0x1d4b8, 0x0 },  /* cscr */
+	{ 0x2acf, 0x0 },  /* csub */
+	{ 0x2ad1, 0x0 },  /* csube */
+	{ 0x2ad0, 0x0 },  /* csup */
+	{ 0x2ad2, 0x0 },  /* csupe */
+	{ 0x22ef, 0x0 },  /* ctdot */
+	{ 0x2938, 0x0 },  /* cudarrl */
+	{ 0x2935, 0x0 },  /* cudarrr */
+	{ 0x22de, 0x0 },  /* cuepr */
+	{ 0x22df, 0x0 },  /* cuesc */
+	{ 0x21b6, 0x0 },  /* cularr */
+	{ 0x293d, 0x0 },  /* cularrp */
+	{ 0x222a, 0x0 },  /* cup */
+	{ 0x2a48, 0x0 },  /* cupbrcap */
+	{ 0x2a46, 0x0 },  /* cupcap */
+	{ 0x2a4a, 0x0 },  /* cupcup */
+	{ 0x228d, 0x0 },  /* cupdot */
+	{ 0x2a45, 0x0 },  /* cupor */
+	{ 0x222a, 0xfe00 },  /* cups */
+	{ 0x21b7, 0x0 },  /* curarr */
+	{ 0x293c, 0x0 },  /* curarrm */
+	{ 0x22de, 0x0 },  /* curlyeqprec */
+	{ 0x22df, 0x0 },  /* curlyeqsucc */
+	{ 0x22ce, 0x0 },  /* curlyvee */
+	{ 0x22cf, 0x0 },  /* curlywedge */
+	{ 0xa4, 0x0 },  /* curren */
+	{ 0x21b6, 0x0 },  /* curvearrowleft */
+	{ 0x21b7, 0x0 },  /* curvearrowright */
+	{ 0x22ce, 0x0 },  /* cuvee */
+	{ 0x22cf, 0x0 },  /* cuwed */
+	{ 0x2232, 0x0 },  /* cwconint */
+	{ 0x2231, 0x0 },  /* cwint */
+	{ 0x232d, 0x0 },  /* cylcty */
+	{ 0x21d3, 0x0 },  /* dArr */
+	{ 0x2965, 0x0 },  /* dHar */
+	{ 0x2020, 0x0 },  /* dagger */
+	{ 0x2138, 0x0 },  /* daleth */
+	{ 0x2193, 0x0 },  /* darr */
+	{ 0x2010, 0x0 },  /* dash */
+	{ 0x22a3, 0x0 },  /* dashv */
+	{ 0x290f, 0x0 },  /* dbkarow */
+	{ 0x2dd, 0x0 },  /* dblac */
+	{ 0x10f, 0x0 },  /* dcaron */
+	{ 0x434, 0x0 },  /* dcy */
+	{ 0x2146, 0x0 },  /* dd */
+	{ 0x2021, 0x0 },  /* ddagger */
+	{ 0x21ca, 0x0 },  /* ddarr */
+	{ 0x2a77, 0x0 },  /* ddotseq */
+	{ 0xb0, 0x0 },  /* deg */
+	{ 0x3b4, 0x0 },  /* delta */
+	{ 0x29b1, 0x0 },  /* demptyv */
+	{ 0x297f, 0x0 },  /* dfisht */
+	{ 0x1d521, 0x0 },  /* dfr */
+	{ 0x21c3, 0x0 },  /* dharl */
+	{ 0x21c2, 0x0 },  /* dharr */
+	{ 0x22c4, 0x0 },  /* diam */
+	{ 0x22c4, 0x0 },  /* diamond */
+	{ 0x2666, 0x0 },  /* diamondsuit */
+	{ 0x2666, 0x0 },  /* diams */
+	{ 0xa8, 0x0 },  /* die */
+	{ 0x3dd, 0x0 },  /* digamma */
+	{ 0x22f2, 0x0 },  /* disin */
+	{ 0xf7, 0x0 },  /* div */
+	{ 0xf7, 0x0 },  /* divide */
+	{ 0x22c7, 0x0 },  /* divideontimes */
+	{ 0x22c7, 0x0 },  /* divonx */
+	{ 0x452, 0x0 },  /* djcy */
+	{ 0x231e, 0x0 },  /* dlcorn */
+	{ 0x230d, 0x0 },  /* dlcrop */
+	{ 0x24, 0x0 },  /* dollar */
+	{ 0x1d555, 0x0 },  /* dopf */
+	{ 0x2d9, 0x0 },  /* dot */
+	{ 0x2250, 0x0 },  /* doteq */
+	{ 0x2251, 0x0 },  /* doteqdot */
+	{ 0x2238, 0x0 },  /* dotminus */
+	{ 0x2214, 0x0 },  /* dotplus */
+	{ 0x22a1, 0x0 },  /* dotsquare */
+	{ 0x2306, 0x0 },  /* doublebarwedge */
+	{ 0x2193, 0x0 },  /* downarrow */
+	{ 0x21ca, 0x0 },  /* downdownarrows */
+	{ 0x21c3, 0x0 },  /* downharpoonleft */
+	{ 0x21c2, 0x0 },  /* downharpoonright */
+	{ 0x2910, 0x0 },  /* drbkarow */
+	{ 0x231f, 0x0 },  /* drcorn */
+	{ 0x230c, 0x0 },  /* drcrop */
+	{ 0x1d4b9, 0x0 },  /* dscr */
+	{ 0x455, 0x0 },  /* dscy */
+	{ 0x29f6, 0x0 },  /* dsol */
+	{ 0x111, 0x0 },  /* dstrok */
+	{ 0x22f1, 0x0 },  /* dtdot */
+	{ 0x25bf, 0x0 },  /* dtri */
+	{ 0x25be, 0x0 },  /* dtrif */
+	{ 0x21f5, 0x0 },  /* duarr */
+	{ 0x296f, 0x0 },  /* duhar */
+	{ 0x29a6, 0x0 },  /* dwangle */
+	{ 0x45f, 0x0 },  /* dzcy */
+	{ 0x27ff, 0x0 },  /* dzigrarr */
+	{ 0x2a77, 0x0 },  /* eDDot */
+	{ 0x2251, 0x0 },  /* eDot */
+	{ 0xe9, 0x0 },  /* eacute */
+	{ 0x2a6e, 0x0 },  /* easter */
+	{ 0x11b, 0x0 },  /* ecaron */
+	{ 0x2256, 0x0 },  /* ecir */
+	{ 0xea, 0x0 },  /* ecirc */
+	{ 0x2255, 0x0 },  /* ecolon */
+	{ 0x44d, 0x0 },  /* ecy */
+	{ 0x117, 0x0 },  /* edot */
+	{ 0x2147, 0x0 },  /* ee */
+	{ 0x2252, 0x0 },  /* efDot */
+	{ 0x1d522, 0x0 },  /* efr */
+	{ 0x2a9a, 0x0 },  /* eg */
+	{ 0xe8, 0x0 },  /* egrave */
+	{ 0x2a96, 0x0 },  /* egs */
+	{ 0x2a98, 0x0 },  /* egsdot */
+	{ 0x2a99, 0x0 },  /* el */
+	{ 0x23e7, 0x0 },  /* elinters */
+	{ 0x2113, 0x0 },  /* ell */
+	{ 0x2a95, 0x0 },  /* els */
+	{ 0x2a97, 0x0 },  /* elsdot */
+	{ 0x113, 0x0 },  /* emacr */
+	{ 0x2205, 0x0 },  /* empty */
+	{ 0x2205, 0x0 },  /* emptyset */
+	{ 0x2205, 0x0 },  /* emptyv */
+	{ 0x2003, 0x0 },  /* emsp */
+	{ 0x2004, 0x0 },  /* emsp13 */
+	{ 0x2005, 0x0 },  /* emsp14 */
+	{ 0x14b, 0x0 },  /* eng */
+	{ 0x2002, 0x0 },  /* ensp */
+	{ 0x119, 0x0 },  /* eogon */
+	{ 0x1d556, 0x0 },  /* eopf */
+	{ 0x22d5, 0x0 },  /* epar */
+	{ 0x29e3, 0x0 },  /* eparsl */
+	{ 0x2a71, 0x0 },  /* eplus */
+	{ 0x3b5, 0x0 },  /* epsi */
+	{ 0x3b5, 0x0 },  /* epsilon */
+	{ 0x3f5, 0x0 },  /* epsiv */
+	{ 0x2256, 0x0 },  /* eqcirc */
+	{ 0x2255, 0x0 },  /* eqcolon */
+	{ 0x2242, 0x0 },  /* eqsim */
+	{ 0x2a96, 0x0 },  /* eqslantgtr */
+	{ 0x2a95, 0x0 },  /* eqslantless */
+	{ 0x3d, 0x0 },  /* equals */
+	{ 0x225f, 0x0 },  /* equest */
+	{ 0x2261, 0x0 },  /* equiv */
+	{ 0x2a78, 0x0 },  /* equivDD */
+	{ 0x29e5, 0x0 },  /* eqvparsl */
+	{ 0x2253, 0x0 },  /* erDot */
+	{ 0x2971, 0x0 },  /* erarr */
+	{ 0x212f, 0x0 },  /* escr */
+	{ 0x2250, 0x0 },  /* esdot */
+	{ 0x2242, 0x0 },  /* esim */
+	{ 0x3b7, 0x0 },  /* eta */
+	{ 0xf0, 0x0 },  /* eth */
+	{ 0xeb, 0x0 },  /* euml */
+	{ 0x20ac, 0x0 },  /* euro */
+	{ 0x21, 0x0 },  /* excl */
+	{ 0x2203, 0x0 },  /* exist */
+	{ 0x2130, 0x0 },  /* expectation */
+	{ 0x2147, 0x0 },  /* exponentiale */
+	{ 0x2252, 0x0 },  /* fallingdotseq */
+	{ 0x444, 0x0 },  /* fcy */
+	{ 0x2640, 0x0 },  /* female */
+	{ 0xfb03, 0x0 },  /* ffilig */
+	{ 0xfb00, 0x0 },  /* fflig */
+	{ 0xfb04, 0x0 },  /* ffllig */
+	{ 0x1d523, 0x0 },  /* ffr */
+	{ 0xfb01, 0x0 },  /* filig */
+	{ 0x66, 0x6a },  /* fjlig */
+	{ 0x266d, 0x0 },  /* flat */
+	{ 0xfb02, 0x0 },  /* fllig */
+	{ 0x25b1, 0x0 },  /* fltns */
+	{ 0x192, 0x0 },  /* fnof */
+	{ 0x1d557, 0x0 },  /* fopf */
+	{ 0x2200, 0x0 },  /* forall */
+	{ 0x22d4, 0x0 },  /* fork */
+	{ 0x2ad9, 0x0 },  /* forkv */
+	{ 0x2a0d, 0x0 },  /* fpartint */
+	{ 0xbd, 0x0 },  /* frac12 */
+	{ 0x2153, 0x0 },  /* frac13 */
+	{ 0xbc, 0x0 },  /* frac14 */
+	{ 0x2155, 0x0 },  /* frac15 */
+	{ 0x2159, 0x0 },  /* frac16 */
+	{ 0x215b, 0x0 },  /* frac18 */
+	{ 0x2154, 0x0 },  /* frac23 */
+	{ 0x2156, 0x0 },  /* frac25 */
+	{ 0xbe, 0x0 },  /* frac34 */
+	{ 0x2157, 0x0 },  /* frac35 */
+	{ 0x215c, 0x0 },  /* frac38 */
+	{ 0x2158, 0x0 },  /* frac45 */
+	{ 0x215a, 0x0 },  /* frac56 */
+	{ 0x215d, 0x0 },  /* frac58 */
+	{ 0x215e, 0x0 },  /* frac78 */
+	{ 0x2044, 0x0 },  /* frasl */
+	{ 0x2322, 0x0 },  /* frown */
+	{ 0x1d4bb, 0x0 },  /* fscr */
+	{ 0x2267, 0x0 },  /* gE */
+	{ 0x2a8c, 0x0 },  /* gEl */
+	{ 0x1f5, 0x0 },  /* gacute */
+	{ 0x3b3, 0x0 },  /* gamma */
+	{ 0x3dd, 0x0 },  /* gammad */
+	{ 0x2a86, 0x0 },  /* gap */
+	{ 0x11f, 0x0 },  /* gbreve */
+	{ 0x11d, 0x0 },  /* gcirc */
+	{ 0x433, 0x0 },  /* gcy */
+	{ 0x121, 0x0 },  /* gdot */
+	{ 0x2265, 0x0 },  /* ge */
+	{ 0x22db, 0x0 },  /* gel */
+	{ 0x2265, 0x0 },  /* geq */
+	{ 0x2267, 0x0 },  /* geqq */
+	{ 0x2a7e, 0x0 },  /* geqslant */
+	{ 0x2a7e, 0x0 },  /* ges */
+	{ 0x2aa9, 0x0 },  /* gescc */
+	{ 0x2a80, 0x0 },  /* gesdot */
+	{ 0x2a82, 0x0 },  /* gesdoto */
+	{ 0x2a84, 0x0 },  /* gesdotol */
+	{ 0x22db, 0xfe00 },  /* gesl */
+	{ 0x2a94, 0x0 },  /* gesles */
+	{ 0x1d524, 0x0 },  /* gfr */
+	{ 0x226b, 0x0 },  /* gg */
+	{ 0x22d9, 0x0 },  /* ggg */
+	{ 0x2137, 0x0 },  /* gimel */
+	{ 0x453, 0x0 },  /* gjcy */
+	{ 0x2277, 0x0 },  /* gl */
+	{ 0x2a92, 0x0 },  /* glE */
+	{ 0x2aa5, 0x0 },  /* gla */
+	{ 0x2aa4, 0x0 },  /* glj */
+	{ 0x2269, 0x0 },  /* gnE */
+	{ 0x2a8a, 0x0 },  /* gnap */
+	{ 0x2a8a, 0x0 },  /* gnapprox */
+	{ 0x2a88, 0x0 },  /* gne */
+	{ 0x2a88, 0x0 },  /* gneq */
+	{ 0x2269, 0x0 },  /* gneqq */
+	{ 0x22e7, 0x0 },  /* gnsim */
+	{ 0x1d558, 0x0 },  /* gopf */
+	{ 0x60, 0x0 },  /* grave */
+	{ 0x210a, 0x0 },  /* gscr */
+	{ 0x2273, 0x0 },  /* gsim */
+	{ 0x2a8e, 0x0 },  /* gsime */
+	{ 0x2a90, 0x0 },  /* gsiml */
+	{ 0x3e, 0x0 },  /* gt */
+	{ 0x2aa7, 0x0 },  /* gtcc */
+	{ 0x2a7a, 0x0 },  /* gtcir */
+	{ 0x22d7, 0x0 },  /* gtdot */
+	{ 0x2995, 0x0 },  /* gtlPar */
+	{ 0x2a7c, 0x0 },  /* gtquest */
+	{ 0x2a86, 0x0 },  /* gtrapprox */
+	{ 0x2978, 0x0 },  /* gtrarr */
+	{ 0x22d7, 0x0 },  /* gtrdot */
+	{ 0x22db, 0x0 },  /* gtreqless */
+	{ 0x2a8c, 0x0 },  /* gtreqqless */
+	{ 0x2277, 0x0 },  /* gtrless */
+	{ 0x2273, 0x0 },  /* gtrsim */
+	{ 0x2269, 0xfe00 },  /* gvertneqq */
+	{ 0x2269, 0xfe00 },  /* gvnE */
+	{ 0x21d4, 0x0 },  /* hArr */
+	{ 0x200a, 0x0 },  /* hairsp */
+	{ 0xbd, 0x0 },  /* half */
+	{ 0x210b, 0x0 },  /* hamilt */
+	{ 0x44a, 0x0 },  /* hardcy */
+	{ 0x2194, 0x0 },  /* harr */
+	{ 0x2948, 0x0 },  /* harrcir */
+	{ 0x21ad, 0x0 },  /* harrw */
+	{ 0x210f, 0x0 },  /* hbar */
+	{ 0x125, 0x0 },  /* hcirc */
+	{ 0x2665, 0x0 },  /* hearts */
+	{ 0x2665, 0x0 },  /* heartsuit */
+	{ 0x2026, 0x0 },  /* hellip */
+	{ 0x22b9, 0x0 },  /* hercon */
+	{ 0x1d525, 0x0 },  /* hfr */
+	{ 0x2925, 0x0 },  /* hksearow */
+	{ 0x2926, 0x0 },  /* hkswarow */
+	{ 0x21ff, 0x0 },  /* hoarr */
+	{ 0x223b, 0x0 },  /* homtht */
+	{ 0x21a9, 0x0 },  /* hookleftarrow */
+	{ 0x21aa, 0x0 },  /* hookrightarrow */
+	{ 0x1d559, 0x0 },  /* hopf */
+	{ 0x2015, 0x0 },  /* horbar */
+	{ 0x1d4bd, 0x0 },  /* hscr */
+	{ 0x210f, 0x0 },  /* hslash */
+	{ 0x127, 0x0 },  /* hstrok */
+	{ 0x2043, 0x0 },  /* hybull */
+	{ 0x2010, 0x0 },  /* hyphen */
+	{ 0xed, 0x0 },  /* iacute */
+	{ 0x2063, 0x0 },  /* ic */
+	{ 0xee, 0x0 },  /* icirc */
+	{ 0x438, 0x0 },  /* icy */
+	{ 0x435, 0x0 },  /* iecy */
+	{ 0xa1, 0x0 },  /* iexcl */
+	{ 0x21d4, 0x0 },  /* iff */
+	{ 0x1d526, 0x0 },  /* ifr */
+	{ 0xec, 0x0 },  /* igrave */
+	{ 0x2148, 0x0 },  /* ii */
+	{ 0x2a0c, 0x0 },  /* iiiint */
+	{ 0x222d, 0x0 },  /* iiint */
+	{ 0x29dc, 0x0 },  /* iinfin */
+	{ 0x2129, 0x0 },  /* iiota */
+	{ 0x133, 0x0 },  /* ijlig */
+	{ 0x12b, 0x0 },  /* imacr */
+	{ 0x2111, 0x0 },  /* image */
+	{ 0x2110, 0x0 },  /* imagline */
+	{ 0x2111, 0x0 },  /* imagpart */
+	{ 0x131, 0x0 },  /* imath */
+	{ 0x22b7, 0x0 },  /* imof */
+	{ 0x1b5, 0x0 },  /* imped */
+	{ 0x2208, 0x0 },  /* in */
+	{ 0x2105, 0x0 },  /* incare */
+	{ 0x221e, 0x0 },  /* infin */
+	{ 0x29dd, 0x0 },  /* infintie */
+	{ 0x131, 0x0 },  /* inodot */
+	{ 0x222b, 0x0 },  /* int */
+	{ 0x22ba, 0x0 },  /* intcal */
+	{ 0x2124, 0x0 },  /* integers */
+	{ 0x22ba, 0x0 },  /* intercal */
+	{ 0x2a17, 0x0 },  /* intlarhk */
+	{ 0x2a3c, 0x0 },  /* intprod */
+	{ 0x451, 0x0 },  /* iocy */
+	{ 0x12f, 0x0 },  /* iogon */
+	{ 0x1d55a, 0x0 },  /* iopf */
+	{ 0x3b9, 0x0 },  /* iota */
+	{ 0x2a3c, 0x0 },  /* iprod */
+	{ 0xbf, 0x0 },  /* iquest */
+	{ 0x1d4be, 0x0 },  /* iscr */
+	{ 0x2208, 0x0 },  /* isin */
+	{ 0x22f9, 0x0 },  /* isinE */
+	{ 0x22f5, 0x0 },  /* isindot */
+	{ 0x22f4, 0x0 },  /* isins */
+	{ 0x22f3, 0x0 },  /* isinsv */
+	{ 0x2208, 0x0 },  /* isinv */
+	{ 0x2062, 0x0 },  /* it */
+	{ 0x129, 0x0 },  /* itilde */
+	{ 0x456, 0x0 },  /* iukcy */
+	{ 0xef, 0x0 },  /* iuml */
+	{ 0x135, 0x0 },  /* jcirc */
+	{ 0x439, 0x0 },  /* jcy */
+	{ 0x1d527, 0x0 },  /* jfr */
+	{ 0x237, 0x0 },  /* jmath */
+	{ 0x1d55b, 0x0 },  /* jopf */
+	{ 0x1d4bf, 0x0 },  /* jscr */
+	{ 0x458, 0x0 },  /* jsercy */
+	{ 0x454, 0x0 },  /* jukcy */
+	{ 0x3ba, 0x0 },  /* kappa */
+	{ 0x3f0, 0x0 },  /* kappav */
+	{ 0x137, 0x0 },  /* kcedil */
+	{ 0x43a, 0x0 },  /* kcy */
+	{ 0x1d528, 0x0 },  /* kfr */
+	{ 0x138, 0x0 },  /* kgreen */
+	{ 0x445, 0x0 },  /* khcy */
+	{ 0x45c, 0x0 },  /* kjcy */
+	{ 0x1d55c, 0x0 },  /* kopf */
+	{ 0x1d4c0, 0x0 },  /* kscr */
+	{ 0x21da, 0x0 },  /* lAarr */
+	{ 0x21d0, 0x0 },  /* lArr */
+	{ 0x291b, 0x0 },  /* lAtail */
+	{ 0x290e, 0x0 },  /* lBarr */
+	{ 0x2266, 0x0 },  /* lE */
+	{ 0x2a8b, 0x0 },  /* lEg */
+	{ 0x2962, 0x0 },  /* lHar */
+	{ 0x13a, 0x0 },  /* lacute */
+	{ 0x29b4, 0x0 },  /* laemptyv */
+	{ 0x2112, 0x0 },  /* lagran */
+	{ 0x3bb, 0x0 },  /* lambda */
+	{ 0x27e8, 0x0 },  /* lang */
+	{ 0x2991, 0x0 },  /* langd */
+	{ 0x27e8, 0x0 },  /* langle */
+	{ 0x2a85, 0x0 },  /* lap */
+	{ 0xab, 0x0 },  /* laquo */
+	{ 0x2190, 0x0 },  /* larr */
+	{ 0x21e4, 0x0 },  /* larrb */
+	{ 0x291f, 0x0 },  /* larrbfs */
+	{ 0x291d, 0x0 },  /* larrfs */
+	{ 0x21a9, 0x0 },  /* larrhk */
+	{ 0x21ab, 0x0 },  /* larrlp */
+	{ 0x2939, 0x0 },  /* larrpl */
+	{ 0x2973, 0x0 },  /* larrsim */
+	{ 0x21a2, 0x0 },  /* larrtl */
+	{ 0x2aab, 0x0 },  /* lat */
+	{ 0x2919, 0x0 },  /* latail */
+	{ 0x2aad, 0x0 },  /* late */
+	{ 0x2aad, 0xfe00 },  /* lates */
+	{ 0x290c, 0x0 },  /* lbarr */
+	{ 0x2772, 0x0 },  /* lbbrk */
+	{ 0x7b, 0x0 },  /* lbrace */
+	{ 0x5b, 0x0 },  /* lbrack */
+	{ 0x298b, 0x0 },  /* lbrke */
+	{ 0x298f, 0x0 },  /* lbrksld */
+	{ 0x298d, 0x0 },  /* lbrkslu */
+	{ 0x13e, 0x0 },  /* lcaron */
+	{ 0x13c, 0x0 },  /* lcedil */
+	{ 0x2308, 0x0 },  /* lceil */
+	{ 0x7b, 0x0 },  /* lcub */
+	{ 0x43b, 0x0 },  /* lcy */
+	{ 0x2936, 0x0 },  /* ldca */
+	{ 0x201c, 0x0 },  /* ldquo */
+	{ 0x201e, 0x0 },  /* ldquor */
+	{ 0x2967, 0x0 },  /* ldrdhar */
+	{ 0x294b, 0x0 },  /* ldrushar */
+	{ 0x21b2, 0x0 },  /* ldsh */
+	{ 0x2264, 0x0 },  /* le */
+	{ 0x2190, 0x0 },  /* leftarrow */
+	{ 0x21a2, 0x0 },  /* leftarrowtail */
+	{ 0x21bd, 0x0 },  /* leftharpoondown */
+	{ 0x21bc, 0x0 },  /* leftharpoonup */
+	{ 0x21c7, 0x0 },  /* leftleftarrows */
+	{ 0x2194, 0x0 },  /* leftrightarrow */
+	{ 0x21c6, 0x0 },  /* leftrightarrows */
+	{ 0x21cb, 0x0 },  /* leftrightharpoons */
+	{ 0x21ad, 0x0 },  /* leftrightsquigarrow */
+	{ 0x22cb, 0x0 },  /* leftthreetimes */
+	{ 0x22da, 0x0 },  /* leg */
+	{ 0x2264, 0x0 },  /* leq */
+	{ 0x2266, 0x0 },  /* leqq */
+	{ 0x2a7d, 0x0 },  /* leqslant */
+	{ 0x2a7d, 0x0 },  /* les */
+	{ 0x2aa8, 0x0 },  /* lescc */
+	{ 0x2a7f, 0x0 },  /* lesdot */
+	{ 0x2a81, 0x0 },  /* lesdoto */
+	{ 0x2a83, 0x0 },  /* lesdotor */
+	{ 0x22da, 0xfe00 },  /* lesg */
+	{ 0x2a93, 0x0 },  /* lesges */
+	{ 0x2a85, 0x0 },  /* lessapprox */
+	{ 0x22d6, 0x0 },  /* lessdot */
+	{ 0x22da, 0x0 },  /* lesseqgtr */
+	{ 0x2a8b, 0x0 },  /* lesseqqgtr */
+	{ 0x2276, 0x0 },  /* lessgtr */
+	{ 0x2272, 0x0 },  /* lesssim */
+	{ 0x297c, 0x0 },  /* lfisht */
+	{ 0x230a, 0x0 },  /* lfloor */
+	{ 0x1d529, 0x0 },  /* lfr */
+	{ 0x2276, 0x0 },  /* lg */
+	{ 0x2a91, 0x0 },  /* lgE */
+	{ 0x21bd, 0x0 },  /* lhard */
+	{ 0x21bc, 0x0 },  /* lharu */
+	{ 0x296a, 0x0 },  /* lharul */
+	{ 0x2584, 0x0 },  /* lhblk */
+	{ 0x459, 0x0 },  /* ljcy */
+	{ 0x226a, 0x0 },  /* ll */
+	{ 0x21c7, 0x0 },  /* llarr */
+	{ 0x231e, 0x0 },  /* llcorner */
+	{ 0x296b, 0x0 },  /* llhard */
+	{ 0x25fa, 0x0 },  /* lltri */
+	{ 0x140, 0x0 },  /* lmidot */
+	{ 0x23b0, 0x0 },  /* lmoust */
+	{ 0x23b0, 0x0 },  /* lmoustache */
+	{ 0x2268, 0x0 },  /* lnE */
+	{ 0x2a89, 0x0 },  /* lnap */
+	{ 0x2a89, 0x0 },  /* lnapprox */
+	{ 0x2a87, 0x0 },  /* lne */
+	{ 0x2a87, 0x0 },  /* lneq */
+	{ 0x2268, 0x0 },  /* lneqq */
+	{ 0x22e6, 0x0 },  /* lnsim */
+	{ 0x27ec, 0x0 },  /* loang */
+	{ 0x21fd, 0x0 },  /* loarr */
+	{ 0x27e6, 0x0 },  /* lobrk */
+	{ 0x27f5, 0x0 },  /* longleftarrow */
+	{ 0x27f7, 0x0 },  /* longleftrightarrow */
+	{ 0x27fc, 0x0 },  /* longmapsto */
+	{ 0x27f6, 0x0 },  /* longrightarrow */
+	{ 0x21ab, 0x0 },  /* looparrowleft */
+	{ 0x21ac, 0x0 },  /* looparrowright */
+	{ 0x2985, 0x0 },  /* lopar */
+	{ 0x1d55d, 0x0 },  /* lopf */
+	{ 0x2a2d, 0x0 },  /* loplus */
+	{ 0x2a34, 0x0 },  /* lotimes */
+	{ 0x2217, 0x0 },  /* lowast */
+	{ 0x5f, 0x0 },  /* lowbar */
+	{ 0x25ca, 0x0 },  /* loz */
+	{ 0x25ca, 0x0 },  /* lozenge */
+	{ 0x29eb, 0x0 },  /* lozf */
+	{ 0x28, 0x0 },  /* lpar */
+	{ 0x2993, 0x0 },  /* lparlt */
+	{ 0x21c6, 0x0 },  /* lrarr */
+	{ 0x231f, 0x0 },  /* lrcorner */
+	{ 0x21cb, 0x0 },  /* lrhar */
+	{ 0x296d, 0x0 },  /* lrhard */
+	{ 0x200e, 0x0 },  /* lrm */
+	{ 0x22bf, 0x0 },  /* lrtri */
+	{ 0x2039, 0x0 },  /* lsaquo */
+	{ 0x1d4c1, 0x0 },  /* lscr */
+	{ 0x21b0, 0x0 },  /* lsh */
+	{ 0x2272, 0x0 },  /* lsim */
+	{ 0x2a8d, 0x0 },  /* lsime */
+	{ 0x2a8f, 0x0 },  /* lsimg */
+	{ 0x5b, 0x0 },  /* lsqb */
+	{ 0x2018, 0x0 },  /* lsquo */
+	{ 0x201a, 0x0 },  /* lsquor */
+	{ 0x142, 0x0 },  /* lstrok */
+	{ 0x3c, 0x0 },  /* lt */
+	{ 0x2aa6, 0x0 },  /* ltcc */
+	{ 0x2a79, 0x0 },  /* ltcir */
+	{ 0x22d6, 0x0 },  /* ltdot */
+	{ 0x22cb, 0x0 },  /* lthree */
+	{ 0x22c9, 0x0 },  /* ltimes */
+	{ 0x2976, 0x0 },  /* ltlarr */
+	{ 0x2a7b, 0x0 },  /* ltquest */
+	{ 0x2996, 0x0 },  /* ltrPar */
+	{ 0x25c3, 0x0 },  /* ltri */
+	{ 0x22b4, 0x0 },  /* ltrie */
+	{ 0x25c2, 0x0 },  /* ltrif */
+	{ 0x294a, 0x0 },  /* lurdshar */
+	{ 0x2966, 0x0 },  /* luruhar */
+	{ 0x2268, 0xfe00 },  /* lvertneqq */
+	{ 0x2268, 0xfe00 },  /* lvnE */
+	{ 0x223a, 0x0 },  /* mDDot */
+	{ 0xaf, 0x0 },  /* macr */
+	{ 0x2642, 0x0 },  /* male */
+	{ 0x2720, 0x0 },  /* malt */
+	{ 0x2720, 0x0 },  /* maltese */
+	{ 0x21a6, 0x0 },  /* map */
+	{ 0x21a6, 0x0 },  /* mapsto */
+	{ 0x21a7, 0x0 },  /* mapstodown */
+	{ 0x21a4, 0x0 },  /* mapstoleft */
+	{ 0x21a5, 0x0 },  /* mapstoup */
+	{ 0x25ae, 0x0 },  /* marker */
+	{ 0x2a29, 0x0 },  /* mcomma */
+	{ 0x43c, 0x0 },  /* mcy */
+	{ 0x2014, 0x0 },  /* mdash */
+	{ 0x2221, 0x0 },  /* measuredangle */
+	{ 0x1d52a, 0x0 },  /* mfr */
+	{ 0x2127, 0x0 },  /* mho */
+	{ 0xb5, 0x0 },  /* micro */
+	{ 0x2223, 0x0 },  /* mid */
+	{ 0x2a, 0x0 },  /* midast */
+	{ 0x2af0, 0x0 },  /* midcir */
+	{ 0xb7, 0x0 },  /* middot */
+	{ 0x2212, 0x0 },  /* minus */
+	{ 0x229f, 0x0 },  /* minusb */
+	{ 0x2238, 0x0 },  /* minusd */
+	{ 0x2a2a, 0x0 },  /* minusdu */
+	{ 0x2adb, 0x0 },  /* mlcp */
+	{ 0x2026, 0x0 },  /* mldr */
+	{ 0x2213, 0x0 },  /* mnplus */
+	{ 0x22a7, 0x0 },  /* models */
+	{ 0x1d55e, 0x0 },  /* mopf */
+	{ 0x2213, 0x0 },  /* mp */
+	{ 0x1d4c2, 0x0 },  /* mscr */
+	{ 0x223e, 0x0 },  /* mstpos */
+	{ 0x3bc, 0x0 },  /* mu */
+	{ 0x22b8, 0x0 },  /* multimap */
+	{ 0x22b8, 0x0 },  /* mumap */
+	{ 0x22d9, 0x338 },  /* nGg */
+	{ 0x226b, 0x20d2 },  /* nGt */
+	{ 0x226b, 0x338 },  /* nGtv */
+	{ 0x21cd, 0x0 },  /* nLeftarrow */
+	{ 0x21ce, 0x0 },  /* nLeftrightarrow */
+	{ 0x22d8, 0x338 },  /* nLl */
+	{ 0x226a, 0x20d2 },  /* nLt */
+	{ 0x226a, 0x338 },  /* nLtv */
+	{ 0x21cf, 0x0 },  /* nRightarrow */
+	{ 0x22af, 0x0 },  /* nVDash */
+	{ 0x22ae, 0x0 },  /* nVdash */
+	{ 0x2207, 0x0 },  /* nabla */
+	{ 0x144, 0x0 },  /* nacute */
+	{ 0x2220, 0x20d2 },  /* nang */
+	{ 0x2249, 0x0 },  /* nap */
+	{ 0x2a70, 0x338 },  /* napE */
+	{ 0x224b, 0x338 },  /* napid */
+	{ 0x149, 0x0 },  /* napos */
+	{ 0x2249, 0x0 },  /* napprox */
+	{ 0x266e, 0x0 },  /* natur */
+	{ 0x266e, 0x0 },  /* natural */
+	{ 0x2115, 0x0 },  /* naturals */
+	{ 0xa0, 0x0 },  /* nbsp */
+	{ 0x224e, 0x338 },  /* nbump */
+	{ 0x224f, 0x338 },  /* nbumpe */
+	{ 0x2a43, 0x0 },  /* ncap */
+	{ 0x148, 0x0 },  /* ncaron */
+	{ 0x146, 0x0 },  /* ncedil */
+	{ 0x2247, 0x0 },  /* ncong */
+	{ 0x2a6d, 0x338 },  /* ncongdot */
+	{ 0x2a42, 0x0 },  /* ncup */
+	{ 0x43d, 0x0 },  /* ncy */
+	{ 0x2013, 0x0 },  /* ndash */
+	{ 0x2260, 0x0 },  /* ne */
+	{ 0x21d7, 0x0 },  /* neArr */
+	{ 0x2924, 0x0 },  /* nearhk */
+	{ 0x2197, 0x0 },  /* nearr */
+	{ 0x2197, 0x0 },  /* nearrow */
+	{ 0x2250, 0x338 },  /* nedot */
+	{ 0x2262, 0x0 },  /* nequiv */
+	{ 0x2928, 0x0 },  /* nesear */
+	{ 0x2242, 0x338 },  /* nesim */
+	{ 0x2204, 0x0 },  /* nexist */
+	{ 0x2204, 0x0 },  /* nexists */
+	{ 0x1d52b, 0x0 },  /* nfr */
+	{ 0x2267, 0x338 },  /* ngE */
+	{ 0x2271, 0x0 },  /* nge */
+	{ 0x2271, 0x0 },  /* ngeq */
+	{ 0x2267, 0x338 },  /* ngeqq */
+	{ 0x2a7e, 0x338 },  /* ngeqslant */
+	{ 0x2a7e, 0x338 },  /* nges */
+	{ 0x2275, 0x0 },  /* ngsim */
+	{ 0x226f, 0x0 },  /* ngt */
+	{ 0x226f, 0x0 },  /* ngtr */
+	{ 0x21ce, 0x0 },  /* nhArr */
+	{ 0x21ae, 0x0 },  /* nharr */
+	{ 0x2af2, 0x0 },  /* nhpar */
+	{ 0x220b, 0x0 },  /* ni */
+	{ 0x22fc, 0x0 },  /* nis */
+	{ 0x22fa, 0x0 },  /* nisd */
+	{ 0x220b, 0x0 },  /* niv */
+	{ 0x45a, 0x0 },  /* njcy */
+	{ 0x21cd, 0x0 },  /* nlArr */
+	{ 0x2266, 0x338 },  /* nlE */
+	{ 0x219a, 0x0 },  /* nlarr */
+	{ 0x2025, 0x0 },  /* nldr */
+	{ 0x2270, 0x0 },  /* nle */
+	{ 0x219a, 0x0 },  /* nleftarrow */
+	{ 0x21ae, 0x0 },  /* nleftrightarrow */
+	{ 0x2270, 0x0 },  /* nleq */
+	{ 0x2266, 0x338 },  /* nleqq */
+	{ 0x2a7d, 0x338 },  /* nleqslant */
+	{ 0x2a7d, 0x338 },  /* nles */
+	{ 0x226e, 0x0 },  /* nless */
+	{ 0x2274, 0x0 },  /* nlsim */
+	{ 0x226e, 0x0 },  /* nlt */
+	{ 0x22ea, 0x0 },  /* nltri */
+	{ 0x22ec, 0x0 },  /* nltrie */
+	{ 0x2224, 0x0 },  /* nmid */
+	{ 0x1d55f, 0x0 },  /* nopf */
+	{ 0xac, 0x0 },  /* not */
+	{ 0x2209, 0x0 },  /* notin */
+	{ 0x22f9, 0x338 },  /* notinE */
+	{ 0x22f5, 0x338 },  /* notindot */
+	{ 0x2209, 0x0 },  /* notinva */
+	{ 0x22f7, 0x0 },  /* notinvb */
+	{ 0x22f6, 0x0 },  /* notinvc */
+	{ 0x220c, 0x0 },  /* notni */
+	{ 0x220c, 0x0 },  /* notniva */
+	{ 0x22fe, 0x0 },  /* notnivb */
+	{ 0x22fd, 0x0 },  /* notnivc */
+	{ 0x2226, 0x0 },  /* npar */
+	{ 0x2226, 0x0 },  /* nparallel */
+	{ 0x2afd, 0x20e5 },  /* nparsl */
+	{ 0x2202, 0x338 },  /* npart */
+	{ 0x2a14, 0x0 },  /* npolint */
+	{ 0x2280, 0x0 },  /* npr */
+	{ 0x22e0, 0x0 },  /* nprcue */
+	{ 0x2aaf, 0x338 },  /* npre */
+	{ 0x2280, 0x0 },  /* nprec */
+	{ 0x2aaf, 0x338 },  /* npreceq */
+	{ 0x21cf, 0x0 },  /* nrArr */
+	{ 0x219b, 0x0 },  /* nrarr */
+	{ 0x2933, 0x338 },  /* nrarrc */
+	{ 0x219d, 0x338 },  /* nrarrw */
+	{ 0x219b, 0x0 },  /* nrightarrow */
+	{ 0x22eb, 0x0 },  /* nrtri */
+	{ 0x22ed, 0x0 },  /* nrtrie */
+	{ 0x2281, 0x0 },  /* nsc */
+	{ 0x22e1, 0x0 },  /* nsccue */
+	{ 0x2ab0, 0x338 },  /* nsce */
+	{ 0x1d4c3, 0x0 },  /* nscr */
+	{ 0x2224, 0x0 },  /* nshortmid */
+	{ 0x2226, 0x0 },  /* nshortparallel */
+	{ 0x2241, 0x0 },  /* nsim */
+	{ 0x2244, 0x0 },  /* nsime */
+	{ 0x2244, 0x0 },  /* nsimeq */
+	{ 0x2224, 0x0 },  /* nsmid */
+	{ 0x2226, 0x0 },  /* nspar */
+	{ 0x22e2, 0x0 },  /* nsqsube */
+	{ 0x22e3, 0x0 },  /* nsqsupe */
+	{ 0x2284, 0x0 },  /* nsub */
+	{ 0x2ac5, 0x338 },  /* nsubE */
+	{ 0x2288, 0x0 },  /* nsube */
+	{ 0x2282, 0x20d2 },  /* nsubset */
+	{ 0x2288, 0x0 },  /* nsubseteq */
+	{ 0x2ac5, 0x338 },  /* nsubseteqq */
+	{ 0x2281, 0x0 },  /* nsucc */
+	{ 0x2ab0, 0x338 },  /* nsucceq */
+	{ 0x2285, 0x0 },  /* nsup */
+	{ 0x2ac6, 0x338 },  /* nsupE */
+	{ 0x2289, 0x0 },  /* nsupe */
+	{ 0x2283, 0x20d2 },  /* nsupset */
+	{ 0x2289, 0x0 },  /* nsupseteq */
+	{ 0x2ac6, 0x338 },  /* nsupseteqq */
+	{ 0x2279, 0x0 },  /* ntgl */
+	{ 0xf1, 0x0 },  /* ntilde */
+	{ 0x2278, 0x0 },  /* ntlg */
+	{ 0x22ea, 0x0 },  /* ntriangleleft */
+	{ 0x22ec, 0x0 },  /* ntrianglelefteq */
+	{ 0x22eb, 0x0 },  /* ntriangleright */
+	{ 0x22ed, 0x0 },  /* ntrianglerighteq */
+	{ 0x3bd, 0x0 },  /* nu */
+	{ 0x23, 0x0 },  /* num */
+	{ 0x2116, 0x0 },  /* numero */
+	{ 0x2007, 0x0 },  /* numsp */
+	{ 0x22ad, 0x0 },  /* nvDash */
+	{ 0x2904, 0x0 },  /* nvHarr */
+	{ 0x224d, 0x20d2 },  /* nvap */
+	{ 0x22ac, 0x0 },  /* nvdash */
+	{ 0x2265, 0x20d2 },  /* nvge */
+	{ 0x3e, 0x20d2 },  /* nvgt */
+	{ 0x29de, 0x0 },  /* nvinfin */
+	{ 0x2902, 0x0 },  /* nvlArr */
+	{ 0x2264, 0x20d2 },  /* nvle */
+	{ 0x3c, 0x20d2 },  /* nvlt */
+	{ 0x22b4, 0x20d2 },  /* nvltrie */
+	{ 0x2903, 0x0 },  /* nvrArr */
+	{ 0x22b5, 0x20d2 },  /* nvrtrie */
+	{ 0x223c, 0x20d2 },  /* nvsim */
+	{ 0x21d6, 0x0 },  /* nwArr */
+	{ 0x2923, 0x0 },  /* nwarhk */
+	{ 0x2196, 0x0 },  /* nwarr */
+	{ 0x2196, 0x0 },  /* nwarrow */
+	{ 0x2927, 0x0 },  /* nwnear */
+	{ 0x24c8, 0x0 },  /* oS */
+	{ 0xf3, 0x0 },  /* oacute */
+	{ 0x229b, 0x0 },  /* oast */
+	{ 0x229a, 0x0 },  /* ocir */
+	{ 0xf4, 0x0 },  /* ocirc */
+	{ 0x43e, 0x0 },  /* ocy */
+	{ 0x229d, 0x0 },  /* odash */
+	{ 0x151, 0x0 },  /* odblac */
+	{ 0x2a38, 0x0 },  /* odiv */
+	{ 0x2299, 0x0 },  /* odot */
+	{ 0x29bc, 0x0 },  /* odsold */
+	{ 0x153, 0x0 },  /* oelig */
+	{ 0x29bf, 0x0 },  /* ofcir */
+	{ 0x1d52c, 0x0 },  /* ofr */
+	{ 0x2db, 0x0 },  /* ogon */
+	{ 0xf2, 0x0 },  /* ograve */
+	{ 0x29c1, 0x0 },  /* ogt */
+	{ 0x29b5, 0x0 },  /* ohbar */
+	{ 0x3a9, 0x0 },  /* ohm */
+	{ 0x222e, 0x0 },  /* oint */
+	{ 0x21ba, 0x0 },  /* olarr */
+	{ 0x29be, 0x0 },  /* olcir */
+	{ 0x29bb, 0x0 },  /* olcross */
+	{ 0x203e, 0x0 },  /* oline */
+	{ 0x29c0, 0x0 },  /* olt */
+	{ 0x14d, 0x0 },  /* omacr */
+	{ 0x3c9, 0x0 },  /* omega */
+	{ 0x3bf, 0x0 },  /* omicron */
+	{ 0x29b6, 0x0 },  /* omid */
+	{ 0x2296, 0x0 },  /* ominus */
+	{ 0x1d560, 0x0 },  /* oopf */
+	{ 0x29b7, 0x0 },  /* opar */
+	{ 0x29b9, 0x0 },  /* operp */
+	{ 0x2295, 0x0 },  /* oplus */
+	{ 0x2228, 0x0 },  /* or */
+	{ 0x21bb, 0x0 },  /* orarr */
+	{ 0x2a5d, 0x0 },  /* ord */
+	{ 0x2134, 0x0 },  /* order */
+	{ 0x2134, 0x0 },  /* orderof */
+	{ 0xaa, 0x0 },  /* ordf */
+	{ 0xba, 0x0 },  /* ordm */
+	{ 0x22b6, 0x0 },  /* origof */
+	{ 0x2a56, 0x0 },  /* oror */
+	{ 0x2a57, 0x0 },  /* orslope */
+	{ 0x2a5b, 0x0 },  /* orv */
+	{ 0x2134, 0x0 },  /* oscr */
+	{ 0xf8, 0x0 },  /* oslash */
+	{ 0x2298, 0x0 },  /* osol */
+	{ 0xf5, 0x0 },  /* otilde */
+	{ 0x2297, 0x0 },  /* otimes */
+	{ 0x2a36, 0x0 },  /* otimesas */
+	{ 0xf6, 0x0 },  /* ouml */
+	{ 0x233d, 0x0 },  /* ovbar */
+	{ 0x2225, 0x0 },  /* par */
+	{ 0xb6, 0x0 },  /* para */
+	{ 0x2225, 0x0 },  /* parallel */
+	{ 0x2af3, 0x0 },  /* parsim */
+	{ 0x2afd, 0x0 },  /* parsl */
+	{ 0x2202, 0x0 },  /* part */
+	{ 0x43f, 0x0 },  /* pcy */
+	{ 0x25, 0x0 },  /* percnt */
+	{ 0x2e, 0x0 },  /* period */
+	{ 0x2030, 0x0 },  /* permil */
+	{ 0x22a5, 0x0 },  /* perp */
+	{ 0x2031, 0x0 },  /* pertenk */
+	{ 0x1d52d, 0x0 },  /* pfr */
+	{ 0x3c6, 0x0 },  /* phi */
+	{ 0x3d5, 0x0 },  /* phiv */
+	{ 0x2133, 0x0 },  /* phmmat */
+	{ 0x260e, 0x0 },  /* phone */
+	{ 0x3c0, 0x0 },  /* pi */
+	{ 0x22d4, 0x0 },  /* pitchfork */
+	{ 0x3d6, 0x0 },  /* piv */
+	{ 0x210f, 0x0 },  /* planck */
+	{ 0x210e, 0x0 },  /* planckh */
+	{ 0x210f, 0x0 },  /* plankv */
+	{ 0x2b, 0x0 },  /* plus */
+	{ 0x2a23, 0x0 },  /* plusacir */
+	{ 0x229e, 0x0 },  /* plusb */
+	{ 0x2a22, 0x0 },  /* pluscir */
+	{ 0x2214, 0x0 },  /* plusdo */
+	{ 0x2a25, 0x0 },  /* plusdu */
+	{ 0x2a72, 0x0 },  /* pluse */
+	{ 0xb1, 0x0 },  /* plusmn */
+	{ 0x2a26, 0x0 },  /* plussim */
+	{ 0x2a27, 0x0 },  /* plustwo */
+	{ 0xb1, 0x0 },  /* pm */
+	{ 0x2a15, 0x0 },  /* pointint */
+	{ 0x1d561, 0x0 },  /* popf */
+	{ 0xa3, 0x0 },  /* pound */
+	{ 0x227a, 0x0 },  /* pr */
+	{ 0x2ab3, 0x0 },  /* prE */
+	{ 0x2ab7, 0x0 },  /* prap */
+	{ 0x227c, 0x0 },  /* prcue */
+	{ 0x2aaf, 0x0 },  /* pre */
+	{ 0x227a, 0x0 },  /* prec */
+	{ 0x2ab7, 0x0 },  /* precapprox */
+	{ 0x227c, 0x0 },  /* preccurlyeq */
+	{ 0x2aaf, 0x0 },  /* preceq */
+	{ 0x2ab9, 0x0 },  /* precnapprox */
+	{ 0x2ab5, 0x0 },  /* precneqq */
+	{ 0x22e8, 0x0 },  /* precnsim */
+	{ 0x227e, 0x0 },  /* precsim */
+	{ 0x2032, 0x0 },  /* prime */
+	{ 0x2119, 0x0 },  /* primes */
+	{ 0x2ab5, 0x0 },  /* prnE */
+	{ 0x2ab9, 0x0 },  /* prnap */
+	{ 0x22e8, 0x0 },  /* prnsim */
+	{ 0x220f, 0x0 },  /* prod */
+	{ 0x232e, 0x0 },  /* profalar */
+	{ 0x2312, 0x0 },  /* profline */
+	{ 0x2313, 0x0 },  /* profsurf */
+	{ 0x221d, 0x0 },  /* prop */
+	{ 0x221d, 0x0 },  /* propto */
+	{ 0x227e, 0x0 },  /* prsim */
+	{ 0x22b0, 0x0 },  /* prurel */
+	{ 0x1d4c5, 0x0 },  /* pscr */
+	{ 0x3c8, 0x0 },  /* psi */
+	{ 0x2008, 0x0 },  /* puncsp */
+	{ 0x1d52e, 0x0 },  /* qfr */
+	{ 0x2a0c, 0x0 },  /* qint */
+	{ 0x1d562, 0x0 },  /* qopf */
+	{ 0x2057, 0x0 },  /* qprime */
+	{ 0x1d4c6, 0x0 },  /* qscr */
+	{ 0x210d, 0x0 },  /* quaternions */
+	{ 0x2a16, 0x0 },  /* quatint */
+	{ 0x3f, 0x0 },  /* quest */
+	{ 0x225f, 0x0 },  /* questeq */
+	{ 0x22, 0x0 },  /* quot */
+	{ 0x21db, 0x0 },  /* rAarr */
+	{ 0x21d2, 0x0 },  /* rArr */
+	{ 0x291c, 0x0 },  /* rAtail */
+	{ 0x290f, 0x0 },  /* rBarr */
+	{ 0x2964, 0x0 },  /* rHar */
+	{ 0x223d, 0x331 },  /* race */
+	{ 0x155, 0x0 },  /* racute */
+	{ 0x221a, 0x0 },  /* radic */
+	{ 0x29b3, 0x0 },  /* raemptyv */
+	{ 0x27e9, 0x0 },  /* rang */
+	{ 0x2992, 0x0 },  /* rangd */
+	{ 0x29a5, 0x0 },  /* range */
+	{ 0x27e9, 0x0 },  /* rangle */
+	{ 0xbb, 0x0 },  /* raquo */
+	{ 0x2192, 0x0 },  /* rarr */
+	{ 0x2975, 0x0 },  /* rarrap */
+	{ 0x21e5, 0x0 },  /* rarrb */
+	{ 0x2920, 0x0 },  /* rarrbfs */
+	{ 0x2933, 0x0 },  /* rarrc */
+	{ 0x291e, 0x0 },  /* rarrfs */
+	{ 0x21aa, 0x0 },  /* rarrhk */
+	{ 0x21ac, 0x0 },  /* rarrlp */
+	{ 0x2945, 0x0 },  /* rarrpl */
+	{ 0x2974, 0x0 },  /* rarrsim */
+	{ 0x21a3, 0x0 },  /* rarrtl */
+	{ 0x219d, 0x0 },  /* rarrw */
+	{ 0x291a, 0x0 },  /* ratail */
+	{ 0x2236, 0x0 },  /* ratio */
+	{ 0x211a, 0x0 },  /* rationals */
+	{ 0x290d, 0x0 },  /* rbarr */
+	{ 0x2773, 0x0 },  /* rbbrk */
+	{ 0x7d, 0x0 },  /* rbrace */
+	{ 0x5d, 0x0 },  /* rbrack */
+	{ 0x298c, 0x0 },  /* rbrke */
+	{ 0x298e, 0x0 },  /* rbrksld */
+	{ 0x2990, 0x0 },  /* rbrkslu */
+	{ 0x159, 0x0 },  /* rcaron */
+	{ 0x157, 0x0 },  /* rcedil */
+	{ 0x2309, 0x0 },  /* rceil */
+	{ 0x7d, 0x0 },  /* rcub */
+	{ 0x440, 0x0 },  /* rcy */
+	{ 0x2937, 0x0 },  /* rdca */
+	{ 0x2969, 0x0 },  /* rdldhar */
+	{ 0x201d, 0x0 },  /* rdquo */
+	{ 0x201d, 0x0 },  /* rdquor */
+	{ 0x21b3, 0x0 },  /* rdsh */
+	{ 0x211c, 0x0 },  /* real */
+	{ 0x211b, 0x0 },  /* realine */
+	{ 0x211c, 0x0 },  /* realpart */
+	{ 0x211d, 0x0 },  /* reals */
+	{ 0x25ad, 0x0 },  /* rect */
+	{ 0xae, 0x0 },  /* reg */
+	{ 0x297d, 0x0 },  /* rfisht */
+	{ 0x230b, 0x0 },  /* rfloor */
+	{ 0x1d52f, 0x0 },  /* rfr */
+	{ 0x21c1, 0x0 },  /* rhard */
+	{ 0x21c0, 0x0 },  /* rharu */
+	{ 0x296c, 0x0 },  /* rharul */
+	{ 0x3c1, 0x0 },  /* rho */
+	{ 0x3f1, 0x0 },  /* rhov */
+	{ 0x2192, 0x0 },  /* rightarrow */
+	{ 0x21a3, 0x0 },  /* rightarrowtail */
+	{ 0x21c1, 0x0 },  /* rightharpoondown */
+	{ 0x21c0, 0x0 },  /* rightharpoonup */
+	{ 0x21c4, 0x0 },  /* rightleftarrows */
+	{ 0x21cc, 0x0 },  /* rightleftharpoons */
+	{ 0x21c9, 0x0 },  /* rightrightarrows */
+	{ 0x219d, 0x0 },  /* rightsquigarrow */
+	{ 0x22cc, 0x0 },  /* rightthreetimes */
+	{ 0x2da, 0x0 },  /* ring */
+	{ 0x2253, 0x0 },  /* risingdotseq */
+	{ 0x21c4, 0x0 },  /* rlarr */
+	{ 0x21cc, 0x0 },  /* rlhar */
+	{ 0x200f, 0x0 },  /* rlm */
+	{ 0x23b1, 0x0 },  /* rmoust */
+	{ 0x23b1, 0x0 },  /* rmoustache */
+	{ 0x2aee, 0x0 },  /* rnmid */
+	{ 0x27ed, 0x0 },  /* roang */
+	{ 0x21fe, 0x0 },  /* roarr */
+	{ 0x27e7, 0x0 },  /* robrk */
+	{ 0x2986, 0x0 },  /* ropar */
+	{ 0x1d563, 0x0 },  /* ropf */
+	{ 0x2a2e, 0x0 },  /* roplus */
+	{ 0x2a35, 0x0 },  /* rotimes */
+	{ 0x29, 0x0 },  /* rpar */
+	{ 0x2994, 0x0 },  /* rpargt */
+	{ 0x2a12, 0x0 },  /* rppolint */
+	{ 0x21c9, 0x0 },  /* rrarr */
+	{ 0x203a, 0x0 },  /* rsaquo */
+	{ 0x1d4c7, 0x0 },  /* rscr */
+	{ 0x21b1, 0x0 },  /* rsh */
+	{ 0x5d, 0x0 },  /* rsqb */
+	{ 0x2019, 0x0 },  /* rsquo */
+	{ 0x2019, 0x0 },  /* rsquor */
+	{ 0x22cc, 0x0 },  /* rthree */
+	{ 0x22ca, 0x0 },  /* rtimes */
+	{ 0x25b9, 0x0 },  /* rtri */
+	{ 0x22b5, 0x0 },  /* rtrie */
+	{ 0x25b8, 0x0 },  /* rtrif */
+	{ 0x29ce, 0x0 },  /* rtriltri */
+	{ 0x2968, 0x0 },  /* ruluhar */
+	{ 0x211e, 0x0 },  /* rx */
+	{ 0x15b, 0x0 },  /* sacute */
+	{ 0x201a, 0x0 },  /* sbquo */
+	{ 0x227b, 0x0 },  /* sc */
+	{ 0x2ab4, 0x0 },  /* scE */
+	{ 0x2ab8, 0x0 },  /* scap */
+	{ 0x161, 0x0 },  /* scaron */
+	{ 0x227d, 0x0 },  /* sccue */
+	{ 0x2ab0, 0x0 },  /* sce */
+	{ 0x15f, 0x0 },  /* scedil */
+	{ 0x15d, 0x0 },  /* scirc */
+	{ 0x2ab6, 0x0 },  /* scnE */
+	{ 0x2aba, 0x0 },  /* scnap */
+	{ 0x22e9, 0x0 },  /* scnsim */
+	{ 0x2a13, 0x0 },  /* scpolint */
+	{ 0x227f, 0x0 },  /* scsim */
+	{ 0x441, 0x0 },  /* scy */
+	{ 0x22c5, 0x0 },  /* sdot */
+	{ 0x22a1, 0x0 },  /* sdotb */
+	{ 0x2a66, 0x0 },  /* sdote */
+	{ 0x21d8, 0x0 },  /* seArr */
+	{ 0x2925, 0x0 },  /* searhk */
+	{ 0x2198, 0x0 },  /* searr */
+	{ 0x2198, 0x0 },  /* searrow */
+	{ 0xa7, 0x0 },  /* sect */
+	{ 0x3b, 0x0 },  /* semi */
+	{ 0x2929, 0x0 },  /* seswar */
+	{ 0x2216, 0x0 },  /* setminus */
+	{ 0x2216, 0x0 },  /* setmn */
+	{ 0x2736, 0x0 },  /* sext */
+	{ 0x1d530, 0x0 },  /* sfr */
+	{ 0x2322, 0x0 },  /* sfrown */
+	{ 0x266f, 0x0 },  /* sharp */
+	{ 0x449, 0x0 },  /* shchcy */
+	{ 0x448, 0x0 },  /* shcy */
+	{ 0x2223, 0x0 },  /* shortmid */
+	{ 0x2225, 0x0 },  /* shortparallel */
+	{ 0xad, 0x0 },  /* shy */
+	{ 0x3c3, 0x0 },  /* sigma */
+	{ 0x3c2, 0x0 },  /* sigmaf */
+	{ 0x3c2, 0x0 },  /* sigmav */
+	{ 0x223c, 0x0 },  /* sim */
+	{ 0x2a6a, 0x0 },  /* simdot */
+	{ 0x2243, 0x0 },  /* sime */
+	{ 0x2243, 0x0 },  /* simeq */
+	{ 0x2a9e, 0x0 },  /* simg */
+	{ 0x2aa0, 0x0 },  /* simgE */
+	{ 0x2a9d, 0x0 },  /* siml */
+	{ 0x2a9f, 0x0 },  /* simlE */
+	{ 0x2246, 0x0 },  /* simne */
+	{ 0x2a24, 0x0 },  /* simplus */
+	{ 0x2972, 0x0 },  /* simrarr */
+	{ 0x2190, 0x0 },  /* slarr */
+	{ 0x2216, 0x0 },  /* smallsetminus */
+	{ 0x2a33, 0x0 },  /* smashp */
+	{ 0x29e4, 0x0 },  /* smeparsl */
+	{ 0x2223, 0x0 },  /* smid */
+	{ 0x2323, 0x0 },  /* smile */
+	{ 0x2aaa, 0x0 },  /* smt */
+	{ 0x2aac, 0x0 },  /* smte */
+	{ 0x2aac, 0xfe00 },  /* smtes */
+	{ 0x44c, 0x0 },  /* softcy */
+	{ 0x2f, 0x0 },  /* sol */
+	{ 0x29c4, 0x0 },  /* solb */
+	{ 0x233f, 0x0 },  /* solbar */
+	{ 0x1d564, 0x0 },  /* sopf */
+	{ 0x2660, 0x0 },  /* spades */
+	{ 0x2660, 0x0 },  /* spadesuit */
+	{ 0x2225, 0x0 },  /* spar */
+	{ 0x2293, 0x0 },  /* sqcap */
+	{ 0x2293, 0xfe00 },  /* sqcaps */
+	{ 0x2294, 0x0 },  /* sqcup */
+	{ 0x2294, 0xfe00 },  /* sqcups */
+	{ 0x228f, 0x0 },  /* sqsub */
+	{ 0x2291, 0x0 },  /* sqsube */
+	{ 0x228f, 0x0 },  /* sqsubset */
+	{ 0x2291, 0x0 },  /* sqsubseteq */
+	{ 0x2290, 0x0 },  /* sqsup */
+	{ 0x2292, 0x0 },  /* sqsupe */
+	{ 0x2290, 0x0 },  /* sqsupset */
+	{ 0x2292, 0x0 },  /* sqsupseteq */
+	{ 0x25a1, 0x0 },  /* squ */
+	{ 0x25a1, 0x0 },  /* square */
+	{ 0x25aa, 0x0 },  /* squarf */
+	{ 0x25aa, 0x0 },  /* squf */
+	{ 0x2192, 0x0 },  /* srarr */
+	{ 0x1d4c8, 0x0 },  /* sscr */
+	{ 0x2216, 0x0 },  /* ssetmn */
+	{ 0x2323, 0x0 },  /* ssmile */
+	{ 0x22c6, 0x0 },  /* sstarf */
+	{ 0x2606, 0x0 },  /* star */
+	{ 0x2605, 0x0 },  /* starf */
+	{ 0x3f5, 0x0 },  /* straightepsilon */
+	{ 0x3d5, 0x0 },  /* straightphi */
+	{ 0xaf, 0x0 },  /* strns */
+	{ 0x2282, 0x0 },  /* sub */
+	{ 0x2ac5, 0x0 },  /* subE */
+	{ 0x2abd, 0x0 },  /* subdot */
+	{ 0x2286, 0x0 },  /* sube */
+	{ 0x2ac3, 0x0 },  /* subedot */
+	{ 0x2ac1, 0x0 },  /* submult */
+	{ 0x2acb, 0x0 },  /* subnE */
+	{ 0x228a, 0x0 },  /* subne */
+	{ 0x2abf, 0x0 },  /* subplus */
+	{ 0x2979, 0x0 },  /* subrarr */
+	{ 0x2282, 0x0 },  /* subset */
+	{ 0x2286, 0x0 },  /* subseteq */
+	{ 0x2ac5, 0x0 },  /* subseteqq */
+	{ 0x228a, 0x0 },  /* subsetneq */
+	{ 0x2acb, 0x0 },  /* subsetneqq */
+	{ 0x2ac7, 0x0 },  /* subsim */
+	{ 0x2ad5, 0x0 },  /* subsub */
+	{ 0x2ad3, 0x0 },  /* subsup */
+	{ 0x227b, 0x0 },  /* succ */
+	{ 0x2ab8, 0x0 },  /* succapprox */
+	{ 0x227d, 0x0 },  /* succcurlyeq */
+	{ 0x2ab0, 0x0 },  /* succeq */
+	{ 0x2aba, 0x0 },  /* succnapprox */
+	{ 0x2ab6, 0x0 },  /* succneqq */
+	{ 0x22e9, 0x0 },  /* succnsim */
+	{ 0x227f, 0x0 },  /* succsim */
+	{ 0x2211, 0x0 },  /* sum */
+	{ 0x266a, 0x0 },  /* sung */
+	{ 0x2283, 0x0 },  /* sup */
+	{ 0xb9, 0x0 },  /* sup1 */
+	{ 0xb2, 0x0 },  /* sup2 */
+	{ 0xb3, 0x0 },  /* sup3 */
+	{ 0x2ac6, 0x0 },  /* supE */
+	{ 0x2abe, 0x0 },  /* supdot */
+	{ 0x2ad8, 0x0 },  /* supdsub */
+	{ 0x2287, 0x0 },  /* supe */
+	{ 0x2ac4, 0x0 },  /* supedot */
+	{ 0x27c9, 0x0 },  /* suphsol */
+	{ 0x2ad7, 0x0 },  /* suphsub */
+	{ 0x297b, 0x0 },  /* suplarr */
+	{ 0x2ac2, 0x0 },  /* supmult */
+	{ 0x2acc, 0x0 },  /* supnE */
+	{ 0x228b, 0x0 },  /* supne */
+	{ 0x2ac0, 0x0 },  /* supplus */
+	{ 0x2283, 0x0 },  /* supset */
+	{ 0x2287, 0x0 },  /* supseteq */
+	{ 0x2ac6, 0x0 },  /* supseteqq */
+	{ 0x228b, 0x0 },  /* supsetneq */
+	{ 0x2acc, 0x0 },  /* supsetneqq */
+	{ 0x2ac8, 0x0 },  /* supsim */
+	{ 0x2ad4, 0x0 },  /* supsub */
+	{ 0x2ad6, 0x0 },  /* supsup */
+	{ 0x21d9, 0x0 },  /* swArr */
+	{ 0x2926, 0x0 },  /* swarhk */
+	{ 0x2199, 0x0 },  /* swarr */
+	{ 0x2199, 0x0 },  /* swarrow */
+	{ 0x292a, 0x0 },  /* swnwar */
+	{ 0xdf, 0x0 },  /* szlig */
+	{ 0x2316, 0x0 },  /* target */
+	{ 0x3c4, 0x0 },  /* tau */
+	{ 0x23b4, 0x0 },  /* tbrk */
+	{ 0x165, 0x0 },  /* tcaron */
+	{ 0x163, 0x0 },  /* tcedil */
+	{ 0x442, 0x0 },  /* tcy */
+	{ 0x20db, 0x0 },  /* tdot */
+	{ 0x2315, 0x0 },  /* telrec */
+	{ 0x1d531, 0x0 },  /* tfr */
+	{ 0x2234, 0x0 },  /* there4 */
+	{ 0x2234, 0x0 },  /* therefore */
+	{ 0x3b8, 0x0 },  /* theta */
+	{ 0x3d1, 0x0 },  /* thetasym */
+	{ 0x3d1, 0x0 },  /* thetav */
+	{ 0x2248, 0x0 },  /* thickapprox */
+	{ 0x223c, 0x0 },  /* thicksim */
+	{ 0x2009, 0x0 },  /* thinsp */
+	{ 0x2248, 0x0 },  /* thkap */
+	{ 0x223c, 0x0 },  /* thksim */
+	{ 0xfe, 0x0 },  /* thorn */
+	{ 0x2dc, 0x0 },  /* tilde */
+	{ 0xd7, 0x0 },  /* times */
+	{ 0x22a0, 0x0 },  /* timesb */
+	{ 0x2a31, 0x0 },  /* timesbar */
+	{ 0x2a30, 0x0 },  /* timesd */
+	{ 0x222d, 0x0 },  /* tint */
+	{ 0x2928, 0x0 },  /* toea */
+	{ 0x22a4, 0x0 },  /* top */
+	{ 0x2336, 0x0 },  /* topbot */
+	{ 0x2af1, 0x0 },  /* topcir */
+	{ 0x1d565, 0x0 },  /* topf */
+	{ 0x2ada, 0x0 },  /* topfork */
+	{ 0x2929, 0x0 },  /* tosa */
+	{ 0x2034, 0x0 },  /* tprime */
+	{ 0x2122, 0x0 },  /* trade */
+	{ 0x25b5, 0x0 },  /* triangle */
+	{ 0x25bf, 0x0 },  /* triangledown */
+	{ 0x25c3, 0x0 },  /* triangleleft */
+	{ 0x22b4, 0x0 },  /* trianglelefteq */
+	{ 0x225c, 0x0 },  /* triangleq */
+	{ 0x25b9, 0x0 },  /* triangleright */
+	{ 0x22b5, 0x0 },  /* trianglerighteq */
+	{ 0x25ec, 0x0 },  /* tridot */
+	{ 0x225c, 0x0 },  /* trie */
+	{ 0x2a3a, 0x0 },  /* triminus */
+	{ 0x2a39, 0x0 },  /* triplus */
+	{ 0x29cd, 0x0 },  /* trisb */
+	{ 0x2a3b, 0x0 },  /* tritime */
+	{ 0x23e2, 0x0 },  /* trpezium */
+	{ 0x1d4c9, 0x0 },  /* tscr */
+	{ 0x446, 0x0 },  /* tscy */
+	{ 0x45b, 0x0 },  /* tshcy */
+	{ 0x167, 0x0 },  /* tstrok */
+	{ 0x226c, 0x0 },  /* twixt */
+	{ 0x219e, 0x0 },  /* twoheadleftarrow */
+	{ 0x21a0, 0x0 },  /* twoheadrightarrow */
+	{ 0x21d1, 0x0 },  /* uArr */
+	{ 0x2963, 0x0 },  /* uHar */
+	{ 0xfa, 0x0 },  /* uacute */
+	{ 0x2191, 0x0 },  /* uarr */
+	{ 0x45e, 0x0 },  /* ubrcy */
+	{ 0x16d, 0x0 },  /* ubreve */
+	{ 0xfb, 0x0 },  /* ucirc */
+	{ 0x443, 0x0 },  /* ucy */
+	{ 0x21c5, 0x0 },  /* udarr */
+	{ 0x171, 0x0 },  /* udblac */
+	{ 0x296e, 0x0 },  /* udhar */
+	{ 0x297e, 0x0 },  /* ufisht */
+	{ 0x1d532, 0x0 },  /* ufr */
+	{ 0xf9, 0x0 },  /* ugrave */
+	{ 0x21bf, 0x0 },  /* uharl */
+	{ 0x21be, 0x0 },  /* uharr */
+	{ 0x2580, 0x0 },  /* uhblk */
+	{ 0x231c, 0x0 },  /* ulcorn */
+	{ 0x231c, 0x0 },  /* ulcorner */
+	{ 0x230f, 0x0 },  /* ulcrop */
+	{ 0x25f8, 0x0 },  /* ultri */
+	{ 0x16b, 0x0 },  /* umacr */
+	{ 0xa8, 0x0 },  /* uml */
+	{ 0x173, 0x0 },  /* uogon */
+	{ 0x1d566, 0x0 },  /* uopf */
+	{ 0x2191, 0x0 },  /* uparrow */
+	{ 0x2195, 0x0 },  /* updownarrow */
+	{ 0x21bf, 0x0 },  /* upharpoonleft */
+	{ 0x21be, 0x0 },  /* upharpoonright */
+	{ 0x228e, 0x0 },  /* uplus */
+	{ 0x3c5, 0x0 },  /* upsi */
+	{ 0x3d2, 0x0 },  /* upsih */
+	{ 0x3c5, 0x0 },  /* upsilon */
+	{ 0x21c8, 0x0 },  /* upuparrows */
+	{ 0x231d, 0x0 },  /* urcorn */
+	{ 0x231d, 0x0 },  /* urcorner */
+	{ 0x230e, 0x0 },  /* urcrop */
+	{ 0x16f, 0x0 },  /* uring */
+	{ 0x25f9, 0x0 },  /* urtri */
+	{ 0x1d4ca, 0x0 },  /* uscr */
+	{ 0x22f0, 0x0 },  /* utdot */
+	{ 0x169, 0x0 },  /* utilde */
+	{ 0x25b5, 0x0 },  /* utri */
+	{ 0x25b4, 0x0 },  /* utrif */
+	{ 0x21c8, 0x0 },  /* uuarr */
+	{ 0xfc, 0x0 },  /* uuml */
+	{ 0x29a7, 0x0 },  /* uwangle */
+	{ 0x21d5, 0x0 },  /* vArr */
+	{ 0x2ae8, 0x0 },  /* vBar */
+	{ 0x2ae9, 0x0 },  /* vBarv */
+	{ 0x22a8, 0x0 },  /* vDash */
+	{ 0x299c, 0x0 },  /* vangrt */
+	{ 0x3f5, 0x0 },  /* varepsilon */
+	{ 0x3f0, 0x0 },  /* varkappa */
+	{ 0x2205, 0x0 },  /* varnothing */
+	{ 0x3d5, 0x0 },  /* varphi */
+	{ 0x3d6, 0x0 },  /* varpi */
+	{ 0x221d, 0x0 },  /* varpropto */
+	{ 0x2195, 0x0 },  /* varr */
+	{ 0x3f1, 0x0 },  /* varrho */
+	{ 0x3c2, 0x0 },  /* varsigma */
+	{ 0x228a, 0xfe00 },  /* varsubsetneq */
+	{ 0x2acb, 0xfe00 },  /* varsubsetneqq */
+	{ 0x228b, 0xfe00 },  /* varsupsetneq */
+	{ 0x2acc, 0xfe00 },  /* varsupsetneqq */
+	{ 0x3d1, 0x0 },  /* vartheta */
+	{ 0x22b2, 0x0 },  /* vartriangleleft */
+	{ 0x22b3, 0x0 },  /* vartriangleright */
+	{ 0x432, 0x0 },  /* vcy */
+	{ 0x22a2, 0x0 },  /* vdash */
+	{ 0x2228, 0x0 },  /* vee */
+	{ 0x22bb, 0x0 },  /* veebar */
+	{ 0x225a, 0x0 },  /* veeeq */
+	{ 0x22ee, 0x0 },  /* vellip */
+	{ 0x7c, 0x0 },  /* verbar */
+	{ 0x7c, 0x0 },  /* vert */
+	{ 0x1d533, 0x0 },  /* vfr */
+	{ 0x22b2, 0x0 },  /* vltri */
+	{ 0x2282, 0x20d2 },  /* vnsub */
+	{ 0x2283, 0x20d2 },  /* vnsup */
+	{ 0x1d567, 0x0 },  /* vopf */
+	{ 0x221d, 0x0 },  /* vprop */
+	{ 0x22b3, 0x0 },  /* vrtri */
+	{ 0x1d4cb, 0x0 },  /* vscr */
+	{ 0x2acb, 0xfe00 },  /* vsubnE */
+	{ 0x228a, 0xfe00 },  /* vsubne */
+	{ 0x2acc, 0xfe00 },  /* vsupnE */
+	{ 0x228b, 0xfe00 },  /* vsupne */
+	{ 0x299a, 0x0 },  /* vzigzag */
+	{ 0x175, 0x0 },  /* wcirc */
+	{ 0x2a5f, 0x0 },  /* wedbar */
+	{ 0x2227, 0x0 },  /* wedge */
+	{ 0x2259, 0x0 },  /* wedgeq */
+	{ 0x2118, 0x0 },  /* weierp */
+	{ 0x1d534, 0x0 },  /* wfr */
+	{ 0x1d568, 0x0 },  /* wopf */
+	{ 0x2118, 0x0 },  /* wp */
+	{ 0x2240, 0x0 },  /* wr */
+	{ 0x2240, 0x0 },  /* wreath */
+	{ 0x1d4cc, 0x0 },  /* wscr */
+	{ 0x22c2, 0x0 },  /* xcap */
+	{ 0x25ef, 0x0 },  /* xcirc */
+	{ 0x22c3, 0x0 },  /* xcup */
+	{ 0x25bd, 0x0 },  /* xdtri */
+	{ 0x1d535, 0x0 },  /* xfr */
+	{ 0x27fa, 0x0 },  /* xhArr */
+	{ 0x27f7, 0x0 },  /* xharr */
+	{ 0x3be, 0x0 },  /* xi */
+	{ 0x27f8, 0x0 },  /* xlArr */
+	{ 0x27f5, 0x0 },  /* xlarr */
+	{ 0x27fc, 0x0 },  /* xmap */
+	{ 0x22fb, 0x0 },  /* xnis */
+	{ 0x2a00, 0x0 },  /* xodot */
+	{ 0x1d569, 0x0 },  /* xopf */
+	{ 0x2a01, 0x0 },  /* xoplus */
+	{ 0x2a02, 0x0 },  /* xotime */
+	{ 0x27f9, 0x0 },  /* xrArr */
+	{ 0x27f6, 0x0 },  /* xrarr */
+	{ 0x1d4cd, 0x0 },  /* xscr */
+	{ 0x2a06, 0x0 },  /* xsqcup */
+	{ 0x2a04, 0x0 },  /* xuplus */
+	{ 0x25b3, 0x0 },  /* xutri */
+	{ 0x22c1, 0x0 },  /* xvee */
+	{ 0x22c0, 0x0 },  /* xwedge */
+	{ 0xfd, 0x0 },  /* yacute */
+	{ 0x44f, 0x0 },  /* yacy */
+	{ 0x177, 0x0 },  /* ycirc */
+	{ 0x44b, 0x0 },  /* ycy */
+	{ 0xa5, 0x0 },  /* yen */
+	{ 0x1d536, 0x0 },  /* yfr */
+	{ 0x457, 0x0 },  /* yicy */
+	{ 0x1d56a, 0x0 },  /* yopf */
+	{ 0x1d4ce, 0x0 },  /* yscr */
+	{ 0x44e, 0x0 },  /* yucy */
+	{ 0xff, 0x0 },  /* yuml */
+	{ 0x17a, 0x0 },  /* zacute */
+	{ 0x17e, 0x0 },  /* zcaron */
+	{ 0x437, 0x0 },  /* zcy */
+	{ 0x17c, 0x0 },  /* zdot */
+	{ 0x2128, 0x0 },  /* zeetrf */
+	{ 0x3b6, 0x0 },  /* zeta */
+	{ 0x1d537, 0x0 },  /* zfr */
+	{ 0x436, 0x0 },  /* zhcy */
+	{ 0x21dd, 0x0 },  /* zigrarr */
+	{ 0x1d56b, 0x0 },  /* zopf */
+	{ 0x1d4cf, 0x0 },  /* zscr */
+	{ 0x200d, 0x0 },  /* zwj */
+	{ 0x200c, 0x0 },  /* zwnj */
+};
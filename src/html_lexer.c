@@ -7,374 +7,870 @@
 
 #include <html_lexer.h>
 #include <html_parser.h>
+#include <html_names_table.h>
+#include <html_chars_table.h>
+#include <html_entities_table.h>
 
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 enum {
-	KEYWORD_HTML,
-	KEYWORD_DATA,
-	KEYWORD_INCLUDE,
 	KEYWORD_SCRIPT_START,
 	KEYWORD_SCRIPT_END,
 	KEYWORD_STYLE_START,
 	KEYWORD_STYLE_END,
+	KEYWORD_TEXTAREA_START,
+	KEYWORD_TEXTAREA_END,
+	KEYWORD_TITLE_START,
+	KEYWORD_TITLE_END,
 	KEYWORD_COMMENT_START,
 	KEYWORD_COMMENT_END,
+	KEYWORD_CDATA_START,
+	KEYWORD_CDATA_END,
+	KEYWORD_BOUNDARY,
 	KEYWORD_END
 };
 
-typedef uint8_t keyword_id_t;
+/* Must be larger than the longest keyword */
+#define KEYWORD_MAX_SIZE 16
+
+/* in code units, the most that a character spans in any encoding */
+#define UTF8_MAX_SIZE 4
 
+/* How read_token recognizes the token that starts with a given character */
 enum {
-	CHAR_INFO_IDENTIFIER = 1 << 0,
-	CHAR_INFO_NUMBER     = 1 << 1,
-	CHAR_INFO_NOT_TEXT   = 1 << 2,
-	CHAR_INFO_WHITESPACE = 1 << 3
+	DISPATCH_TEXT,
+	DISPATCH_WHITESPACE,
+	DISPATCH_IDENTIFIER,
+	DISPATCH_STRING,
+	DISPATCH_CHAR,
+	DISPATCH_MARKUP,
+	DISPATCH_ENTITY
 };
 
-struct html_lexer_t {
-	const utf32_t *restrict current;
-	const utf32_t *restrict end;
+struct char_dispatch_t {
+	uint8_t type;
+
+	/* the token of DISPATCH_CHAR */
+	uint8_t arg;
+};
 
-	/* tokens */
-	struct html_tokens_t *restrict tokens;
+/* The keywords are spelled out character by character so that the same
+ * initializer fills the constant keyword table of every code unit width
+ */
+#define KEYWORD_DATA_INITIALIZER { \
+	[KEYWORD_SCRIPT_START]   = { '<', 's', 'c', 'r', 'i', 'p', 't' }, \
+	[KEYWORD_SCRIPT_END]     = { '<', '/', 's', 'c', 'r', 'i', 'p', 't', '>' }, \
+	[KEYWORD_STYLE_START]    = { '<', 's', 't', 'y', 'l', 'e' }, \
+	[KEYWORD_STYLE_END]      = { '<', '/', 's', 't', 'y', 'l', 'e', '>' }, \
+	[KEYWORD_TEXTAREA_START] = { '<', 't', 'e', 'x', 't', 'a', 'r', 'e', 'a' }, \
+	[KEYWORD_TEXTAREA_END]   = { '<', '/', 't', 'e', 'x', 't', 'a', 'r', 'e', 'a', '>' }, \
+	[KEYWORD_TITLE_START]    = { '<', 't', 'i', 't', 'l', 'e' }, \
+	[KEYWORD_TITLE_END]      = { '<', '/', 't', 'i', 't', 'l', 'e', '>' }, \
+	[KEYWORD_COMMENT_START]  = { '<', '!', '-', '-' }, \
+	[KEYWORD_COMMENT_END]    = { '-', '-', '>' }, \
+	[KEYWORD_CDATA_START]    = { '<', '!', '[', 'C', 'D', 'A', 'T', 'A', '[' }, \
+	[KEYWORD_CDATA_END]      = { ']', ']', '>' }, \
+	[KEYWORD_BOUNDARY]       = { '\n', '<' }, \
+}
 
-	/* keywords */
-	utf32_t *restrict keyword_data[KEYWORD_END];
-	size_t keyword_size[KEYWORD_END];
+static const uint8_t keyword_size[KEYWORD_END] = {
+	[KEYWORD_SCRIPT_START]   = 7,
+	[KEYWORD_SCRIPT_END]     = 9,
+	[KEYWORD_STYLE_START]    = 6,
+	[KEYWORD_STYLE_END]      = 8,
+	[KEYWORD_TEXTAREA_START] = 9,
+	[KEYWORD_TEXTAREA_END]   = 11,
+	[KEYWORD_TITLE_START]    = 6,
+	[KEYWORD_TITLE_END]      = 8,
+	[KEYWORD_COMMENT_START]  = 4,
+	[KEYWORD_COMMENT_END]    = 3,
+	[KEYWORD_CDATA_START]    = 9,
+	[KEYWORD_CDATA_END]      = 3,
+	[KEYWORD_BOUNDARY]       = 2,
+};
 
-	/* lookup table for common characters */
-	uint8_t char_info[128];
+/* The leading characters of each keyword that precede its first letter.
+ * Case folding leaves them alone, so they are searched for exactly. Only
+ * tag names are case-insensitive, and the other keywords are exact in full.
+ */
+static const uint8_t keyword_exact_size[KEYWORD_END] = {
+	[KEYWORD_SCRIPT_START]   = 1,
+	[KEYWORD_SCRIPT_END]     = 2,
+	[KEYWORD_STYLE_START]    = 1,
+	[KEYWORD_STYLE_END]      = 2,
+	[KEYWORD_TEXTAREA_START] = 1,
+	[KEYWORD_TEXTAREA_END]   = 2,
+	[KEYWORD_TITLE_START]    = 1,
+	[KEYWORD_TITLE_END]      = 2,
+	[KEYWORD_COMMENT_START]  = 4,
+	[KEYWORD_COMMENT_END]    = 3,
+	[KEYWORD_CDATA_START]    = 9,
+	[KEYWORD_CDATA_END]      = 3,
+	[KEYWORD_BOUNDARY]       = 2,
+};
 
-	/* parsing error handling */
-	const char *restrict exception_msg;
-	const utf32_t *restrict exception_location;
+/* the keywords narrowed to bytes, which case folded input is compared to */
+static const uint8_t keyword_bytes[KEYWORD_END][KEYWORD_MAX_SIZE] = KEYWORD_DATA_INITIALIZER;
 
-	/* flags */
-	unsigned int exception_pending :1;
+/* The elements whose content is raw text, which is not markup and lasts
+ * until the end tag of the element. The open tag is lexed like any other,
+ * and the content up to the end tag, which the keyword search finds, becomes
+ * one token that carries the name of the element. Textarea and title are
+ * escapable raw text: their character references and template variables are
+ * lexed as usual, and only the runs between them are raw text tokens.
+ *
+ * Pre and template are not raw text: the content of a pre element is
+ * markup, like the highlighted code of a listing, and the content of a
+ * template is parsed like any other. They are lexed token by token.
+ */
+struct raw_text_element_t {
+	uint8_t keyword_begin;
+	uint8_t keyword_end;
+	html_token_id_t token_id;
+	html_name_id_t name;
+	uint8_t escapable;
 };
 
-static int read_token(struct html_lexer_t *restrict lexer);
-static int read_token_identifier(struct html_lexer_t *restrict lexer);
-static int read_token_text(struct html_lexer_t *restrict lexer);
-static int read_token_whitespace(struct html_lexer_t *restrict lexer);
-static int read_token_char(struct html_lexer_t *restrict lexer, char ch, html_token_id_t token_id);
-static int read_token_keyword(
-		struct html_lexer_t *restrict lexer, keyword_id_t keyword_id, html_token_id_t token_id);
-static int read_token_string(struct html_lexer_t *restrict lexer);
-static int read_token_cdata(
-		struct html_lexer_t *restrict lexer, size_t keyword_begin, size_t keyword_end,
-		html_token_id_t token_id);
-static void add_token(
-		struct html_lexer_t *restrict lexer, html_token_id_t id,
-		const utf32_t *begin, const utf32_t *end);
-
-static inline int char_type_check(struct html_lexer_t *restrict lexer, utf32_t ch, int flags)
-{
-	// TODO: make this bound check branchless
-	if (ch > 127)
-		return 0;
+static const struct raw_text_element_t raw_text_elements[] = {
+	{ KEYWORD_SCRIPT_START,   KEYWORD_SCRIPT_END,   HTML_TOKEN_SCRIPT,   HTML_NAME_SCRIPT,   0 },
+	{ KEYWORD_STYLE_START,    KEYWORD_STYLE_END,    HTML_TOKEN_STYLE,    HTML_NAME_STYLE,    0 },
+	{ KEYWORD_TEXTAREA_START, KEYWORD_TEXTAREA_END, HTML_TOKEN_TEXTAREA, HTML_NAME_TEXTAREA, 1 },
+	{ KEYWORD_TITLE_START,    KEYWORD_TITLE_END,    HTML_TOKEN_TITLE,    HTML_NAME_TITLE,    1 },
+};
 
-	return lexer->char_info[ch] & flags;
-}
+#define RAW_TEXT_ELEMENT_COUNT (sizeof(raw_text_elements) / sizeof(raw_text_elements[0]))
 
-int html_lex(
-		const utf32_t *restrict in_data, size_t in_size, struct html_tokens_t *restrict tokens)
-{
-	struct html_lexer_t lexer = {0};
-	int processed, rc = 0, i;
+/* The ASCII characters that are not listed here start text. Non-ASCII
+ * characters start identifiers or text by their CHAR_INFO flags.
+ */
+static const struct char_dispatch_t char_dispatch[128] = {
+	['\t'] = { DISPATCH_WHITESPACE },
+	['\n'] = { DISPATCH_WHITESPACE },
+	['\r'] = { DISPATCH_WHITESPACE },
+	[' ']  = { DISPATCH_WHITESPACE },
+
+	['<']  = { DISPATCH_MARKUP },
+	['\''] = { DISPATCH_STRING },
+	['"']  = { DISPATCH_STRING },
+
+	['>']  = { DISPATCH_CHAR, HTML_TOKEN_GREATERTHAN },
+	['&']  = { DISPATCH_ENTITY },
+	['!']  = { DISPATCH_CHAR, HTML_TOKEN_EXCLAMATIONMARK },
+	['=']  = { DISPATCH_CHAR, HTML_TOKEN_EQUAL },
+	['-']  = { DISPATCH_CHAR, HTML_TOKEN_HYPHEN },
+	[':']  = { DISPATCH_CHAR, HTML_TOKEN_COLON },
+	['{']  = { DISPATCH_CHAR, HTML_TOKEN_OPENBRACE },
+	['}']  = { DISPATCH_CHAR, HTML_TOKEN_CLOSEBRACE },
+	['(']  = { DISPATCH_CHAR, HTML_TOKEN_OPENPAREN },
+	[')']  = { DISPATCH_CHAR, HTML_TOKEN_CLOSEPAREN },
+	[';']  = { DISPATCH_CHAR, HTML_TOKEN_SEMICOLON },
+	['*']  = { DISPATCH_CHAR, HTML_TOKEN_ASTERISK },
+	['#']  = { DISPATCH_CHAR, HTML_TOKEN_HASH },
+	[',']  = { DISPATCH_CHAR, HTML_TOKEN_COMMA },
+	['/']  = { DISPATCH_CHAR, HTML_TOKEN_SLASH },
+
+	['A' ... 'Z'] = { DISPATCH_IDENTIFIER },
+	['_']         = { DISPATCH_IDENTIFIER },
+	['a' ... 'z'] = { DISPATCH_IDENTIFIER },
+};
 
-	lexer.tokens = tokens;
+/* An identifier that spells a keyword becomes the keyword token */
+static const html_token_id_t keyword_token[HTML_NAME_KEYWORD_LAST + 1] = {
+	[HTML_NAME_UNKNOWN] = HTML_TOKEN_IDENTIFIER,
+	[HTML_NAME_HTML]    = HTML_TOKEN_HTML,
+	[HTML_NAME_DATA]    = HTML_TOKEN_DATA,
+	[HTML_NAME_INCLUDE] = HTML_TOKEN_INCLUDE,
+};
 
-	/* prepare character info table */
-	memset(&lexer.char_info, 0, sizeof(lexer.char_info));
-	lexer.char_info['\n'] = CHAR_INFO_WHITESPACE;
-	lexer.char_info[' '] = CHAR_INFO_WHITESPACE;
-	lexer.char_info['\r'] = CHAR_INFO_WHITESPACE;
-	lexer.char_info['\t'] = CHAR_INFO_WHITESPACE;
+/* Numeric character references to the C1 controls stand for the characters
+ * that Windows-1252 puts there, as the HTML standard specifies. Zero entries
+ * stand for themselves.
+ */
+static const uint16_t windows_1252_c1[32] = {
+	0x20ac, 0,      0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0,      0x017d, 0,
+	0,      0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0,      0x017e, 0x0178,
+};
 
-	/* HTML special characters */
-	lexer.char_info['<'] = CHAR_INFO_NOT_TEXT;
-	lexer.char_info['>'] = CHAR_INFO_NOT_TEXT;
-	lexer.char_info['&'] = CHAR_INFO_NOT_TEXT;
-	lexer.char_info['\''] = CHAR_INFO_NOT_TEXT;
-	lexer.char_info['"'] = CHAR_INFO_NOT_TEXT;
+/* Returns the CHAR_INFO flags of code point 'ch' among 'flags'. Code points
+ * past U+10FFFF have the flags of the last block, which are zero.
+ */
+static inline int char_type_check(uint32_t ch, int flags)
+{
+	uint32_t block = ch >> CHAR_INFO_BLOCK_BITS;
 
-	lexer.char_info['{'] = CHAR_INFO_NOT_TEXT;
-	lexer.char_info['}'] = CHAR_INFO_NOT_TEXT;
-	lexer.char_info['_'] = CHAR_INFO_IDENTIFIER;
+	block = (block < CHAR_INFO_INDEX_SIZE)? block : CHAR_INFO_INDEX_SIZE - 1;
+	return char_info_block[char_info_index[block]][ch & ((1 << CHAR_INFO_BLOCK_BITS) - 1)] & flags;
+}
+
+/* Decodes the UTF-8 sequence at 'p' into '*ch' and returns its size. An
+ * invalid sequence decodes as U+FFFD of one byte. The zero padding after the
+ * input ends any sequence that is cut off.
+ */
+static inline size_t decode_utf8(const uint8_t *p, uint32_t *ch)
+{
+	uint32_t c = p[0];
 
-	for (i='A'; i<='Z'; ++i) {
-		lexer.char_info[i] = CHAR_INFO_IDENTIFIER;
+	if (c < 0x80) {
+		*ch = c;
+		return 1;
 	}
 
-	for (i='a'; i<='z'; ++i) {
-		lexer.char_info[i] = CHAR_INFO_IDENTIFIER;
+	if (c >= 0xc2 && c < 0xe0 && (p[1] & 0xc0) == 0x80) {
+		*ch = ((c & 0x1f) << 6) | (p[1] & 0x3f);
+		return 2;
 	}
 
-	for (i='0'; i<='9'; ++i) {
-		lexer.char_info[i] = CHAR_INFO_NUMBER;
+	if (c >= 0xe0 && c < 0xf0 && (p[1] & 0xc0) == 0x80 && (p[2] & 0xc0) == 0x80) {
+		*ch = ((c & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+
+		if (*ch >= 0x800 && (*ch < 0xd800 || *ch > 0xdfff))
+			return 3;
 	}
 
+	if (c >= 0xf0 && c < 0xf5 && (p[1] & 0xc0) == 0x80 && (p[2] & 0xc0) == 0x80 && (p[3] & 0xc0) == 0x80) {
+		*ch = ((c & 0x07) << 18) | ((p[1] & 0x3f) << 12) | ((p[2] & 0x3f) << 6) | (p[3] & 0x3f);
 
-#define REGISTER_KEYWORD(id,str) unicode_read_ascii_string(str, sizeof(str)-1, lexer.keyword_data+id, lexer.keyword_size+id)
-	REGISTER_KEYWORD(KEYWORD_HTML,          "html");
-	REGISTER_KEYWORD(KEYWORD_DATA,          "data");
-	REGISTER_KEYWORD(KEYWORD_INCLUDE,       "include");
-	REGISTER_KEYWORD(KEYWORD_SCRIPT_START,  "<script");
-	REGISTER_KEYWORD(KEYWORD_SCRIPT_END,    "</script>");
-	REGISTER_KEYWORD(KEYWORD_STYLE_START,   "<style");
-	REGISTER_KEYWORD(KEYWORD_STYLE_END,     "</style>");
-	REGISTER_KEYWORD(KEYWORD_COMMENT_START, "<!--");
-	REGISTER_KEYWORD(KEYWORD_COMMENT_END,   "-->");
+		if (*ch >= 0x10000 && *ch <= 0x10ffff)
+			return 4;
+	}
 
-	lexer.current = in_data;
-	lexer.end = in_data + in_size;
+	*ch = 0xfffd;
+	return 1;
+}
 
-	/* process all tokens */
-	while (lexer.current < lexer.end) {
-		processed = read_token(&lexer);
+/* Folds an upper case ASCII letter into lower case, and returns any other
+ * character as is
+ */
+static inline uint32_t fold_char(uint32_t ch)
+{
+	return ch | ((ch - 'A' < 26) << 5);
+}
 
-		if (processed) {
-			if (__builtin_expect(lexer.exception_pending, 0))
-				break;
-		}
-		else {
-			lexer.exception_pending = 1;
-			lexer.exception_msg = "Unrecognized token";
-			lexer.exception_location = lexer.current;
-			break;
-		}
-	}
+/* Looks up the name whose characters are packed into 'key1' and 'key2' as in
+ * html_names_table.h. The hash is perfect for the known names, so a single
+ * slot is checked. Unknown names may land on any slot, but their keys differ
+ * from the keys of that slot's name.
+ */
+static inline html_name_id_t lookup_name(uint64_t key1, uint64_t key2)
+{
+	uint64_t x = (key1 ^ (key2 * 0x9e3779b97f4a7c15)) * 0xff51afd7ed558ccd;
+	x ^= x >> 32;
 
-	if (__builtin_expect(lexer.exception_pending, 0)) {
-		const utf32_t *p;
-		int column_num = 0;
-		int line_num = 0;
+	uint64_t disp = html_name_disp[x & ((1 << HTML_NAME_BUCKET_BITS) - 1)];
+	html_name_id_t name = html_name_slot[((x >> 8) + disp * ((x >> 24) | 1)) & ((1 << HTML_NAME_SLOT_BITS) - 1)];
 
-		for (p = in_data; p < lexer.exception_location; ++p) {
-			if (*p != '\n') {
-				++column_num;
-			}
-			else {
-				++line_num;
-				column_num = 0;
-			}
-		}
+	if (html_name_key[name][0] == key1 && html_name_key[name][1] == key2)
+		return name;
+
+	return HTML_NAME_UNKNOWN;
+}
 
-		fprintf(stderr, "html_lex: %s on line %d, column %d\n",
-				lexer.exception_msg, line_num+1, column_num+1);
-		rc = -1;
+/* Looks up the named character reference spelled by the 'size' bytes at
+ * 'name'. Returns its index in html_entities_table.h, or -1 if it is not
+ * one. Like lookup_name, only a single slot is checked.
+ */
+static int lookup_entity(const uint8_t *restrict name, size_t size)
+{
+	uint64_t h = 0xcbf29ce484222325;
+
+	for (size_t i = 0; i < size; ++i)
+		h = (h ^ name[i]) * 0x100000001b3;
+
+	uint64_t x = h ^ (h >> 32);
+	uint64_t disp = html_entity_disp[x & ((1 << HTML_ENTITY_BUCKET_BITS) - 1)];
+	int idx = html_entity_slot[((x >> 16) + disp * ((x >> 40) | 1)) & ((1 << HTML_ENTITY_SLOT_BITS) - 1)] - 1;
+
+	if (idx < 0 || html_entity_size[idx] != size
+			|| memcmp(html_entity_names + html_entity_offset[idx], name, size) != 0)
+		return -1;
+
+	return idx;
+}
+
+/* Character references are ASCII outside of their digits and names */
+static inline int is_ascii_digit(uint32_t ch)
+{
+	return ch - '0' < 10;
+}
+
+static inline int is_ascii_hex_digit(uint32_t ch)
+{
+	return ch - '0' < 10 || (ch | 0x20) - 'a' < 6;
+}
+
+static inline int is_ascii_alnum(uint32_t ch)
+{
+	return ch - '0' < 10 || (ch | 0x20) - 'a' < 26;
+}
+
+/* Reads the code unit at 'p' of an input with 'unit_size' byte units */
+static inline uint32_t load_unit(const char *p, size_t unit_size)
+{
+	switch (unit_size) {
+	case 1:
+		return *(const uint8_t *) p;
+	case 2:
+		return *(const uint16_t *) p;
+	default:
+		return *(const utf32_t *) p;
 	}
+}
 
-	unicode_utf32_string_free(lexer.keyword_data, KEYWORD_END);
-	return rc;
+#if defined(__SSE2__)
+/* 16 bytes loaded from &name_size_mask[16 - n] keep the first n bytes */
+static const uint8_t name_size_mask[32] = {
+	[0 ... 15] = 0xff
+};
+
+/* The run scanners classify 16 characters at a time. The characters are
+ * first narrowed to bytes with saturation: code units above 0xff become 0xff.
+ * The classes match the ASCII characters in char_info_block. Every
+ * non-ASCII code unit has its high bit set, and the scanners look those up
+ * one character at a time.
+ */
+static inline __m128i load_bytes_u8(const uint8_t *p)
+{
+	return _mm_loadu_si128((const __m128i *) p);
 }
 
-static int read_token(struct html_lexer_t *restrict lexer)
-{
-	return
-		   read_token_cdata(lexer, KEYWORD_COMMENT_START, KEYWORD_COMMENT_END, HTML_TOKEN_COMMENT)
-		|| read_token_cdata(lexer, KEYWORD_SCRIPT_START, KEYWORD_SCRIPT_END, HTML_TOKEN_SCRIPT)
-		|| read_token_cdata(lexer, KEYWORD_STYLE_START, KEYWORD_STYLE_END, HTML_TOKEN_STYLE)
-		|| read_token_string(lexer)
-		|| read_token_char(lexer, '>',  HTML_TOKEN_GREATERTHAN)
-		|| read_token_char(lexer, '<',  HTML_TOKEN_LESSTHAN)
-		|| read_token_char(lexer, '\'', HTML_TOKEN_SINGLEQUOTE)
-		|| read_token_char(lexer, '"',  HTML_TOKEN_DOUBLEQUOTE)
-		|| read_token_char(lexer, '&',  HTML_TOKEN_AMPERSAND)
-		|| read_token_char(lexer, '!',  HTML_TOKEN_EXCLAMATIONMARK)
-		|| read_token_char(lexer, '=',  HTML_TOKEN_EQUAL)
-		|| read_token_char(lexer, '-',  HTML_TOKEN_HYPHEN)
-		|| read_token_char(lexer, ':',  HTML_TOKEN_COLON)
-		|| read_token_char(lexer, '{',  HTML_TOKEN_OPENBRACE)
-		|| read_token_char(lexer, '}',  HTML_TOKEN_CLOSEBRACE)
-		|| read_token_char(lexer, '(',  HTML_TOKEN_OPENPAREN)
-		|| read_token_char(lexer, ')',  HTML_TOKEN_CLOSEPAREN)
-		|| read_token_char(lexer, ';',  HTML_TOKEN_SEMICOLON)
-		|| read_token_char(lexer, '*',  HTML_TOKEN_ASTERISK)
-		|| read_token_char(lexer, '#',  HTML_TOKEN_HASH)
-		|| read_token_char(lexer, ',',  HTML_TOKEN_COMMA)
-		|| read_token_char(lexer, '/',  HTML_TOKEN_SLASH)
-		|| read_token_keyword(lexer, KEYWORD_HTML, HTML_TOKEN_HTML)
-		|| read_token_keyword(lexer, KEYWORD_DATA, HTML_TOKEN_DATA)
-		|| read_token_keyword(lexer, KEYWORD_INCLUDE, HTML_TOKEN_INCLUDE)
-		|| read_token_identifier(lexer)
-		|| read_token_whitespace(lexer)
-		|| read_token_text(lexer);
-}
-
-static int read_token_identifier(struct html_lexer_t *restrict lexer)
-{
-	const utf32_t *restrict p = lexer->current;
-
-	if (__builtin_expect(char_type_check(lexer, *p, CHAR_INFO_IDENTIFIER) == 0, 0))
-		return 0;
+static inline __m128i load_bytes_u16(const uint16_t *p)
+{
+	/* packus saturates signed words, so the units are clamped to 0xff first */
+	__m128i lo = _mm_loadu_si128((const __m128i *) p);
+	__m128i hi = _mm_loadu_si128((const __m128i *) (p + 8));
+	__m128i max = _mm_set1_epi16(0xff);
+
+	return _mm_packus_epi16(
+			_mm_sub_epi16(lo, _mm_subs_epu16(lo, max)),
+			_mm_sub_epi16(hi, _mm_subs_epu16(hi, max)));
+}
 
-	++p;
-	while (char_type_check(lexer, *p, CHAR_INFO_IDENTIFIER | CHAR_INFO_NUMBER))
-		++p;
+static inline __m128i load_bytes_u32(const utf32_t *p)
+{
+	return _mm_packus_epi16(
+			_mm_packs_epi32(
+				_mm_loadu_si128((const __m128i *) p),
+				_mm_loadu_si128((const __m128i *) (p + 4))),
+			_mm_packs_epi32(
+				_mm_loadu_si128((const __m128i *) (p + 8)),
+				_mm_loadu_si128((const __m128i *) (p + 12))));
+}
 
-	add_token(lexer, HTML_TOKEN_IDENTIFIER, lexer->current, p);
-	lexer->current = p;
-	return 1;
+static inline __m128i class_in_range(__m128i v, uint8_t lo, uint8_t hi)
+{
+	__m128i d = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+	return _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(hi - lo)), d);
 }
 
-static int read_token_text(struct html_lexer_t *restrict lexer)
+/* Folds the upper case ASCII letters of 'v' into lower case. The narrowed
+ * non-ASCII characters stay outside of 'a' to 'z'.
+ */
+static inline __m128i fold_case(__m128i v)
 {
-	const utf32_t *restrict p = lexer->current;
+	return _mm_or_si128(v, _mm_and_si128(class_in_range(v, 'A', 'Z'), _mm_set1_epi8(0x20)));
+}
 
-	/* According to https://html.spec.whatwg.org/#writing-xhtml-documents, the
-	 * five special characters in HTML are: '<', '>', '&', '\'', '"'.
-	 *
-	 * Since we expect variable references to appear in the text, we will need
-	 * to consider this regex as well: "\s*[{]\s*[A-Za-z_][A-Za-z0-9_]*\s*[}]\s".
-	 * This regex contains the following tokens:
-	 *  - whitespace
-	 *  - open-brace
-	 *  - close-brace
-	 *  - identifier
-	 *
-	 * Since we only care about the start of the next token, we will only consider
-	 * [A-Za-z_] pattern of the identifier token.
-	 */
+/* CHAR_INFO_WHITESPACE */
+static inline __m128i class_whitespace(__m128i v)
+{
+	return _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))),
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))));
+}
 
-	const int flag = CHAR_INFO_NOT_TEXT | CHAR_INFO_WHITESPACE | CHAR_INFO_IDENTIFIER;
+/* CHAR_INFO_IDENTIFIER. Setting bit 5 folds upper case into lower case. */
+static inline __m128i class_identifier(__m128i v)
+{
+	return _mm_or_si128(
+			class_in_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z'),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+}
 
-	while (!char_type_check(lexer, *p, flag))
-		++p;
+/* CHAR_INFO_NUMBER */
+static inline __m128i class_number(__m128i v)
+{
+	return class_in_range(v, '0', '9');
+}
 
-	if (p - lexer->current) {
-		add_token(lexer, HTML_TOKEN_TEXT, lexer->current, p);
-		lexer->current = p;
-		return 1;
+/* CHAR_INFO_NOT_TEXT */
+static inline __m128i class_not_text(__m128i v)
+{
+	__m128i a = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('<')), _mm_cmpeq_epi8(v, _mm_set1_epi8('>')));
+	__m128i b = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('&')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+	__m128i c = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('{')), _mm_cmpeq_epi8(v, _mm_set1_epi8('}')));
+
+	return _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, _mm_cmpeq_epi8(v, _mm_set1_epi8('"'))));
+}
+#endif
+
+/* Appends a line that starts at 'offset' to 'lines'. Returns ENOMEM if the
+ * index cannot grow, which its users fall back from.
+ */
+static int add_line(struct html_lines_t *restrict lines, size_t offset)
+{
+	if (__builtin_expect(lines->count == lines->capacity, 0)) {
+		size_t capacity = lines->capacity? 2 * lines->capacity : HTML_PARSER_MIN_LINES;
+		uint32_t *start = realloc(lines->start, capacity * sizeof(*start));
+
+		if (__builtin_expect(start == NULL, 0))
+			return ENOMEM;
+
+		lines->start = start;
+		lines->capacity = capacity;
 	}
 
+	lines->start[lines->count++] = offset;
 	return 0;
 }
 
-static int read_token_whitespace(struct html_lexer_t *restrict lexer)
+/* A segment of the input that parallel lexing assigns to a thread */
+struct lex_segment_t {
+	pthread_t thread;
+	struct html_lexer_t lexer;
+	struct html_tokens_t tokens;
+	int rc;
+
+	/* flags */
+	unsigned int thread_started :1;
+};
+
+/* The lexer is instantiated once per encoding from html_lexer_impl.h. Every
+ * character that delimits tokens is ASCII, so the UTF-8 variant runs on the
+ * original bytes and only decodes the multi-byte sequences that it needs to
+ * classify. The Latin-1 and UTF-8 variants share the byte-wise search.
+ */
+#define LEXER_CHAR uint8_t
+#define LEXER_FN(name) name##_utf8
+#define LEXER_LOAD_BYTES load_bytes_u8
+#define LEXER_IS_CHAR_START(ch) (((ch) & 0xc0) != 0x80)
+#define LEXER_DECODE decode_utf8
+#define LEXER_CHAR_MAX_SIZE UTF8_MAX_SIZE
+#define LEXER_FIND(hay,needle,hay_size,needle_size) \
+	unicode_find_utf8((const char *) (hay), (const char *) (needle), hay_size, needle_size)
+#include <html_lexer_impl.h>
+
+#define LEXER_CHAR uint8_t
+#define LEXER_FN(name) name##_latin1
+#define LEXER_LOAD_BYTES load_bytes_u8
+#define LEXER_IS_CHAR_START(ch) 1
+#define LEXER_DECODE(p,ch) (*(ch) = *(p), 1)
+#define LEXER_CHAR_MAX_SIZE 1
+#define LEXER_FIND(hay,needle,hay_size,needle_size) \
+	unicode_find_utf8((const char *) (hay), (const char *) (needle), hay_size, needle_size)
+#include <html_lexer_impl.h>
+
+#define LEXER_CHAR uint16_t
+#define LEXER_FN(name) name##_ucs2
+#define LEXER_LOAD_BYTES load_bytes_u16
+#define LEXER_IS_CHAR_START(ch) 1
+#define LEXER_DECODE(p,ch) (*(ch) = *(p), 1)
+#define LEXER_CHAR_MAX_SIZE 1
+#define LEXER_FIND unicode_find_ucs2
+#include <html_lexer_impl.h>
+
+#define LEXER_CHAR utf32_t
+#define LEXER_FN(name) name##_utf32
+#define LEXER_LOAD_BYTES load_bytes_u32
+#define LEXER_IS_CHAR_START(ch) 1
+#define LEXER_DECODE(p,ch) (*(ch) = *(p), 1)
+#define LEXER_CHAR_MAX_SIZE 1
+#define LEXER_FIND unicode_find
+#include <html_lexer_impl.h>
+
+int html_tokens_reserve(struct html_tokens_t *tokens, size_t capacity)
 {
-	const utf32_t *restrict p = lexer->current;
+	if (capacity <= tokens->capacity)
+		return 0;
 
-	while (char_type_check(lexer, *p, CHAR_INFO_WHITESPACE))
-		++p;
+	if (capacity < HTML_PARSER_MIN_TOKENS)
+		capacity = HTML_PARSER_MIN_TOKENS;
 
-	if (p - lexer->current) {
-		add_token(lexer, HTML_TOKEN_WHITESPACE, lexer->current, p);
-		lexer->current = p;
-		return 1;
+	/* the 32-bit arrays come first to keep them aligned */
+	const size_t token_size = 2 * sizeof(uint32_t) + sizeof(html_token_id_t) + sizeof(html_name_id_t);
+	char *arena = malloc(capacity * token_size);
+
+	if (__builtin_expect(arena == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", capacity * token_size);
+		return ENOMEM;
+	}
+
+	uint32_t *offset = (uint32_t *) arena;
+	uint32_t *size = offset + capacity;
+	html_token_id_t *id = (html_token_id_t *) (size + capacity);
+	html_name_id_t *name = (html_name_id_t *) (id + capacity);
+
+	if (tokens->count) {
+		memcpy(offset, tokens->offset, tokens->count * sizeof(*offset));
+		memcpy(size, tokens->size, tokens->count * sizeof(*size));
+		memcpy(id, tokens->id, tokens->count * sizeof(*id));
+		memcpy(name, tokens->name, tokens->count * sizeof(*name));
 	}
 
+	free(tokens->arena);
+
+	tokens->offset = offset;
+	tokens->size = size;
+	tokens->id = id;
+	tokens->name = name;
+	tokens->capacity = capacity;
+	tokens->arena = arena;
 	return 0;
 }
 
-static int read_token_char(struct html_lexer_t *restrict lexer, char ch, html_token_id_t token_id)
+void html_tokens_free(struct html_tokens_t *tokens)
 {
-	const utf32_t *restrict p = lexer->current;
+	free(tokens->arena);
+	*tokens = (struct html_tokens_t) {0};
+}
 
-	if (*lexer->current == ch) {
-		++p;
-		add_token(lexer, token_id, lexer->current, p);
-		lexer->current = p;
-		return 1;
+int html_lexer_init(
+		struct html_lexer_t *restrict lexer, const void *in_data, size_t in_size,
+		unicode_encoding_t encoding)
+{
+	if (__builtin_expect(in_size > HTML_PARSER_MAX_INPUT_SIZE, 0)) {
+		fprintf(stderr, "html_lex: input of %ld code units is too large\n", in_size);
+		return -1;
 	}
 
+	*lexer = (struct html_lexer_t) {
+		.data = in_data,
+		.size = in_size,
+		.encoding = encoding
+	};
+
 	return 0;
 }
 
-static int read_token_keyword(
-		struct html_lexer_t *restrict lexer, keyword_id_t keyword_id, html_token_id_t token_id)
+int html_lex_next(
+		struct html_lexer_t *restrict lexer, struct html_tokens_t *restrict tokens,
+		size_t max_count)
 {
-	size_t size = lexer->keyword_size[keyword_id];
-	const utf32_t *restrict p = lexer->current;
+	if (__builtin_expect(lexer->failed, 0))
+		return -1;
+
+	int rc = html_tokens_reserve(tokens, HTML_PARSER_MIN_TOKENS);
+	if (__builtin_expect(rc != 0, 0))
+		return rc;
+
+	tokens->base = lexer->data;
+	tokens->unit_size = unicode_unit_size(lexer->encoding);
+
+	switch (lexer->encoding) {
+	case UNICODE_ENCODING_UTF8:
+		return html_lex_next_utf8(lexer, tokens, max_count);
+	case UNICODE_ENCODING_LATIN1:
+		return html_lex_next_latin1(lexer, tokens, max_count);
+	case UNICODE_ENCODING_UCS2:
+		return html_lex_next_ucs2(lexer, tokens, max_count);
+	case UNICODE_ENCODING_UTF32:
+		return html_lex_next_utf32(lexer, tokens, max_count);
+	}
 
-	if (unicode_compare_likely_equal(p, lexer->keyword_data[keyword_id], size) == 0) {
-		p += size;
-		add_token(lexer, token_id, lexer->current, p);
-		lexer->current = p;
-		return 1;
+	return -1;
+}
+
+size_t html_lexer_shift(struct html_lexer_t *restrict lexer, void *buffer)
+{
+	const size_t unit_size = unicode_unit_size(lexer->encoding);
+	const char *data = lexer->data;
+	size_t size = lexer->size - lexer->position;
+	struct html_lines_t temporary_lines = {0};
+	struct html_lines_t *lines = lexer->lines? lexer->lines : &temporary_lines;
+	int line, column;
+
+	/* account for the lines and columns that are dropped, after which the
+	 * index no longer matches the input
+	 */
+	html_lines_locate(lines, data, lexer->encoding, lexer->position, &line, &column);
+	html_lines_clear(lines);
+	html_lines_free(&temporary_lines);
+
+	if (line == 1)
+		lexer->column += column - 1;
+	else
+		lexer->column = column - 1;
+	lexer->line += line - 1;
+
+	memmove(buffer, data + lexer->position * unit_size, size * unit_size);
+
+	lexer->data = buffer;
+	lexer->size = size;
+	lexer->position = 0;
+	return size;
+}
+
+int html_lex(
+		const void *restrict in_data, size_t in_size, unicode_encoding_t encoding,
+		struct html_tokens_t *restrict tokens)
+{
+	struct html_lexer_t lexer;
+
+	if (__builtin_expect(html_lexer_init(&lexer, in_data, in_size, encoding) != 0, 0))
+		return -1;
+
+	tokens->count = 0;
+	return html_lex_next(&lexer, tokens, SIZE_MAX);
+}
+
+static size_t find_boundary(
+		const void *in_data, unicode_encoding_t encoding, size_t from, size_t to)
+{
+	/* unicode_find reports positions as int */
+	if (to - from > INT_MAX)
+		to = from + INT_MAX;
+
+	switch (encoding) {
+	case UNICODE_ENCODING_UTF8:
+		return find_boundary_utf8(in_data, from, to);
+	case UNICODE_ENCODING_LATIN1:
+		return find_boundary_latin1(in_data, from, to);
+	case UNICODE_ENCODING_UCS2:
+		return find_boundary_ucs2(in_data, from, to);
+	case UNICODE_ENCODING_UTF32:
+		return find_boundary_utf32(in_data, from, to);
 	}
 
+	return to;
+}
+
+static void *lex_segment(void *arg)
+{
+	struct lex_segment_t *segment = arg;
+
+	segment->rc = html_lex_next(&segment->lexer, &segment->tokens, SIZE_MAX);
 	return 0;
 }
 
-static int read_token_string(struct html_lexer_t *restrict lexer)
+/* Appends tokens [first, count) of 'from' to 'tokens' */
+static int append_tokens(
+		struct html_tokens_t *restrict tokens, const struct html_tokens_t *restrict from,
+		size_t first)
 {
-	const utf32_t *restrict p = lexer->current;
-	utf32_t quote = *p;
+	size_t count = from->count - first;
+	size_t i = tokens->count;
 
-	if (__builtin_expect(quote != '"' && quote != '\'', 0))
-		return 0;
+	int rc = html_tokens_reserve(tokens, i + count + 1);
+	if (__builtin_expect(rc != 0, 0))
+		return rc;
 
-	++p;
-	while (p < lexer->end) {
-		if (*p == '\\') {
-			p += 2;
-		}
-		else if (*p == quote) {
-			add_token(lexer, HTML_TOKEN_STRING, lexer->current+1, p);
-			lexer->current = p+1;
-			return 1;
-		}
-		else {
-			++p;
-		}
-	}
+	memcpy(tokens->offset + i, from->offset + first, count * sizeof(*tokens->offset));
+	memcpy(tokens->size + i, from->size + first, count * sizeof(*tokens->size));
+	memcpy(tokens->id + i, from->id + first, count * sizeof(*tokens->id));
+	memcpy(tokens->name + i, from->name + first, count * sizeof(*tokens->name));
 
-	lexer->exception_pending = 1;
-	lexer->exception_msg = "Unterminated string literal";
-	lexer->exception_location = lexer->current;
-	return 1;
+	tokens->count = i + count;
+	return 0;
 }
 
-static int read_token_cdata(
-		struct html_lexer_t *restrict lexer, size_t keyword_begin, size_t keyword_end,
-		html_token_id_t token_id)
+int html_lex_parallel(
+		const void *restrict in_data, size_t in_size, unicode_encoding_t encoding,
+		struct html_tokens_t *restrict tokens, unsigned int thread_count)
 {
-	const utf32_t *restrict p = lexer->current;
-	const utf32_t *keyword_data = lexer->keyword_data[keyword_begin];
-	size_t keyword_size = lexer->keyword_size[keyword_begin];
+	struct lex_segment_t segments[HTML_PARSER_MAX_THREADS] = {0};
+	struct html_lexer_t lexer;
+	size_t count = 0, i, j;
+	int rc;
+
+	if (thread_count > HTML_PARSER_MAX_THREADS)
+		thread_count = HTML_PARSER_MAX_THREADS;
 
-	if (unicode_compare_likely_equal(p, keyword_data, keyword_size) == 0) {
-		p += keyword_size;
+	if (thread_count > in_size / HTML_PARSER_MIN_SEGMENT)
+		thread_count = in_size / HTML_PARSER_MIN_SEGMENT;
 
-		keyword_data = lexer->keyword_data[keyword_end];
-		keyword_size = lexer->keyword_size[keyword_end];
+	if (thread_count < 2)
+		return html_lex(in_data, in_size, encoding, tokens);
 
-		int res = unicode_find(p, keyword_data, lexer->end - p, keyword_size);
+	rc = html_lexer_init(&lexer, in_data, in_size, encoding);
+	if (__builtin_expect(rc != 0, 0))
+		return rc;
 
-		if (res > -1) {
-			p += res;
-			add_token(lexer, token_id, lexer->current, p);
-			lexer->current = p;
-			return 1;
+	/* Segments end at a '<' that begins a line, where a tag most likely
+	 * starts. A segment without one is merged into the next segment.
+	 */
+	const size_t step = in_size / thread_count;
+	size_t begin = 0;
+
+	for (i=1; i <= thread_count; ++i) {
+		size_t end = in_size;
+
+		if (i < thread_count) {
+			end = find_boundary(in_data, encoding, i * step, (i + 1) * step);
+			if (end == (i + 1) * step)
+				continue;
 		}
+
+		segments[count].lexer = lexer;
+		segments[count].lexer.position = begin;
+		segments[count].lexer.size = end;
+		segments[count].lexer.partial = 1;
+		++count;
+		begin = end;
 	}
 
-	return 0;
+	/* the first segment is lexed by this thread */
+	for (i=1; i < count; ++i) {
+		if (pthread_create(&segments[i].thread, 0, lex_segment, &segments[i]) != 0)
+			lex_segment(&segments[i]);
+		else
+			segments[i].thread_started = 1;
+	}
+
+	lex_segment(&segments[0]);
+
+	for (i=1; i < count; ++i) {
+		if (segments[i].thread_started)
+			pthread_join(segments[i].thread, 0);
+	}
+
+	/* partial input fails for lack of memory only */
+	for (i=0; i < count; ++i) {
+		rc = segments[i].rc;
+		if (__builtin_expect(rc != 0, 0))
+			goto exit1;
+	}
+
+	/* A segment may have started inside a string, a comment or a script, and
+	 * each one stopped before a token that crosses its end. The tokens are
+	 * therefore lexed again from where a segment stopped until a '<' token
+	 * starts where the next segment has one too. A '<' is the first token
+	 * that a read adds, unlike the tokens inside a raw text element, which
+	 * depend on the open tag before them. Since the tokens of a read only
+	 * depend on where it starts, the rest of that segment is valid from there
+	 * on.
+	 */
+	tokens->count = 0;
+	tokens->base = in_data;
+	tokens->unit_size = unicode_unit_size(encoding);
+
+	rc = append_tokens(tokens, &segments[0].tokens, 0);
+	lexer.position = segments[0].lexer.position;
+
+	for (i=1; i < count && rc == 0; ++i) {
+		const struct html_tokens_t *restrict next = &segments[i].tokens;
+		j = 0;
+
+		while (lexer.position < segments[i].lexer.position) {
+			while (j < next->count && next->offset[j] < lexer.position)
+				++j;
+
+			if (j < next->count && next->offset[j] == lexer.position
+					&& next->id[j] == HTML_TOKEN_LESSTHAN) {
+				rc = append_tokens(tokens, next, j);
+				lexer.position = segments[i].lexer.position;
+				break;
+			}
+
+			rc = html_lex_next(&lexer, tokens, 1);
+			if (__builtin_expect(rc != 0, 0))
+				break;
+		}
+	}
+
+	/* the last segment stops before a token that needs the end of the input */
+	if (rc == 0)
+		rc = html_lex_next(&lexer, tokens, SIZE_MAX);
+
+exit1:
+	for (i=0; i < count; ++i)
+		html_tokens_free(&segments[i].tokens);
+
+	return rc;
 }
 
-static void add_token(
-		struct html_lexer_t *restrict lexer, html_token_id_t id,
-		const utf32_t *begin, const utf32_t *end)
+size_t html_entity_decode(
+		const struct html_tokens_t *restrict tokens, html_token_idx_t i,
+		uint32_t *restrict code_points)
 {
-	struct html_tokens_t *restrict tokens = lexer->tokens;
-	size_t i = tokens->count;
+	const size_t unit_size = tokens->unit_size;
+	const char *text = html_token_begin(tokens, i) + unit_size;
+	size_t size = tokens->size[i] - 2;
+	uint8_t name[HTML_ENTITY_MAX_SIZE];
+	size_t j;
+	int idx;
+
+	if (tokens->id[i] != HTML_TOKEN_ENTITY)
+		return 0;
 
-	if (i < HTML_PARSER_MAX_TOKENS) {
-		tokens->begin[i] = begin;
-		tokens->end[i] = end;
-		tokens->id[i] = id;
+	/* numeric references saturate above U+10FFFF */
+	if (load_unit(text, unit_size) == '#') {
+		uint32_t base = 10, value = 0;
+
+		text += unit_size;
+		--size;
+
+		if ((load_unit(text, unit_size) | 0x20) == 'x') {
+			base = 16;
+			text += unit_size;
+			--size;
+		}
+
+		for (j = 0; j < size; ++j) {
+			uint32_t ch = load_unit(text + j * unit_size, unit_size);
+			uint32_t digit = is_ascii_digit(ch)? ch - '0' : (ch | 0x20) - 'a' + 10;
+
+			value = value * base + digit;
+			if (value > 0x10ffff)
+				value = 0x110000;
+		}
 
-		tokens->count = i+1;
+		if (value == 0 || value > 0x10ffff || (value >= 0xd800 && value <= 0xdfff))
+			value = 0xfffd;
+		else if (value >= 0x80 && value <= 0x9f && windows_1252_c1[value - 0x80])
+			value = windows_1252_c1[value - 0x80];
+
+		code_points[0] = value;
+		return 1;
 	}
-	else {
-		lexer->exception_pending = 1;
-		lexer->exception_msg = "Not enough space for tokens";
-		lexer->exception_location = begin;
+
+	/* the lexer only makes entity tokens of known names */
+	for (j = 0; j < size; ++j)
+		name[j] = load_unit(text + j * unit_size, unit_size);
+
+	idx = lookup_entity(name, size);
+	code_points[0] = html_entity_code_points[idx][0];
+	code_points[1] = html_entity_code_points[idx][1];
+	return 1 + (code_points[1] != 0);
+}
+
+void html_lines_locate(
+		struct html_lines_t *restrict lines, const void *restrict in_data,
+		unicode_encoding_t encoding, size_t offset, int *restrict line, int *restrict column)
+{
+	switch (encoding) {
+	case UNICODE_ENCODING_UTF8:
+		locate_utf8(lines, in_data, offset, line, column);
+		break;
+	case UNICODE_ENCODING_LATIN1:
+		locate_latin1(lines, in_data, offset, line, column);
+		break;
+	case UNICODE_ENCODING_UCS2:
+		locate_ucs2(lines, in_data, offset, line, column);
+		break;
+	case UNICODE_ENCODING_UTF32:
+		locate_utf32(lines, in_data, offset, line, column);
+		break;
 	}
 }
 
+void html_lines_clear(struct html_lines_t *lines)
+{
+	lines->count = 0;
+	lines->scanned = 0;
+}
 
+void html_lines_free(struct html_lines_t *lines)
+{
+	free(lines->start);
+	*lines = (struct html_lines_t) {0};
+}
@@ -14,8 +14,106 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/* Lexes an input a few tokens at a time, see html_lex_next.
+ *
+ * The input may also arrive in chunks. While 'partial' is set, more input
+ * follows 'data', and a token that reaches its end is left for the next
+ * chunk instead. The caller then lexes the chunk until no more tokens come,
+ * consumes them, calls html_lexer_shift to keep the unlexed tail, appends
+ * the next chunk and the zero padding after it and adds its size to 'size'.
+ * 'partial' is cleared for the last chunk. Memory stays bounded by the chunk
+ * size plus the longest token.
+ */
+struct html_lexer_t {
+	const void *data;
+	size_t size;        /* in code units */
+	size_t position;    /* in code units, where the next token starts */
+	unicode_encoding_t encoding;
+
+	/* lines and columns that precede 'data', for error messages */
+	int line;
+	int column;
+
+	/* optional index of the lines of 'data', which error messages share with
+	 * other users of the input. A temporary one is used otherwise.
+	 */
+	struct html_lines_t *lines;
+
+	/* flags */
+	unsigned int partial :1;
+	unsigned int failed :1;
+};
+
+/* Prepares 'lexer' to lex 'in_size' code units of 'in_data', which must be
+ * followed by HTML_PARSER_PADDING zero bytes
+ */
+int html_lexer_init(
+		struct html_lexer_t *restrict lexer, const void *in_data, size_t in_size,
+		unicode_encoding_t encoding);
+
+/* Appends up to 'max_count' tokens to 'tokens', resuming where the previous
+ * call stopped. The input is exhausted once 'position' reaches 'size'. An
+ * HTML_TOKEN_END sentinel follows the last token. After an error, which is
+ * reported on stderr, every call returns -1.
+ */
+int html_lex_next(
+		struct html_lexer_t *restrict lexer, struct html_tokens_t *restrict tokens,
+		size_t max_count);
+
+/* Moves the code units that are not lexed yet to the start of 'buffer',
+ * which must have room for them and HTML_PARSER_PADDING bytes, and makes it
+ * the input. The tokens lexed so far no longer refer to valid input. Returns
+ * the number of code units kept, after which the next chunk goes.
+ */
+size_t html_lexer_shift(struct html_lexer_t *restrict lexer, void *buffer);
+
+/* Splits 'in_size' code units of 'in_data' into tokens, replacing those that
+ * 'tokens' held. The input must be followed by HTML_PARSER_PADDING zero
+ * bytes.
+ */
 int html_lex(
-		const utf32_t *restrict in_data, size_t in_size, struct html_tokens_t *restrict tokens);
+		const void *restrict in_data, size_t in_size, unicode_encoding_t encoding,
+		struct html_tokens_t *restrict tokens);
+
+/* Grows 'tokens' to hold at least 'capacity' tokens. Returns ENOMEM if the
+ * memory cannot be allocated, in which case 'tokens' is unchanged.
+ */
+int html_tokens_reserve(struct html_tokens_t *tokens, size_t capacity);
+
+/* Releases the storage of 'tokens' */
+void html_tokens_free(struct html_tokens_t *tokens);
+
+/* Lexes like html_lex, but splits inputs of at least two
+ * HTML_PARSER_MIN_SEGMENT code units into up to 'thread_count' segments that
+ * are lexed in parallel. The tokens are the same as those of html_lex.
+ */
+int html_lex_parallel(
+		const void *restrict in_data, size_t in_size, unicode_encoding_t encoding,
+		struct html_tokens_t *restrict tokens, unsigned int thread_count);
+
+/* Stores the code points that entity token 'i' stands for in 'code_points',
+ * which has room for two, and returns how many there are. Returns 0 if the
+ * token is not an HTML_TOKEN_ENTITY.
+ */
+size_t html_entity_decode(
+		const struct html_tokens_t *restrict tokens, html_token_idx_t i,
+		uint32_t *restrict code_points);
+
+/* Computes the 1-based line and column numbers of the code unit at 'offset'
+ * in 'in_data', whose lines 'lines' indexes. Columns are counted in
+ * characters. The index is extended to 'offset' first if needed, by a vector
+ * scan for newlines, and then searched. If it cannot grow, the remaining
+ * lines are counted instead.
+ */
+void html_lines_locate(
+		struct html_lines_t *restrict lines, const void *restrict in_data,
+		unicode_encoding_t encoding, size_t offset, int *restrict line, int *restrict column);
+
+/* Empties 'lines' for another input */
+void html_lines_clear(struct html_lines_t *lines);
+
+/* Releases the storage of 'lines' */
+void html_lines_free(struct html_lines_t *lines);
 
 
 #endif
@@ -0,0 +1,891 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * html_lexer_impl.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* This file is included by html_lexer.c once per encoding. The includer
+ * defines the following macros, which are undefined at the end of this file:
+ *
+ *  - LEXER_CHAR: the code unit type of the input
+ *  - LEXER_FN(name): appends the encoding suffix to 'name'
+ *  - LEXER_IS_CHAR_START(ch): non-zero if the code unit 'ch' starts a character
+ *  - LEXER_DECODE(p, ch): stores the character at 'p' in '*ch' and returns its
+ *    size in code units
+ *  - LEXER_CHAR_MAX_SIZE: the largest size of a character in code units
+ *  - LEXER_FIND: unicode_find for LEXER_CHAR strings
+ *  - LEXER_LOAD_BYTES: loads 16 LEXER_CHARs narrowed to bytes, for SSE2 builds
+ */
+
+/* keywords in the code unit of the input */
+static const LEXER_CHAR LEXER_FN(keyword_data)[KEYWORD_END][KEYWORD_MAX_SIZE] = KEYWORD_DATA_INITIALIZER;
+
+struct LEXER_FN(html_lexer) {
+	const LEXER_CHAR *restrict base;
+	const LEXER_CHAR *restrict current;
+	const LEXER_CHAR *restrict end;
+
+	/* tokens */
+	struct html_tokens_t *restrict tokens;
+
+	/* parsing error handling */
+	const char *restrict exception_msg;
+	const LEXER_CHAR *restrict exception_location;
+
+	/* flags */
+	unsigned int exception_pending :1;
+	unsigned int partial :1;
+	unsigned int suspended :1;
+};
+
+static int LEXER_FN(read_token)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_identifier)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_text)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_whitespace)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_char)(
+		struct LEXER_FN(html_lexer) *restrict lexer, char ch, html_token_id_t token_id);
+static int LEXER_FN(read_token_string)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_entity)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_markup)(struct LEXER_FN(html_lexer) *restrict lexer);
+static int LEXER_FN(read_token_raw_text)(
+		struct LEXER_FN(html_lexer) *restrict lexer, const struct raw_text_element_t *restrict element);
+static void LEXER_FN(read_escapable_text)(
+		struct LEXER_FN(html_lexer) *restrict lexer, const LEXER_CHAR *end,
+		const struct raw_text_element_t *restrict element);
+static int LEXER_FN(read_token_cdata)(
+		struct LEXER_FN(html_lexer) *restrict lexer, size_t keyword_begin, size_t keyword_end,
+		html_token_id_t token_id);
+static void LEXER_FN(add_token)(
+		struct LEXER_FN(html_lexer) *restrict lexer, html_token_id_t id, html_name_id_t name,
+		const LEXER_CHAR *begin, const LEXER_CHAR *end);
+
+/* A token that reaches the end of partial input may continue in the next
+ * chunk. Its recognizer then stops the lexer without adding the token, so
+ * that it is lexed again once more input is available.
+ */
+static inline int LEXER_FN(suspend)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	lexer->suspended = 1;
+	return 1;
+}
+
+/* Returns the name that the identifier of 'size' characters at 'begin' spells */
+static inline html_name_id_t LEXER_FN(identify_name)(const LEXER_CHAR *begin, size_t size)
+{
+	uint64_t key[2] = {0};
+
+	if (size > HTML_NAME_MAX_SIZE)
+		return HTML_NAME_UNKNOWN;
+
+	/* names are case-insensitive and the keys are in lower case */
+#if defined(__SSE2__)
+	/* the names are ASCII, and the non-ASCII characters of an identifier
+	 * narrow to bytes with the high bit set, which no key has
+	 */
+	__m128i mask = _mm_loadu_si128((const __m128i *) (name_size_mask + 16 - size));
+	_mm_storeu_si128((__m128i *) key, _mm_and_si128(fold_case(LEXER_LOAD_BYTES(begin)), mask));
+#else
+	for (size_t i = 0; i < size; ++i) {
+		uint32_t ch = begin[i];
+		key[i / 8] |= (uint64_t) fold_char((ch < 128)? ch : 0xff) << (8 * (i % 8));
+	}
+#endif
+
+	return lookup_name(key[0], key[1]);
+}
+
+/* Returns 0 if the characters at 'p' spell 'keyword', in any ASCII case
+ * unless all of it is exact
+ */
+static inline int LEXER_FN(compare_keyword)(const LEXER_CHAR *p, size_t keyword)
+{
+	size_t size = keyword_size[keyword];
+
+	if (keyword_exact_size[keyword] == size) {
+		for (size_t i = 0; i < size; ++i) {
+			if (p[i] != LEXER_FN(keyword_data)[keyword][i])
+				return 1;
+		}
+
+		return 0;
+	}
+
+#if defined(__SSE2__)
+	__m128i mask = _mm_loadu_si128((const __m128i *) (name_size_mask + 16 - size));
+	__m128i v = _mm_and_si128(fold_case(LEXER_LOAD_BYTES(p)), mask);
+
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_loadu_si128((const __m128i *) keyword_bytes[keyword]))) != 0xffff;
+#else
+	for (size_t i = 0; i < size; ++i) {
+		if (fold_char(p[i]) != keyword_bytes[keyword][i])
+			return 1;
+	}
+
+	return 0;
+#endif
+}
+
+/* Returns the position of the first occurrence of 'keyword', as
+ * compare_keyword matches it, among the 'size' characters at 'p', or -1 if
+ * there is none. Only the candidates found by the exact search for the part
+ * of the keyword before its first letter are compared in full.
+ */
+static int LEXER_FN(find_keyword)(const LEXER_CHAR *restrict p, size_t size, size_t keyword)
+{
+	size_t exact_size = keyword_exact_size[keyword];
+	size_t pos = 0;
+
+	for (;;) {
+		int res = LEXER_FIND(p + pos, LEXER_FN(keyword_data)[keyword], size - pos, exact_size);
+
+		if (res < 0)
+			return -1;
+
+		pos += res;
+
+		if (exact_size == keyword_size[keyword])
+			return pos;
+
+		if (size - pos < keyword_size[keyword])
+			return -1;
+
+		if (LEXER_FN(compare_keyword)(p + pos, keyword) == 0)
+			return pos;
+
+		++pos;
+	}
+}
+
+/* Returns the position of the first '<' that follows a newline in
+ * [from, to), or 'to' if there is none
+ */
+static size_t LEXER_FN(find_boundary)(const LEXER_CHAR *restrict in_data, size_t from, size_t to)
+{
+	int res = LEXER_FIND(in_data + from, LEXER_FN(keyword_data)[KEYWORD_BOUNDARY],
+			to - from, keyword_size[KEYWORD_BOUNDARY]);
+
+	return (res > -1)? from + res + 1 : to;
+}
+
+/* Adds the lines that start in ('lines->scanned', 'to'] to 'lines'. Stops
+ * early if the index cannot grow.
+ */
+static void LEXER_FN(index_lines)(
+		struct html_lines_t *restrict lines, const LEXER_CHAR *restrict in_data, size_t to)
+{
+	size_t i = lines->scanned;
+
+#if defined(__SSE2__)
+	for (; i + 16 <= to; i += 16) {
+		uint32_t newlines = _mm_movemask_epi8(
+				_mm_cmpeq_epi8(LEXER_LOAD_BYTES(in_data + i), _mm_set1_epi8('\n')));
+
+		for (; newlines; newlines &= newlines - 1) {
+			if (__builtin_expect(add_line(lines, i + __builtin_ctz(newlines) + 1) != 0, 0)) {
+				lines->scanned = i + __builtin_ctz(newlines);
+				return;
+			}
+		}
+	}
+#endif
+
+	for (; i < to; ++i) {
+		if (in_data[i] == '\n' && __builtin_expect(add_line(lines, i + 1) != 0, 0)) {
+			lines->scanned = i;
+			return;
+		}
+	}
+
+	lines->scanned = to;
+}
+
+static void LEXER_FN(locate)(
+		struct html_lines_t *restrict lines, const LEXER_CHAR *restrict in_data, size_t offset,
+		int *restrict line, int *restrict column)
+{
+	size_t line_num = 0;
+	size_t begin = 0;
+	int column_num = 0;
+
+	/* the first line starts with the input */
+	if (lines->count == 0)
+		add_line(lines, 0);
+
+	if (lines->count && lines->scanned < offset)
+		LEXER_FN(index_lines)(lines, in_data, offset);
+
+	/* the last indexed line that starts at or before 'offset' */
+	if (lines->count) {
+		size_t lo = 0, hi = lines->count;
+
+		while (hi - lo > 1) {
+			size_t mid = lo + (hi - lo) / 2;
+
+			if (lines->start[mid] <= offset)
+				lo = mid;
+			else
+				hi = mid;
+		}
+
+		line_num = lo;
+		begin = lines->start[lo];
+	}
+
+	/* counts the columns, and the lines past an index that could not grow */
+	for (const LEXER_CHAR *p = in_data + begin; p < in_data + offset; ++p) {
+		if (*p == '\n') {
+			++line_num;
+			column_num = 0;
+		}
+		else if (LEXER_IS_CHAR_START(*p)) {
+			++column_num;
+		}
+	}
+
+	*line = line_num + 1;
+	*column = column_num + 1;
+}
+
+static int LEXER_FN(html_lex_next)(
+		struct html_lexer_t *restrict state, struct html_tokens_t *restrict tokens, size_t max_count)
+{
+	struct LEXER_FN(html_lexer) lexer = {0};
+	const LEXER_CHAR *in_data = state->data;
+	size_t first = tokens->count;
+	int processed, rc = 0;
+
+	lexer.tokens = tokens;
+	lexer.base = in_data;
+	lexer.current = in_data + state->position;
+	lexer.end = in_data + state->size;
+	lexer.partial = state->partial;
+
+	/* process tokens until the input ends or 'max_count' are added */
+	while (lexer.current < lexer.end && tokens->count - first < max_count) {
+		processed = LEXER_FN(read_token)(&lexer);
+
+		if (processed) {
+			if (__builtin_expect(lexer.exception_pending | lexer.suspended, 0))
+				break;
+		}
+		else {
+			lexer.exception_pending = 1;
+			lexer.exception_msg = "Unrecognized token";
+			lexer.exception_location = lexer.current;
+			break;
+		}
+	}
+
+	state->position = lexer.current - in_data;
+
+	if (__builtin_expect(lexer.exception_pending, 0)) {
+		struct html_lines_t temporary_lines = {0};
+		struct html_lines_t *lines = state->lines? state->lines : &temporary_lines;
+		int column_num, line_num;
+
+		LEXER_FN(locate)(lines, in_data, lexer.exception_location - in_data, &line_num, &column_num);
+		html_lines_free(&temporary_lines);
+
+		/* the input may be a chunk that follows others */
+		if (line_num == 1)
+			column_num += state->column;
+		line_num += state->line;
+
+		fprintf(stderr, "html_lex: %s on line %d, column %d\n",
+				lexer.exception_msg, line_num, column_num);
+		state->failed = 1;
+		rc = -1;
+	}
+
+	/* the parser looks ahead without checking the count, and stops here */
+	tokens->id[tokens->count] = HTML_TOKEN_END;
+
+	return rc;
+}
+
+static int LEXER_FN(read_token)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR ch = *lexer->current;
+	struct char_dispatch_t dispatch = { DISPATCH_TEXT };
+	uint32_t code_point;
+
+	if ((uint32_t) ch < 128) {
+		dispatch = char_dispatch[ch];
+	}
+	else {
+		/* a multi-byte character may be cut off at the end of partial input */
+		if (__builtin_expect(lexer->partial && lexer->end - lexer->current < LEXER_CHAR_MAX_SIZE, 0))
+			return LEXER_FN(suspend)(lexer);
+
+		(void) LEXER_DECODE(lexer->current, &code_point);
+
+		if (char_type_check(code_point, CHAR_INFO_IDENTIFIER))
+			dispatch.type = DISPATCH_IDENTIFIER;
+	}
+
+	/* The first character determines the token, except that '<' may start a
+	 * comment, a CDATA section or a raw text element. Only these try more than
+	 * one recognizer.
+	 */
+	switch (dispatch.type) {
+	case DISPATCH_WHITESPACE:
+		return LEXER_FN(read_token_whitespace)(lexer);
+	case DISPATCH_IDENTIFIER:
+		return LEXER_FN(read_token_identifier)(lexer);
+	case DISPATCH_STRING:
+		return LEXER_FN(read_token_string)(lexer);
+	case DISPATCH_CHAR:
+		LEXER_FN(add_token)(lexer, dispatch.arg, HTML_NAME_UNKNOWN, lexer->current, lexer->current + 1);
+		++lexer->current;
+		return 1;
+	case DISPATCH_ENTITY:
+		return LEXER_FN(read_token_entity)(lexer);
+	case DISPATCH_MARKUP:
+		return LEXER_FN(read_token_markup)(lexer);
+	default:
+		return LEXER_FN(read_token_text)(lexer);
+	}
+}
+
+static int LEXER_FN(read_token_identifier)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+	const int flag = CHAR_INFO_IDENTIFIER | CHAR_INFO_NUMBER;
+	uint32_t ch;
+	size_t size = LEXER_DECODE(p, &ch);
+
+	if (__builtin_expect(char_type_check(ch, CHAR_INFO_IDENTIFIER) == 0, 0))
+		return 0;
+
+	p += size;
+
+	for (;;) {
+#if defined(__SSE2__)
+		/* the zero padding after the input ends the run */
+		for (;;) {
+			__m128i v = LEXER_LOAD_BYTES(p);
+			uint32_t stop = ~_mm_movemask_epi8(_mm_or_si128(class_identifier(v), class_number(v))) & 0xffff;
+
+			if (stop) {
+				p += __builtin_ctz(stop);
+				break;
+			}
+
+			p += 16;
+		}
+#else
+		while ((uint32_t) *p < 128 && char_type_check(*p, flag))
+			++p;
+#endif
+
+		/* the ASCII runs are scanned above, and the non-ASCII characters
+		 * between them are looked up one at a time
+		 */
+		if ((uint32_t) *p < 128)
+			break;
+
+		if (__builtin_expect(lexer->partial && lexer->end - p < LEXER_CHAR_MAX_SIZE, 0))
+			return LEXER_FN(suspend)(lexer);
+
+		size = LEXER_DECODE(p, &ch);
+
+		if (char_type_check(ch, flag) == 0)
+			break;
+
+		p += size;
+	}
+
+	/* the run may go on past the end of a segment of the input */
+	if (__builtin_expect(lexer->partial && p >= lexer->end, 0))
+		return LEXER_FN(suspend)(lexer);
+
+	/* the keywords are the identifiers that spell them */
+	html_name_id_t name = LEXER_FN(identify_name)(lexer->current, p - lexer->current);
+	html_token_id_t id = HTML_TOKEN_IDENTIFIER;
+
+	if (name <= HTML_NAME_KEYWORD_LAST)
+		id = keyword_token[name];
+
+	LEXER_FN(add_token)(lexer, id, name, lexer->current, p);
+	lexer->current = p;
+	return 1;
+}
+
+static int LEXER_FN(read_token_text)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+
+	/* According to https://html.spec.whatwg.org/#writing-xhtml-documents, the
+	 * five special characters in HTML are: '<', '>', '&', '\'', '"'.
+	 *
+	 * Since we expect variable references to appear in the text, we will need
+	 * to consider this regex as well: "\s*[{]\s*[A-Za-z_][A-Za-z0-9_]*\s*[}]\s".
+	 * This regex contains the following tokens:
+	 *  - whitespace
+	 *  - open-brace
+	 *  - close-brace
+	 *  - identifier
+	 *
+	 * Since we only care about the start of the next token, we will only consider
+	 * [A-Za-z_] pattern of the identifier token.
+	 */
+
+	const int flag = CHAR_INFO_NOT_TEXT | CHAR_INFO_WHITESPACE | CHAR_INFO_IDENTIFIER;
+	size_t size;
+	uint32_t ch;
+
+	for (;;) {
+#if defined(__SSE2__)
+		/* the padding is text, so the end of the input is masked in instead.
+		 * The high bit of 'v' stops the scan at non-ASCII characters too.
+		 */
+		while (p < lexer->end) {
+			__m128i v = LEXER_LOAD_BYTES(p);
+			uint32_t stop = _mm_movemask_epi8(_mm_or_si128(
+						_mm_or_si128(class_not_text(v), class_whitespace(v)),
+						_mm_or_si128(class_identifier(v), v)));
+
+			if (lexer->end - p < 16)
+				stop |= ~0u << (lexer->end - p);
+
+			if (stop) {
+				p += __builtin_ctz(stop);
+				break;
+			}
+
+			p += 16;
+		}
+#else
+		while (p < lexer->end && (uint32_t) *p < 128 && !char_type_check(*p, flag))
+			++p;
+#endif
+
+		/* a non-ASCII character only ends the text if it starts an identifier */
+		if (p >= lexer->end || (uint32_t) *p < 128)
+			break;
+
+		if (__builtin_expect(lexer->partial && lexer->end - p < LEXER_CHAR_MAX_SIZE, 0))
+			return LEXER_FN(suspend)(lexer);
+
+		size = LEXER_DECODE(p, &ch);
+
+		if (char_type_check(ch, flag))
+			break;
+
+		p += size;
+	}
+
+	if (__builtin_expect(lexer->partial && p == lexer->end, 0))
+		return LEXER_FN(suspend)(lexer);
+
+	if (p - lexer->current) {
+		LEXER_FN(add_token)(lexer, HTML_TOKEN_TEXT, HTML_NAME_UNKNOWN, lexer->current, p);
+		lexer->current = p;
+		return 1;
+	}
+
+	return 0;
+}
+
+static int LEXER_FN(read_token_whitespace)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+
+#if defined(__SSE2__)
+	/* the zero padding after the input ends the run */
+	for (;;) {
+		uint32_t stop = ~_mm_movemask_epi8(class_whitespace(LEXER_LOAD_BYTES(p))) & 0xffff;
+
+		if (stop) {
+			p += __builtin_ctz(stop);
+			break;
+		}
+
+		p += 16;
+	}
+#else
+	while (char_type_check(*p, CHAR_INFO_WHITESPACE))
+		++p;
+#endif
+
+	if (__builtin_expect(lexer->partial && p >= lexer->end, 0))
+		return LEXER_FN(suspend)(lexer);
+
+	if (p - lexer->current) {
+		LEXER_FN(add_token)(lexer, HTML_TOKEN_WHITESPACE, HTML_NAME_UNKNOWN, lexer->current, p);
+		lexer->current = p;
+		return 1;
+	}
+
+	return 0;
+}
+
+static int LEXER_FN(read_token_char)(
+		struct LEXER_FN(html_lexer) *restrict lexer, char ch, html_token_id_t token_id)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+
+	if (*lexer->current == ch) {
+		++p;
+		LEXER_FN(add_token)(lexer, token_id, HTML_NAME_UNKNOWN, lexer->current, p);
+		lexer->current = p;
+		return 1;
+	}
+
+	return 0;
+}
+
+static int LEXER_FN(read_token_string)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+	LEXER_CHAR quote = *p;
+
+	if (__builtin_expect(quote != '"' && quote != '\'', 0))
+		return 0;
+
+	++p;
+	while (p < lexer->end) {
+		if (*p == '\\') {
+			p += 2;
+		}
+		else if (*p == quote) {
+			LEXER_FN(add_token)(lexer, HTML_TOKEN_STRING, HTML_NAME_UNKNOWN, lexer->current+1, p);
+			lexer->current = p+1;
+			return 1;
+		}
+		else {
+			++p;
+		}
+	}
+
+	if (lexer->partial)
+		return LEXER_FN(suspend)(lexer);
+
+	lexer->exception_pending = 1;
+	lexer->exception_msg = "Unterminated string literal";
+	lexer->exception_location = lexer->current;
+	return 1;
+}
+
+/* A character reference is '&', then either a known name, '#' and decimal
+ * digits or '#x' and hexadecimal digits, and then ';'. Returns its size, or 0
+ * if the '&' at 'begin' does not start one. '*stop' is where the name or the
+ * digits end. References without the ';' are legacy forms, which are not
+ * recognized.
+ */
+static size_t LEXER_FN(entity_size)(const LEXER_CHAR *begin, const LEXER_CHAR **stop)
+{
+	const LEXER_CHAR *restrict p = begin + 1;
+	uint8_t name[HTML_ENTITY_MAX_SIZE + 1];
+	size_t size = 0;
+	int numeric = (*p == '#');
+
+	if (numeric) {
+		int hex = ((uint32_t) p[1] | 0x20) == 'x';
+
+		p += 1 + hex;
+
+		for (; hex? is_ascii_hex_digit(*p) : is_ascii_digit(*p); ++p)
+			++size;
+	}
+	else {
+		/* one character more than the longest name tells that it is too long */
+		for (; size <= HTML_ENTITY_MAX_SIZE && is_ascii_alnum(*p); ++p)
+			name[size++] = *p;
+	}
+
+	*stop = p;
+
+	if (size == 0 || *p != ';' || (!numeric && (size > HTML_ENTITY_MAX_SIZE || lookup_entity(name, size) < 0)))
+		return 0;
+
+	return p + 1 - begin;
+}
+
+/* Any '&' that does not start a character reference is a character of its own */
+static int LEXER_FN(read_token_entity)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR *stop;
+	size_t size = LEXER_FN(entity_size)(lexer->current, &stop);
+
+	/* the reference may be cut off at the end of partial input */
+	if (__builtin_expect(lexer->partial && stop >= lexer->end, 0))
+		return LEXER_FN(suspend)(lexer);
+
+	if (size == 0)
+		return LEXER_FN(read_token_char)(lexer, '&', HTML_TOKEN_AMPERSAND);
+
+	LEXER_FN(add_token)(lexer, HTML_TOKEN_ENTITY, HTML_NAME_UNKNOWN, lexer->current, lexer->current + size);
+	lexer->current += size;
+	return 1;
+}
+
+/* Returns the size of the template variable '{{ name }}' at 'begin', whose
+ * whitespace is optional, or 0 if there is none
+ */
+static size_t LEXER_FN(variable_size)(const LEXER_CHAR *begin)
+{
+	const LEXER_CHAR *restrict p = begin + 2;
+	uint32_t ch;
+	size_t size;
+
+	if (begin[1] != '{')
+		return 0;
+
+	while ((uint32_t) *p < 128 && char_dispatch[*p].type == DISPATCH_WHITESPACE)
+		++p;
+
+	size = LEXER_DECODE(p, &ch);
+	if (char_type_check(ch, CHAR_INFO_IDENTIFIER) == 0)
+		return 0;
+
+	do {
+		p += size;
+		size = LEXER_DECODE(p, &ch);
+	} while (char_type_check(ch, CHAR_INFO_IDENTIFIER | CHAR_INFO_NUMBER));
+
+	while ((uint32_t) *p < 128 && char_dispatch[*p].type == DISPATCH_WHITESPACE)
+		++p;
+
+	if (p[0] != '}' || p[1] != '}')
+		return 0;
+
+	return p + 2 - begin;
+}
+
+/* Only the raw text elements whose name starts with the character after
+ * the '<' are compared, so that most tags try none.
+ */
+static int LEXER_FN(read_token_markup)(struct LEXER_FN(html_lexer) *restrict lexer)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+
+	/* the character after the '<' may be in the next chunk */
+	if (__builtin_expect(lexer->partial && lexer->end - p < 2, 0))
+		return LEXER_FN(suspend)(lexer);
+
+	if (p[1] == '!') {
+		return
+			   LEXER_FN(read_token_cdata)(lexer, KEYWORD_COMMENT_START, KEYWORD_COMMENT_END, HTML_TOKEN_COMMENT)
+			|| LEXER_FN(read_token_cdata)(lexer, KEYWORD_CDATA_START, KEYWORD_CDATA_END, HTML_TOKEN_CDATA)
+			|| LEXER_FN(read_token_char)(lexer, '<',  HTML_TOKEN_LESSTHAN);
+	}
+
+	uint32_t first = fold_char(p[1]);
+
+	for (size_t i = 0; i < RAW_TEXT_ELEMENT_COUNT; ++i) {
+		const struct raw_text_element_t *element = &raw_text_elements[i];
+
+		if (keyword_bytes[element->keyword_begin][1] == first
+				&& LEXER_FN(read_token_raw_text)(lexer, element))
+			return 1;
+	}
+
+	return LEXER_FN(read_token_char)(lexer, '<',  HTML_TOKEN_LESSTHAN);
+}
+
+/* A raw text element is read from its '<' up to its end tag at once, so
+ * that every read still starts where a token would start without it: the
+ * open tag is lexed token by token and the content is taken up to the end
+ * tag. The element is given up, and its '<' lexed as a character, if the
+ * open tag holds a '<' or a token that is not recognized, or if the end tag
+ * is missing. Its tag name also needs to end after the start keyword, so
+ * that '<titles>' is not a title.
+ */
+static int LEXER_FN(read_token_raw_text)(
+		struct LEXER_FN(html_lexer) *restrict lexer, const struct raw_text_element_t *restrict element)
+{
+	struct html_tokens_t *restrict tokens = lexer->tokens;
+	const LEXER_CHAR *restrict begin = lexer->current;
+	const LEXER_CHAR *restrict p = begin + keyword_size[element->keyword_begin];
+	size_t count = tokens->count;
+	int res;
+
+	/* the tag name and the character after it may be cut off at the end of
+	 * partial input
+	 */
+	if (__builtin_expect(lexer->partial && lexer->end - p < 1, 0))
+		return LEXER_FN(suspend)(lexer);
+
+	/* tag names are case-insensitive */
+	if (LEXER_FN(compare_keyword)(begin, element->keyword_begin) != 0
+			|| (*p != '>' && *p != '/' && !char_type_check(*p, CHAR_INFO_WHITESPACE)))
+		return 0;
+
+	LEXER_FN(add_token)(lexer, HTML_TOKEN_LESSTHAN, HTML_NAME_UNKNOWN, begin, begin + 1);
+	lexer->current = begin + 1;
+
+	while (*lexer->current != '>') {
+		if (__builtin_expect(lexer->exception_pending, 0))
+			return 1;
+
+		if (lexer->current >= lexer->end)
+			goto suspend;
+
+		if (*lexer->current == '<' || LEXER_FN(read_token)(lexer) == 0)
+			goto give_up;
+
+		if (__builtin_expect(lexer->suspended, 0))
+			goto suspend;
+	}
+
+	LEXER_FN(add_token)(lexer, HTML_TOKEN_GREATERTHAN, HTML_NAME_UNKNOWN, lexer->current, lexer->current + 1);
+	p = ++lexer->current;
+
+	res = LEXER_FN(find_keyword)(p, lexer->end - p, element->keyword_end);
+	if (res < 0)
+		goto suspend;
+
+	if (element->escapable)
+		LEXER_FN(read_escapable_text)(lexer, p + res, element);
+	else if (res > 0)
+		LEXER_FN(add_token)(lexer, element->token_id, element->name, p, p + res);
+
+	lexer->current = p + res;
+	return 1;
+
+suspend:
+	/* the rest of the element may be in the next chunk */
+	if (lexer->partial) {
+		tokens->count = count;
+		lexer->current = begin;
+		return LEXER_FN(suspend)(lexer);
+	}
+
+give_up:
+	tokens->count = count;
+	lexer->current = begin;
+	lexer->suspended = 0;
+	return 0;
+}
+
+/* Splits the escapable raw text up to 'end' into raw text tokens and the
+ * character references and template variables between them. An '&' or a
+ * '{' that starts neither stays in the raw text.
+ */
+static void LEXER_FN(read_escapable_text)(
+		struct LEXER_FN(html_lexer) *restrict lexer, const LEXER_CHAR *end,
+		const struct raw_text_element_t *restrict element)
+{
+	const LEXER_CHAR *restrict run = lexer->current;
+	const LEXER_CHAR *restrict p = run;
+	const LEXER_CHAR *stop;
+	size_t size;
+
+	for (;;) {
+#if defined(__SSE2__)
+		while (p < end) {
+			__m128i v = LEXER_LOAD_BYTES(p);
+			uint32_t found = _mm_movemask_epi8(_mm_or_si128(
+						_mm_cmpeq_epi8(v, _mm_set1_epi8('&')),
+						_mm_cmpeq_epi8(v, _mm_set1_epi8('{'))));
+
+			if (end - p < 16)
+				found |= ~0u << (end - p);
+
+			if (found) {
+				p += __builtin_ctz(found);
+				break;
+			}
+
+			p += 16;
+		}
+#else
+		while (p < end && *p != '&' && *p != '{')
+			++p;
+#endif
+
+		if (p >= end)
+			break;
+
+		if (*p == '&')
+			size = LEXER_FN(entity_size)(p, &stop);
+		else
+			size = LEXER_FN(variable_size)(p);
+
+		if (size == 0) {
+			++p;
+			continue;
+		}
+
+		if (p > run)
+			LEXER_FN(add_token)(lexer, element->token_id, element->name, run, p);
+
+		/* the tokens of a variable are those that it has anywhere else */
+		if (*p == '&') {
+			LEXER_FN(add_token)(lexer, HTML_TOKEN_ENTITY, HTML_NAME_UNKNOWN, p, p + size);
+		}
+		else {
+			for (lexer->current = p; lexer->current < p + size; )
+				LEXER_FN(read_token)(lexer);
+		}
+
+		p += size;
+		run = p;
+	}
+
+	if (end > run)
+		LEXER_FN(add_token)(lexer, element->token_id, element->name, run, end);
+}
+
+/* The token lasts from the start keyword up to the end keyword */
+static int LEXER_FN(read_token_cdata)(
+		struct LEXER_FN(html_lexer) *restrict lexer, size_t keyword_begin, size_t keyword_end,
+		html_token_id_t token_id)
+{
+	const LEXER_CHAR *restrict p = lexer->current;
+
+	/* the start keyword may be cut off at the end of partial input */
+	if (__builtin_expect(lexer->partial && (size_t) (lexer->end - p) < keyword_size[keyword_begin], 0))
+		return LEXER_FN(suspend)(lexer);
+
+	if (LEXER_FN(compare_keyword)(p, keyword_begin) == 0) {
+		p += keyword_size[keyword_begin];
+
+		int res = LEXER_FN(find_keyword)(p, lexer->end - p, keyword_end);
+
+		if (res > -1) {
+			p += res;
+			LEXER_FN(add_token)(lexer, token_id, HTML_NAME_UNKNOWN, lexer->current, p);
+			lexer->current = p;
+			return 1;
+		}
+
+		if (lexer->partial)
+			return LEXER_FN(suspend)(lexer);
+	}
+
+	return 0;
+}
+
+static void LEXER_FN(add_token)(
+		struct LEXER_FN(html_lexer) *restrict lexer, html_token_id_t id, html_name_id_t name,
+		const LEXER_CHAR *begin, const LEXER_CHAR *end)
+{
+	struct html_tokens_t *restrict tokens = lexer->tokens;
+	size_t i = tokens->count;
+
+	/* one slot stays free for the sentinel of html_lex_next */
+	if (__builtin_expect(i + 1 == tokens->capacity, 0) && html_tokens_reserve(tokens, 2 * tokens->capacity) != 0) {
+		lexer->exception_pending = 1;
+		lexer->exception_msg = "Not enough memory for tokens";
+		lexer->exception_location = begin;
+		return;
+	}
+
+	tokens->offset[i] = begin - lexer->base;
+	tokens->size[i] = end - begin;
+	tokens->id[i] = id;
+	tokens->name[i] = name;
+
+	tokens->count = i+1;
+}
+
+#undef LEXER_CHAR
+#undef LEXER_FN
+#undef LEXER_IS_CHAR_START
+#undef LEXER_DECODE
+#undef LEXER_CHAR_MAX_SIZE
+#undef LEXER_FIND
+#undef LEXER_LOAD_BYTES
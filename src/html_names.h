@@ -0,0 +1,132 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * html_names.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_html_names.py. Do not edit. */
+
+#ifndef HTML_NAMES_H
+#define HTML_NAMES_H
+
+#include <stdint.h>
+
+/* Names of the keywords and the elements that the lexer recognizes. The
+ * keywords come first, up to and including HTML_NAME_KEYWORD_LAST.
+ */
+enum {
+	HTML_NAME_UNKNOWN,
+	HTML_NAME_HTML,
+	HTML_NAME_DATA,
+	HTML_NAME_INCLUDE,
+	HTML_NAME_KEYWORD_LAST = HTML_NAME_INCLUDE,
+	HTML_NAME_A,
+	HTML_NAME_ABBR,
+	HTML_NAME_ADDRESS,
+	HTML_NAME_AREA,
+	HTML_NAME_ARTICLE,
+	HTML_NAME_ASIDE,
+	HTML_NAME_AUDIO,
+	HTML_NAME_B,
+	HTML_NAME_BASE,
+	HTML_NAME_BLOCKQUOTE,
+	HTML_NAME_BODY,
+	HTML_NAME_BR,
+	HTML_NAME_BUTTON,
+	HTML_NAME_CANVAS,
+	HTML_NAME_CAPTION,
+	HTML_NAME_CITE,
+	HTML_NAME_CODE,
+	HTML_NAME_COL,
+	HTML_NAME_COLGROUP,
+	HTML_NAME_DD,
+	HTML_NAME_DEL,
+	HTML_NAME_DETAILS,
+	HTML_NAME_DFN,
+	HTML_NAME_DIALOG,
+	HTML_NAME_DIV,
+	HTML_NAME_DL,
+	HTML_NAME_DT,
+	HTML_NAME_EM,
+	HTML_NAME_EMBED,
+	HTML_NAME_FIELDSET,
+	HTML_NAME_FIGCAPTION,
+	HTML_NAME_FIGURE,
+	HTML_NAME_FOOTER,
+	HTML_NAME_FORM,
+	HTML_NAME_H1,
+	HTML_NAME_H2,
+	HTML_NAME_H3,
+	HTML_NAME_H4,
+	HTML_NAME_H5,
+	HTML_NAME_H6,
+	HTML_NAME_HEAD,
+	HTML_NAME_HEADER,
+	HTML_NAME_HR,
+	HTML_NAME_I,
+	HTML_NAME_IFRAME,
+	HTML_NAME_IMG,
+	HTML_NAME_INPUT,
+	HTML_NAME_INS,
+	HTML_NAME_KBD,
+	HTML_NAME_LABEL,
+	HTML_NAME_LEGEND,
+	HTML_NAME_LI,
+	HTML_NAME_LINK,
+	HTML_NAME_MAIN,
+	HTML_NAME_MAP,
+	HTML_NAME_MARK,
+	HTML_NAME_META,
+	HTML_NAME_METER,
+	HTML_NAME_NAV,
+	HTML_NAME_NOSCRIPT,
+	HTML_NAME_OBJECT,
+	HTML_NAME_OL,
+	HTML_NAME_OPTGROUP,
+	HTML_NAME_OPTION,
+	HTML_NAME_OUTPUT,
+	HTML_NAME_P,
+	HTML_NAME_PARAM,
+	HTML_NAME_PICTURE,
+	HTML_NAME_PRE,
+	HTML_NAME_PROGRESS,
+	HTML_NAME_Q,
+	HTML_NAME_S,
+	HTML_NAME_SAMP,
+	HTML_NAME_SCRIPT,
+	HTML_NAME_SECTION,
+	HTML_NAME_SELECT,
+	HTML_NAME_SLOT,
+	HTML_NAME_SMALL,
+	HTML_NAME_SOURCE,
+	HTML_NAME_SPAN,
+	HTML_NAME_STRONG,
+	HTML_NAME_STYLE,
+	HTML_NAME_SUB,
+	HTML_NAME_SUMMARY,
+	HTML_NAME_SUP,
+	HTML_NAME_TABLE,
+	HTML_NAME_TBODY,
+	HTML_NAME_TD,
+	HTML_NAME_TEMPLATE,
+	HTML_NAME_TEXTAREA,
+	HTML_NAME_TFOOT,
+	HTML_NAME_TH,
+	HTML_NAME_THEAD,
+	HTML_NAME_TIME,
+	HTML_NAME_TITLE,
+	HTML_NAME_TR,
+	HTML_NAME_TRACK,
+	HTML_NAME_U,
+	HTML_NAME_UL,
+	HTML_NAME_VAR,
+	HTML_NAME_VIDEO,
+	HTML_NAME_WBR,
+	HTML_NAME_END
+};
+
+/* Must be less than HTML_NAME_END */
+typedef uint8_t html_name_id_t;
+
+#endif
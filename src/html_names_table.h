@@ -0,0 +1,240 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * html_names_table.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_html_names.py. Do not edit. */
+
+/* Hash and displace tables of the names in html_names.h. The low 6 bits of
+ * the hash select a displacement, which moves the names of that bucket to
+ * free slots. The keys of a name hold its characters in little-endian order,
+ * padded with zeros.
+ */
+#define HTML_NAME_MAX_SIZE 16
+#define HTML_NAME_BUCKET_BITS 6
+#define HTML_NAME_SLOT_BITS 8
+
+static const uint8_t html_name_disp[1 << HTML_NAME_BUCKET_BITS] = {
+	0, 2, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 0, 0, 0,
+	0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+	0, 0, 0, 1, 0, 0, 1, 0, 0, 2, 3, 0, 0, 1, 0, 1,
+};
+
+static const html_name_id_t html_name_slot[1 << HTML_NAME_SLOT_BITS] = {
+	[0] = HTML_NAME_PICTURE,
+	[4] = HTML_NAME_U,
+	[6] = HTML_NAME_ADDRESS,
+	[7] = HTML_NAME_LINK,
+	[9] = HTML_NAME_H3,
+	[12] = HTML_NAME_HEADER,
+	[18] = HTML_NAME_LABEL,
+	[29] = HTML_NAME_PROGRESS,
+	[34] = HTML_NAME_META,
+	[37] = HTML_NAME_MAP,
+	[39] = HTML_NAME_DD,
+	[43] = HTML_NAME_TEXTAREA,
+	[45] = HTML_NAME_SELECT,
+	[46] = HTML_NAME_H2,
+	[48] = HTML_NAME_FORM,
+	[51] = HTML_NAME_OPTION,
+	[53] = HTML_NAME_INCLUDE,
+	[58] = HTML_NAME_SUMMARY,
+	[64] = HTML_NAME_CODE,
+	[68] = HTML_NAME_SCRIPT,
+	[69] = HTML_NAME_H1,
+	[71] = HTML_NAME_MAIN,
+	[72] = HTML_NAME_BR,
+	[74] = HTML_NAME_A,
+	[82] = HTML_NAME_INS,
+	[91] = HTML_NAME_PRE,
+	[95] = HTML_NAME_FIELDSET,
+	[99] = HTML_NAME_DT,
+	[103] = HTML_NAME_THEAD,
+	[109] = HTML_NAME_FIGCAPTION,
+	[111] = HTML_NAME_VIDEO,
+	[112] = HTML_NAME_TBODY,
+	[114] = HTML_NAME_TH,
+	[115] = HTML_NAME_SUP,
+	[117] = HTML_NAME_INPUT,
+	[118] = HTML_NAME_LEGEND,
+	[119] = HTML_NAME_P,
+	[120] = HTML_NAME_IFRAME,
+	[121] = HTML_NAME_SUB,
+	[123] = HTML_NAME_HTML,
+	[124] = HTML_NAME_SECTION,
+	[126] = HTML_NAME_SLOT,
+	[128] = HTML_NAME_ASIDE,
+	[129] = HTML_NAME_MARK,
+	[131] = HTML_NAME_STYLE,
+	[132] = HTML_NAME_TABLE,
+	[133] = HTML_NAME_EM,
+	[135] = HTML_NAME_H5,
+	[136] = HTML_NAME_OL,
+	[137] = HTML_NAME_DETAILS,
+	[138] = HTML_NAME_H6,
+	[139] = HTML_NAME_CANVAS,
+	[140] = HTML_NAME_TITLE,
+	[142] = HTML_NAME_KBD,
+	[144] = HTML_NAME_VAR,
+	[148] = HTML_NAME_COLGROUP,
+	[149] = HTML_NAME_ABBR,
+	[150] = HTML_NAME_COL,
+	[152] = HTML_NAME_AUDIO,
+	[153] = HTML_NAME_OUTPUT,
+	[156] = HTML_NAME_H4,
+	[160] = HTML_NAME_UL,
+	[161] = HTML_NAME_SOURCE,
+	[164] = HTML_NAME_TRACK,
+	[165] = HTML_NAME_BASE,
+	[169] = HTML_NAME_SAMP,
+	[173] = HTML_NAME_EMBED,
+	[175] = HTML_NAME_FIGURE,
+	[178] = HTML_NAME_CAPTION,
+	[179] = HTML_NAME_DIV,
+	[180] = HTML_NAME_DL,
+	[182] = HTML_NAME_B,
+	[184] = HTML_NAME_Q,
+	[186] = HTML_NAME_DFN,
+	[188] = HTML_NAME_STRONG,
+	[189] = HTML_NAME_S,
+	[193] = HTML_NAME_TEMPLATE,
+	[194] = HTML_NAME_OBJECT,
+	[195] = HTML_NAME_TR,
+	[196] = HTML_NAME_LI,
+	[202] = HTML_NAME_NOSCRIPT,
+	[205] = HTML_NAME_BUTTON,
+	[206] = HTML_NAME_FOOTER,
+	[208] = HTML_NAME_SMALL,
+	[212] = HTML_NAME_BLOCKQUOTE,
+	[213] = HTML_NAME_SPAN,
+	[216] = HTML_NAME_DIALOG,
+	[218] = HTML_NAME_IMG,
+	[219] = HTML_NAME_DATA,
+	[220] = HTML_NAME_BODY,
+	[223] = HTML_NAME_I,
+	[224] = HTML_NAME_DEL,
+	[229] = HTML_NAME_CITE,
+	[230] = HTML_NAME_TD,
+	[231] = HTML_NAME_AREA,
+	[232] = HTML_NAME_NAV,
+	[233] = HTML_NAME_METER,
+	[234] = HTML_NAME_HR,
+	[236] = HTML_NAME_HEAD,
+	[237] = HTML_NAME_TIME,
+	[249] = HTML_NAME_TFOOT,
+	[250] = HTML_NAME_ARTICLE,
+	[251] = HTML_NAME_WBR,
+	[254] = HTML_NAME_PARAM,
+	[255] = HTML_NAME_OPTGROUP,
+};
+
+static const uint64_t html_name_key[HTML_NAME_END][2] = {
+	[HTML_NAME_HTML] = { 0x000000006c6d7468, 0x0000000000000000 },
+	[HTML_NAME_DATA] = { 0x0000000061746164, 0x0000000000000000 },
+	[HTML_NAME_INCLUDE] = { 0x006564756c636e69, 0x0000000000000000 },
+	[HTML_NAME_A] = { 0x0000000000000061, 0x0000000000000000 },
+	[HTML_NAME_ABBR] = { 0x0000000072626261, 0x0000000000000000 },
+	[HTML_NAME_ADDRESS] = { 0x0073736572646461, 0x0000000000000000 },
+	[HTML_NAME_AREA] = { 0x0000000061657261, 0x0000000000000000 },
+	[HTML_NAME_ARTICLE] = { 0x00656c6369747261, 0x0000000000000000 },
+	[HTML_NAME_ASIDE] = { 0x0000006564697361, 0x0000000000000000 },
+	[HTML_NAME_AUDIO] = { 0x0000006f69647561, 0x0000000000000000 },
+	[HTML_NAME_B] = { 0x0000000000000062, 0x0000000000000000 },
+	[HTML_NAME_BASE] = { 0x0000000065736162, 0x0000000000000000 },
+	[HTML_NAME_BLOCKQUOTE] = { 0x6f75716b636f6c62, 0x0000000000006574 },
+	[HTML_NAME_BODY] = { 0x0000000079646f62, 0x0000000000000000 },
+	[HTML_NAME_BR] = { 0x0000000000007262, 0x0000000000000000 },
+	[HTML_NAME_BUTTON] = { 0x00006e6f74747562, 0x0000000000000000 },
+	[HTML_NAME_CANVAS] = { 0x00007361766e6163, 0x0000000000000000 },
+	[HTML_NAME_CAPTION] = { 0x006e6f6974706163, 0x0000000000000000 },
+	[HTML_NAME_CITE] = { 0x0000000065746963, 0x0000000000000000 },
+	[HTML_NAME_CODE] = { 0x0000000065646f63, 0x0000000000000000 },
+	[HTML_NAME_COL] = { 0x00000000006c6f63, 0x0000000000000000 },
+	[HTML_NAME_COLGROUP] = { 0x70756f72676c6f63, 0x0000000000000000 },
+	[HTML_NAME_DD] = { 0x0000000000006464, 0x0000000000000000 },
+	[HTML_NAME_DEL] = { 0x00000000006c6564, 0x0000000000000000 },
+	[HTML_NAME_DETAILS] = { 0x00736c6961746564, 0x0000000000000000 },
+	[HTML_NAME_DFN] = { 0x00000000006e6664, 0x0000000000000000 },
+	[HTML_NAME_DIALOG] = { 0x0000676f6c616964, 0x0000000000000000 },
+	[HTML_NAME_DIV] = { 0x0000000000766964, 0x0000000000000000 },
+	[HTML_NAME_DL] = { 0x0000000000006c64, 0x0000000000000000 },
+	[HTML_NAME_DT] = { 0x0000000000007464, 0x0000000000000000 },
+	[HTML_NAME_EM] = { 0x0000000000006d65, 0x0000000000000000 },
+	[HTML_NAME_EMBED] = { 0x0000006465626d65, 0x0000000000000000 },
+	[HTML_NAME_FIELDSET] = { 0x746573646c656966, 0x0000000000000000 },
+	[HTML_NAME_FIGCAPTION] = { 0x6974706163676966, 0x0000000000006e6f },
+	[HTML_NAME_FIGURE] = { 0x0000657275676966, 0x0000000000000000 },
+	[HTML_NAME_FOOTER] = { 0x00007265746f6f66, 0x0000000000000000 },
+	[HTML_NAME_FORM] = { 0x000000006d726f66, 0x0000000000000000 },
+	[HTML_NAME_H1] = { 0x0000000000003168, 0x0000000000000000 },
+	[HTML_NAME_H2] = { 0x0000000000003268, 0x0000000000000000 },
+	[HTML_NAME_H3] = { 0x0000000000003368, 0x0000000000000000 },
+	[HTML_NAME_H4] = { 0x0000000000003468, 0x0000000000000000 },
+	[HTML_NAME_H5] = { 0x0000000000003568, 0x0000000000000000 },
+	[HTML_NAME_H6] = { 0x0000000000003668, 0x0000000000000000 },
+	[HTML_NAME_HEAD] = { 0x0000000064616568, 0x0000000000000000 },
+	[HTML_NAME_HEADER] = { 0x0000726564616568, 0x0000000000000000 },
+	[HTML_NAME_HR] = { 0x0000000000007268, 0x0000000000000000 },
+	[HTML_NAME_I] = { 0x0000000000000069, 0x0000000000000000 },
+	[HTML_NAME_IFRAME] = { 0x0000656d61726669, 0x0000000000000000 },
+	[HTML_NAME_IMG] = { 0x0000000000676d69, 0x0000000000000000 },
+	[HTML_NAME_INPUT] = { 0x0000007475706e69, 0x0000000000000000 },
+	[HTML_NAME_INS] = { 0x0000000000736e69, 0x0000000000000000 },
+	[HTML_NAME_KBD] = { 0x000000000064626b, 0x0000000000000000 },
+	[HTML_NAME_LABEL] = { 0x0000006c6562616c, 0x0000000000000000 },
+	[HTML_NAME_LEGEND] = { 0x0000646e6567656c, 0x0000000000000000 },
+	[HTML_NAME_LI] = { 0x000000000000696c, 0x0000000000000000 },
+	[HTML_NAME_LINK] = { 0x000000006b6e696c, 0x0000000000000000 },
+	[HTML_NAME_MAIN] = { 0x000000006e69616d, 0x0000000000000000 },
+	[HTML_NAME_MAP] = { 0x000000000070616d, 0x0000000000000000 },
+	[HTML_NAME_MARK] = { 0x000000006b72616d, 0x0000000000000000 },
+	[HTML_NAME_META] = { 0x000000006174656d, 0x0000000000000000 },
+	[HTML_NAME_METER] = { 0x000000726574656d, 0x0000000000000000 },
+	[HTML_NAME_NAV] = { 0x000000000076616e, 0x0000000000000000 },
+	[HTML_NAME_NOSCRIPT] = { 0x7470697263736f6e, 0x0000000000000000 },
+	[HTML_NAME_OBJECT] = { 0x00007463656a626f, 0x0000000000000000 },
+	[HTML_NAME_OL] = { 0x0000000000006c6f, 0x0000000000000000 },
+	[HTML_NAME_OPTGROUP] = { 0x70756f726774706f, 0x0000000000000000 },
+	[HTML_NAME_OPTION] = { 0x00006e6f6974706f, 0x0000000000000000 },
+	[HTML_NAME_OUTPUT] = { 0x000074757074756f, 0x0000000000000000 },
+	[HTML_NAME_P] = { 0x0000000000000070, 0x0000000000000000 },
+	[HTML_NAME_PARAM] = { 0x0000006d61726170, 0x0000000000000000 },
+	[HTML_NAME_PICTURE] = { 0x0065727574636970, 0x0000000000000000 },
+	[HTML_NAME_PRE] = { 0x0000000000657270, 0x0000000000000000 },
+	[HTML_NAME_PROGRESS] = { 0x73736572676f7270, 0x0000000000000000 },
+	[HTML_NAME_Q] = { 0x0000000000000071, 0x0000000000000000 },
+	[HTML_NAME_S] = { 0x0000000000000073, 0x0000000000000000 },
+	[HTML_NAME_SAMP] = { 0x00000000706d6173, 0x0000000000000000 },
+	[HTML_NAME_SCRIPT] = { 0x0000747069726373, 0x0000000000000000 },
+	[HTML_NAME_SECTION] = { 0x006e6f6974636573, 0x0000000000000000 },
+	[HTML_NAME_SELECT] = { 0x00007463656c6573, 0x0000000000000000 },
+	[HTML_NAME_SLOT] = { 0x00000000746f6c73, 0x0000000000000000 },
+	[HTML_NAME_SMALL] = { 0x0000006c6c616d73, 0x0000000000000000 },
+	[HTML_NAME_SOURCE] = { 0x0000656372756f73, 0x0000000000000000 },
+	[HTML_NAME_SPAN] = { 0x000000006e617073, 0x0000000000000000 },
+	[HTML_NAME_STRONG] = { 0x0000676e6f727473, 0x0000000000000000 },
+	[HTML_NAME_STYLE] = { 0x000000656c797473, 0x0000000000000000 },
+	[HTML_NAME_SUB] = { 0x0000000000627573, 0x0000000000000000 },
+	[HTML_NAME_SUMMARY] = { 0x007972616d6d7573, 0x0000000000000000 },
+	[HTML_NAME_SUP] = { 0x0000000000707573, 0x0000000000000000 },
+	[HTML_NAME_TABLE] = { 0x000000656c626174, 0x0000000000000000 },
+	[HTML_NAME_TBODY] = { 0x00000079646f6274, 0x0000000000000000 },
+	[HTML_NAME_TD] = { 0x0000000000006474, 0x0000000000000000 },
+	[HTML_NAME_TEMPLATE] = { 0x6574616c706d6574, 0x0000000000000000 },
+	[HTML_NAME_TEXTAREA] = { 0x6165726174786574, 0x0000000000000000 },
+	[HTML_NAME_TFOOT] = { 0x000000746f6f6674, 0x0000000000000000 },
+	[HTML_NAME_TH] = { 0x0000000000006874, 0x0000000000000000 },
+	[HTML_NAME_THEAD] = { 0x0000006461656874, 0x0000000000000000 },
+	[HTML_NAME_TIME] = { 0x00000000656d6974, 0x0000000000000000 },
+	[HTML_NAME_TITLE] = { 0x000000656c746974, 0x0000000000000000 },
+	[HTML_NAME_TR] = { 0x0000000000007274, 0x0000000000000000 },
+	[HTML_NAME_TRACK] = { 0x0000006b63617274, 0x0000000000000000 },
+	[HTML_NAME_U] = { 0x0000000000000075, 0x0000000000000000 },
+	[HTML_NAME_UL] = { 0x0000000000006c75, 0x0000000000000000 },
+	[HTML_NAME_VAR] = { 0x0000000000726176, 0x0000000000000000 },
+	[HTML_NAME_VIDEO] = { 0x0000006f65646976, 0x0000000000000000 },
+	[HTML_NAME_WBR] = { 0x0000000000726277, 0x0000000000000000 },
+};
@@ -7,6 +7,7 @@
 
 #include <html_parser.h>
 #include <html_lexer.h>
+#include <errno.h>
 #include <stdio.h>
 #include <assert.h>
 
@@ -16,55 +17,73 @@
 //#define TRACE_TOKENS
 
 
-#define EXPECT_TOKEN_1_1(tree,p,token) \
+#define EXPECT_TOKEN_1_1(parser,p,token) \
 	do {\
-		if (__builtin_expect(tree->tokens.id[p] != token, 0))\
+		if (__builtin_expect(token_id(parser, p) != token, 0))\
 			return 0;\
 		++p;\
 	} while(0)
 
-#define EXPECT_TOKEN_2_1(tree,p,token1,token2) \
+#define EXPECT_TOKEN_2_1(parser,p,token1,token2) \
 	do {\
-		if (__builtin_expect(tree->tokens.id[p] != token1 && \
-					         tree->tokens.id[p] != token2, 0))\
+		if (__builtin_expect(token_id(parser, p) != token1 && \
+					         token_id(parser, p) != token2, 0))\
 			return 0;\
 		++p;\
 	} while(0)
 
-#define EXPECT_TOKEN_1_0N(tree,p,token) \
+#define EXPECT_TOKEN_1_0N(parser,p,token) \
 	do {\
-		while (tree->tokens.id[p] == token) {\
+		while (token_id(parser, p) == token) {\
 			++p;\
 		}\
 	} while(0)
 
-#define EXPECT_TOKEN_2_0N(tree,p,token1,token2) \
+#define EXPECT_TOKEN_2_0N(parser,p,token1,token2) \
 	do {\
-		while (tree->tokens.id[p] == token1 || tree->tokens.id[p] == token2) {\
+		while (token_id(parser, p) == token1 || token_id(parser, p) == token2) {\
 			++p;\
 		}\
 	} while(0)
 
-#define EXPECT_TOKEN_3_0N(tree,p,token1,token2,token3) \
+#define EXPECT_TOKEN_3_0N(parser,p,token1,token2,token3) \
 	do {\
-		while (tree->tokens.id[p] == token1 || tree->tokens.id[p] == token2 || tree->tokens.id[p] == token3) {\
+		while (token_id(parser, p) == token1 || token_id(parser, p) == token2 || token_id(parser, p) == token3) {\
 			++p;\
 		}\
 	} while(0)
 
+#define EXPECT_TOKEN_4_0N(parser,p,token1,token2,token3,token4) \
+	do {\
+		while (token_id(parser, p) == token1 || token_id(parser, p) == token2 || token_id(parser, p) == token3 || token_id(parser, p) == token4) {\
+			++p;\
+		}\
+	} while(0)
+
+/* The parser pulls tokens from the lexer into a window as it reads them,
+ * so lexing and parsing interleave while the tokens are still in cache.
+ * Token indices count from the start of the token stream, and token 'p' is
+ * at p - window_first in the window. The tokens that the parser has moved
+ * past are dropped from the window, and the tokens that the tree refers to
+ * are copied to tree->tokens.
+ */
 struct html_parser_t {
 	html_token_idx_t current;
 
+	/* lookahead */
+	struct html_lexer_t lexer;
+	struct html_tokens_t *restrict window;
+	html_token_idx_t window_first;
+
 	/* parse tree */
 	struct html_tree_t *restrict tree;
 
-	/* node stack */
-	html_token_idx_t node_stack[HTML_PARSER_MAX_STACK_SIZE];
+	/* node stack, in tree->stack */
 	size_t node_stack_size;
 
 	/* parsing error handling */
 	const char *restrict exception_msg;
-	html_token_idx_t exception_location;
+	const char *exception_location;
 
 	/* flags */
 	unsigned int exception_pending :1;
@@ -72,9 +91,10 @@ struct html_parser_t {
 
 struct html_builder_t {
 	const struct html_tokens_t *restrict tokens;
-	utf32_t *restrict output;
-	size_t current;
-	size_t max_size;
+	size_t unit_size;
+	char *restrict output;
+	size_t current;     /* in bytes */
+	size_t max_size;    /* in bytes */
 };
 
 /* Lexical token analyzers */
@@ -83,42 +103,142 @@ static int read_node_open_tag_attributes(struct html_parser_t *restrict parser,
 static int read_node_open_tag(struct html_parser_t *restrict parser);
 static int read_node_close_tag(struct html_parser_t *restrict parser);
 static int read_node_variable(struct html_parser_t *restrict parser);
+static int read_node_markup(struct html_parser_t *restrict parser);
 static int read_node_text(struct html_parser_t *restrict parser);
 static int read_node_whitespace(struct html_parser_t *restrict parser);
 
+/* Token window */
+static void fill_window(struct html_parser_t *restrict parser);
+static html_token_idx_t retain_token(struct html_parser_t *restrict parser, html_token_idx_t p);
+
 /* Parse tree operations */
-static void pop_node(struct html_parser_t *restrict parser, html_token_idx_t tag_name);
-static void push_node(struct html_parser_t *restrict parser, html_token_idx_t tag_name);
+static int reserve_arrays(
+		void **arena, html_token_idx_t **const *arrays, size_t array_count, size_t count,
+		size_t capacity);
+static int reserve_nodes(struct html_tree_t *tree, size_t capacity);
+static int reserve_attributes(struct html_tree_t *tree, size_t count, size_t capacity);
+static int reserve_stack(struct html_tree_t *tree, size_t capacity);
+static void pop_node(
+		struct html_parser_t *restrict parser, const struct html_tokens_t *tokens,
+		html_token_idx_t tag_name);
+static int push_node(struct html_parser_t *restrict parser, html_token_idx_t tag_name);
 
 /* Debugging */
 static void dump_parse_table(struct html_parser_t *restrict parser);
 
 #ifdef TRACE_TOKENS
-static void trace_token(html_token_id_t token_id, const utf32_t *restrict in_data, size_t in_size);
+static void trace_token(struct html_parser_t *restrict parser, html_token_idx_t p);
 #endif
 
+/* Returns the id of token 'p', lexing it first if needed */
+static inline html_token_id_t token_id(struct html_parser_t *restrict parser, html_token_idx_t p)
+{
+	if (__builtin_expect(p - parser->window_first >= parser->window->count, 0))
+		fill_window(parser);
+
+	/* past the last token, this is the HTML_TOKEN_END sentinel */
+	return parser->window->id[p - parser->window_first];
+}
+
+/* Returns a pointer to the input at token 'p' of the window */
+static inline const char *token_location(const struct html_parser_t *restrict parser, html_token_idx_t p)
+{
+	return html_token_begin(parser->window, p - parser->window_first);
+}
+
+/* Attribute names may spell keywords, like the 'data' directive of a template */
+static inline int is_attribute_name(html_token_id_t id)
+{
+	return id == HTML_TOKEN_IDENTIFIER || id == HTML_TOKEN_DATA || id == HTML_TOKEN_INCLUDE
+		|| id == HTML_TOKEN_HTML;
+}
 
-int html_parse(const utf32_t *restrict in_data, size_t in_size, struct html_tree_t *restrict tree)
+int html_parse(
+		const void *restrict in_data, size_t in_size, unicode_encoding_t encoding,
+		struct html_tree_t *restrict tree)
 {
 	struct html_parser_t parser = { 0 };
+	struct html_tokens_t *restrict tokens = &tree->tokens;
 	int processed;
 
-	int rc = html_lex(in_data, in_size, &tree->tokens);
+	tree->encoding = encoding;
+	tree->node_count = 0;
+	tree->attrib_count = 0;
+
+	int rc = html_lexer_init(&parser.lexer, in_data, in_size, encoding);
 	if (__builtin_expect(rc != 0, 0)) {
 		return rc;
 	}
 
+	/* the lexer and the parser share the line index of the input */
+	html_lines_clear(&tree->lines);
+	parser.lexer.lines = &tree->lines;
+
+	rc = html_tokens_reserve(tokens, HTML_PARSER_MIN_TOKENS);
+	if (__builtin_expect(rc != 0, 0)) {
+		return rc;
+	}
+
+	/* token 0 stands for no token, such as the parent of the root nodes */
+	tokens->base = in_data;
+	tokens->unit_size = unicode_unit_size(encoding);
+	tokens->offset[0] = 0;
+	tokens->size[0] = 0;
+	tokens->id[0] = HTML_TOKEN_END;
+	tokens->name[0] = HTML_NAME_UNKNOWN;
+	tokens->count = 1;
+
+	rc = html_tokens_reserve(&tree->window, HTML_PARSER_MIN_TOKENS);
+	if (__builtin_expect(rc != 0, 0)) {
+		return rc;
+	}
+
+	tree->window.count = 0;
+	tree->window.id[0] = HTML_TOKEN_END;
+	parser.window = &tree->window;
+
+	/* the storage of a previous document is reused as it is */
+	rc = reserve_nodes(tree, HTML_PARSER_MIN_NODES);
+	if (__builtin_expect(rc != 0, 0)) {
+		return rc;
+	}
+
+	rc = reserve_attributes(tree, 0, HTML_PARSER_MIN_ATTRIBUTES);
+	if (__builtin_expect(rc != 0, 0)) {
+		return rc;
+	}
+
+	rc = reserve_stack(tree, HTML_PARSER_MIN_STACK_SIZE);
+	if (__builtin_expect(rc != 0, 0)) {
+		return rc;
+	}
+
+	/* parallel lexing fills the window with every token up front */
+	if (tree->lex_threads > 1) {
+		rc = html_lex_parallel(in_data, in_size, encoding, &tree->window, tree->lex_threads);
+		if (__builtin_expect(rc != 0, 0)) {
+			return rc;
+		}
+
+		parser.lexer.position = in_size;
+	}
+
 	parser.tree = tree;
 
 	/* setting the initial stack size to 1. index 0 is reserved so that we needn't check if
 	 * node_stack_size-1 is negative in push_node()
 	 */
+	tree->stack[0] = 0;
 	parser.node_stack_size = 1;
 
 	/* process all tokens */
-	while (parser.current < tree->tokens.count) {
+	while (token_id(&parser, parser.current) != HTML_TOKEN_END) {
 		processed = read_node(&parser);
 
+		if (__builtin_expect(parser.lexer.failed, 0)) {
+			return -1;
+		}
+
 		if (processed) {
 			if (__builtin_expect(parser.exception_pending, 0))
 				break;
@@ -126,29 +246,24 @@ int html_parse(const utf32_t *restrict in_data, size_t in_size, struct html_tree
 		else {
 			parser.exception_pending = 1;
 			parser.exception_msg = "Invalid syntax";
-			parser.exception_location = parser.current;
+			parser.exception_location = token_location(&parser, parser.current);
 			break;
 		}
 	}
 
+	if (__builtin_expect(parser.lexer.failed, 0)) {
+		return -1;
+	}
+
 	if (__builtin_expect(parser.exception_pending, 0)) {
-		const utf32_t *p;
-		const utf32_t *begin = tree->tokens.begin[parser.exception_location];
-		int column_num = 0;
-		int line_num = 0;
-
-		for (p = in_data; p < begin; ++p) {
-			if (*p != '\n') {
-				++column_num;
-			}
-			else {
-				++line_num;
-				column_num = 0;
-			}
-		}
+		int column_num, line_num;
+
+		html_lines_locate(&tree->lines, in_data, encoding,
+				(parser.exception_location - (const char *) in_data) / unicode_unit_size(encoding),
+				&line_num, &column_num);
 
 		fprintf(stderr, "html_parse: %s on line %d, column %d\n",
-				parser.exception_msg, line_num+1, column_num+1);
+				parser.exception_msg, line_num, column_num);
 		rc = -1;
 	}
 
@@ -160,10 +275,7 @@ int html_parse(const utf32_t *restrict in_data, size_t in_size, struct html_tree
 static int read_node(struct html_parser_t *restrict parser)
 {
 #ifdef TRACE_TOKENS
-	struct html_tokens_t *restrict tokens = &parser->tree->tokens;
-	trace_token(
-			tokens->id[parser->current], tokens->begin[parser->current],
-			tokens->end[parser->current] - tokens->begin[parser->current]);
+	trace_token(parser, parser->current);
 	++parser->current;
 	return 1;
 #endif
@@ -172,6 +284,7 @@ static int read_node(struct html_parser_t *restrict parser)
 		   read_node_open_tag(parser)
 		|| read_node_close_tag(parser)
 		|| read_node_variable(parser)
+		|| read_node_markup(parser)
 		|| read_node_text(parser)
 		|| read_node_whitespace(parser);
 }
@@ -184,32 +297,41 @@ static int read_node_open_tag_attributes(struct html_parser_t *restrict parser,
 	html_token_idx_t attrib_value = 0;
 	size_t attrib_idx = tree->attrib_count;
 
-	while (tree->tokens.id[p] == HTML_TOKEN_IDENTIFIER) {
+	while (is_attribute_name(token_id(parser, p))) {
+		/* the attributes of this tag are kept, as they are not counted yet */
+		if (__builtin_expect(attrib_idx == tree->attrib_capacity, 0)
+				&& reserve_attributes(tree, attrib_idx, 2 * attrib_idx) != 0) {
+			parser->exception_pending = 1;
+			parser->exception_msg = "Not enough memory for attributes";
+			parser->exception_location = token_location(parser, p);
+			return 1;
+		}
+
 		++p;
-		EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
+		EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
 
-		if (tree->tokens.id[p] == HTML_TOKEN_EQUAL) {
+		if (token_id(parser, p) == HTML_TOKEN_EQUAL) {
 			++p;
 
-			EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
+			EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
 			attrib_value = p;
-			EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_STRING);
-			EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
+			EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_STRING);
+			EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
 		}
 		else {
 			attrib_value = 0;
 		}
 
 		tree->attrib_parent[attrib_idx] = node;
-		tree->attrib_name[attrib_idx] = attrib_name;
-		tree->attrib_value[attrib_idx] = attrib_value;
+		tree->attrib_name[attrib_idx] = retain_token(parser, attrib_name);
+		tree->attrib_value[attrib_idx] = attrib_value? retain_token(parser, attrib_value) : 0;
 		++attrib_idx;
 
 		attrib_name = p;
 	}
 
-	EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_GREATERTHAN);
+	EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_GREATERTHAN);
 
 	tree->attrib_count = attrib_idx;
 	parser->current = p;
@@ -223,16 +345,22 @@ static int read_node_open_tag(struct html_parser_t *restrict parser)
 
 	html_token_idx_t p = parser->current;
 	html_token_idx_t tag_name = 0;
+	size_t retained_count = tree->tokens.count;
 
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_LESSTHAN);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_LESSTHAN);
 	tag_name = p;
-	EXPECT_TOKEN_2_1(tree, p, HTML_TOKEN_IDENTIFIER, HTML_TOKEN_HTML);
-	EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_2_1(parser, p, HTML_TOKEN_IDENTIFIER, HTML_TOKEN_HTML);
+	EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
 
 	/* By this time, we are pretty certain that we are parsing a tag. If we are wrong, we'll
-	 * reset the state to undo the push_node operation
+	 * reset the state to undo the push_node operation and drop the retained tokens
 	 */
-	push_node(parser, tag_name);
+	tag_name = retain_token(parser, tag_name);
+
+	/* the exception ends parsing */
+	if (push_node(parser, tag_name) != 0) {
+		return 1;
+	}
 
 	if (read_node_open_tag_attributes(parser, tag_name, p)) {
 		return 1;
@@ -240,25 +368,24 @@ static int read_node_open_tag(struct html_parser_t *restrict parser)
 
 	--parser->tree->node_count;
 	--parser->node_stack_size;
+	tree->tokens.count = retained_count;
 
 	return 0;
 }
 
 static int read_node_close_tag(struct html_parser_t *restrict parser)
 {
-	struct html_tree_t *restrict tree = parser->tree;
-
 	html_token_idx_t p = parser->current;
 	html_token_idx_t tag_name = 0;
 
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_LESSTHAN);
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_SLASH);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_LESSTHAN);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_SLASH);
 	tag_name = p;
-	EXPECT_TOKEN_2_1(tree, p, HTML_TOKEN_IDENTIFIER, HTML_TOKEN_HTML);
-	EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_GREATERTHAN);
+	EXPECT_TOKEN_2_1(parser, p, HTML_TOKEN_IDENTIFIER, HTML_TOKEN_HTML);
+	EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_GREATERTHAN);
 
-	pop_node(parser, tag_name);
+	pop_node(parser, parser->window, tag_name - parser->window_first);
 
 	parser->current = p;
 	return 1;
@@ -271,28 +398,72 @@ static int read_node_variable(struct html_parser_t *restrict parser)
 	html_token_idx_t p = parser->current;
 	html_token_idx_t var_name = 0;
 
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_OPENBRACE);
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_OPENBRACE);
-	EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_OPENBRACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_OPENBRACE);
+	EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
 	var_name = p;
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_IDENTIFIER);
-	EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_CLOSEBRACE);
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_CLOSEBRACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_IDENTIFIER);
+	EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_CLOSEBRACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_CLOSEBRACE);
 
+	var_name = retain_token(parser, var_name);
 	push_node(parser, var_name);
-	pop_node(parser, var_name);
+	pop_node(parser, &tree->tokens, var_name);
 
 	parser->current = p;
 	return 1;
 }
 
-static int read_node_text(struct html_parser_t *restrict parser)
+/* Comments and CDATA sections are skipped. Their tokens stop before the
+ * '-->' or ']]>' that ends them.
+ */
+static int read_node_markup(struct html_parser_t *restrict parser)
 {
-	struct html_tree_t *restrict tree = parser->tree;
+	html_token_idx_t p = parser->current;
+
+	switch (token_id(parser, p)) {
+	case HTML_TOKEN_COMMENT:
+		++p;
+		EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_HYPHEN);
+		EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_HYPHEN);
+		break;
+	case HTML_TOKEN_CDATA:
+		++p;
+		EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_TEXT);
+		break;
+	default:
+		return 0;
+	}
 
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_GREATERTHAN);
+
+	parser->current = p;
+	return 1;
+}
+
+/* The content of a raw text element is text, which its open tag precedes
+ * and its end tag follows like those of any other element
+ */
+static int read_node_text(struct html_parser_t *restrict parser)
+{
 	html_token_idx_t p = parser->current;
-	EXPECT_TOKEN_3_0N(tree, p, HTML_TOKEN_TEXT, HTML_TOKEN_WHITESPACE, HTML_TOKEN_IDENTIFIER);
+
+	for (;; ++p) {
+		switch (token_id(parser, p)) {
+		case HTML_TOKEN_TEXT:
+		case HTML_TOKEN_WHITESPACE:
+		case HTML_TOKEN_IDENTIFIER:
+		case HTML_TOKEN_ENTITY:
+		case HTML_TOKEN_SCRIPT:
+		case HTML_TOKEN_STYLE:
+		case HTML_TOKEN_TEXTAREA:
+		case HTML_TOKEN_TITLE:
+			continue;
+		}
+
+		break;
+	}
 
 	if (parser->current != p) {
 		parser->current = p;
@@ -304,57 +475,234 @@ static int read_node_text(struct html_parser_t *restrict parser)
 
 static int read_node_whitespace(struct html_parser_t *restrict parser)
 {
-	struct html_tree_t *restrict tree = parser->tree;
 	html_token_idx_t p = parser->current;
-	EXPECT_TOKEN_1_1(tree, p, HTML_TOKEN_WHITESPACE);
-	EXPECT_TOKEN_1_0N(tree, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_1_1(parser, p, HTML_TOKEN_WHITESPACE);
+	EXPECT_TOKEN_1_0N(parser, p, HTML_TOKEN_WHITESPACE);
 	parser->current = p;
 	return 1;
 }
 
+/* Token window */
+static void fill_window(struct html_parser_t *restrict parser)
+{
+	struct html_tokens_t *restrict window = parser->window;
+	size_t consumed = parser->current - parser->window_first;
+
+	/* the parser never goes back before 'current' */
+	if (consumed) {
+		size_t count = window->count - consumed;
+
+		memmove(window->offset, window->offset + consumed, count * sizeof(*window->offset));
+		memmove(window->size, window->size + consumed, count * sizeof(*window->size));
+		memmove(window->id, window->id + consumed, count * sizeof(*window->id));
+		memmove(window->name, window->name + consumed, count * sizeof(*window->name));
+
+		window->count = count;
+		window->id[count] = HTML_TOKEN_END;
+		parser->window_first = parser->current;
+	}
+
+	if (parser->lexer.position < parser->lexer.size)
+		html_lex_next(&parser->lexer, window, HTML_PARSER_LOOKAHEAD);
+}
+
+/* Copies token 'p' of the window to the tree and returns its index there */
+static html_token_idx_t retain_token(struct html_parser_t *restrict parser, html_token_idx_t p)
+{
+	struct html_tokens_t *restrict tokens = &parser->tree->tokens;
+	const struct html_tokens_t *restrict window = parser->window;
+	size_t i = tokens->count;
+	size_t w = p - parser->window_first;
+
+	if (__builtin_expect(i == tokens->capacity, 0) && html_tokens_reserve(tokens, 2 * i) != 0) {
+		parser->exception_pending = 1;
+		parser->exception_msg = "Not enough memory for tokens";
+		parser->exception_location = token_location(parser, p);
+		return 0;
+	}
+
+	tokens->offset[i] = window->offset[w];
+	tokens->size[i] = window->size[w];
+	tokens->id[i] = window->id[w];
+	tokens->name[i] = window->name[w];
+
+	tokens->count = i+1;
+	return i;
+}
+
 /* Parse tree operations */
-static void pop_node(struct html_parser_t *restrict parser, html_token_idx_t tag_name)
+/* Known names are equal if their ids are, other names compare their text
+ * ignoring ASCII case. Names may hold non-ASCII characters, so whole code
+ * units are compared.
+ */
+static int same_name(
+		const struct html_tokens_t *restrict tokens_a, html_token_idx_t a,
+		const struct html_tokens_t *restrict tokens_b, html_token_idx_t b)
+{
+	const char *text_a = html_token_begin(tokens_a, a);
+	const char *text_b = html_token_begin(tokens_b, b);
+	size_t unit_size = tokens_a->unit_size;
+	size_t size = html_token_bytes(tokens_a, a);
+
+	if (tokens_a->name[a] != tokens_b->name[b])
+		return 0;
+
+	if (tokens_a->name[a] != HTML_NAME_UNKNOWN)
+		return 1;
+
+	if (tokens_a->size[a] != tokens_b->size[b])
+		return 0;
+
+	for (size_t i = 0; i < size; i += unit_size) {
+		uint32_t ch_a = 0, ch_b = 0;
+
+		memcpy(&ch_a, text_a + i, unit_size);
+		memcpy(&ch_b, text_b + i, unit_size);
+
+		ch_a |= (ch_a - 'A' < 26) << 5;
+		ch_b |= (ch_b - 'A' < 26) << 5;
+
+		if (ch_a != ch_b)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* 'tag_name' is an index into 'tokens', which is either the window or the
+ * retained tokens
+ */
+static void pop_node(
+		struct html_parser_t *restrict parser, const struct html_tokens_t *tokens,
+		html_token_idx_t tag_name)
 {
 	struct html_tree_t *restrict tree = parser->tree;
-	html_token_id_t *restrict id = tree->tokens.id;
 	int32_t i;
 
 	for (i=parser->node_stack_size-1; i>0; --i) {
-		if (id[parser->node_stack[i]] == id[tag_name]) {
+		if (same_name(&tree->tokens, tree->stack[i], tokens, tag_name)) {
 			parser->node_stack_size = i;
 			return;
 		}
 	}
 }
 
-static void push_node(struct html_parser_t *restrict parser, html_token_idx_t tag_name)
+/* 'tag_name' is a retained token. Returns ENOMEM if the tree cannot grow,
+ * after raising the exception.
+ */
+static int push_node(struct html_parser_t *restrict parser, html_token_idx_t tag_name)
 {
 	struct html_tree_t *restrict tree = parser->tree;
 	size_t i = tree->node_count;
+	size_t depth = parser->node_stack_size;
+
+	if (__builtin_expect(i == tree->node_capacity, 0) && reserve_nodes(tree, 2 * i) != 0)
+		goto fail;
+
+	if (__builtin_expect(depth == tree->stack_capacity, 0) && reserve_stack(tree, 2 * depth) != 0)
+		goto fail;
+
+	tree->node_parent[i] = tree->stack[depth-1];
+	tree->node_tag_name[i] = tag_name;
+	tree->node_count = i+1;
+
+	tree->stack[depth] = tag_name;
+	parser->node_stack_size = depth+1;
+	return 0;
 
-	if (i < HTML_PARSER_MAX_NODES) {
-		tree->node_parent[i] = parser->node_stack[parser->node_stack_size-1];
-		tree->node_tag_name[i] = tag_name;
-		tree->node_count = i+1;
+fail:
+	parser->exception_pending = 1;
+	parser->exception_msg = "Not enough memory for tree";
+	parser->exception_location = html_token_begin(&tree->tokens, tag_name);
+	return ENOMEM;
+}
+
+/* Grows the 'array_count' arrays that 'arrays' points to, which share the
+ * allocation '*arena' and hold 'count' entries, to 'capacity' entries each.
+ * Returns ENOMEM if the memory cannot be allocated, in which case the arrays
+ * are unchanged.
+ */
+static int reserve_arrays(
+		void **arena, html_token_idx_t **const *arrays, size_t array_count, size_t count,
+		size_t capacity)
+{
+	size_t bytes = array_count * capacity * sizeof(html_token_idx_t);
+	html_token_idx_t *storage = malloc(bytes);
 
-		parser->node_stack[parser->node_stack_size] = tag_name;
-		++parser->node_stack_size;
+	if (__builtin_expect(storage == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", bytes);
+		return ENOMEM;
 	}
-	else {
-		parser->exception_pending = 1;
-		parser->exception_msg = "Not enough space for tree";
-		parser->exception_location = tag_name;
+
+	for (size_t i = 0; i < array_count; ++i) {
+		if (count)
+			memcpy(storage + i * capacity, *arrays[i], count * sizeof(html_token_idx_t));
+
+		*arrays[i] = storage + i * capacity;
 	}
+
+	free(*arena);
+	*arena = storage;
+	return 0;
 }
 
-static char *get_token_string(const struct html_tree_t *restrict tree, html_token_idx_t id)
+static int reserve_nodes(struct html_tree_t *tree, size_t capacity)
+{
+	html_token_idx_t **const arrays[] = { &tree->node_parent, &tree->node_tag_name };
+
+	if (capacity <= tree->node_capacity)
+		return 0;
+
+	if (reserve_arrays(&tree->node_arena, arrays, 2, tree->node_count, capacity) != 0)
+		return ENOMEM;
+
+	tree->node_capacity = capacity;
+	return 0;
+}
+
+/* 'count' attributes are kept, which may be more than tree->attrib_count */
+static int reserve_attributes(struct html_tree_t *tree, size_t count, size_t capacity)
+{
+	html_token_idx_t **const arrays[] = { &tree->attrib_parent, &tree->attrib_name, &tree->attrib_value };
+
+	if (capacity <= tree->attrib_capacity)
+		return 0;
+
+	if (reserve_arrays(&tree->attrib_arena, arrays, 3, count, capacity) != 0)
+		return ENOMEM;
+
+	tree->attrib_capacity = capacity;
+	return 0;
+}
+
+static int reserve_stack(struct html_tree_t *tree, size_t capacity)
+{
+	if (capacity <= tree->stack_capacity)
+		return 0;
+
+	html_token_idx_t *stack = realloc(tree->stack, capacity * sizeof(*stack));
+
+	if (__builtin_expect(stack == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", capacity * sizeof(*stack));
+		return ENOMEM;
+	}
+
+	tree->stack = stack;
+	tree->stack_capacity = capacity;
+	return 0;
+}
+
+static char *get_token_string(
+		const struct html_tokens_t *restrict tokens, unicode_encoding_t encoding,
+		html_token_idx_t id)
 {
 	char *str;
 	size_t size = 1;
-	const utf32_t *begin = tree->tokens.begin[id];
-	const utf32_t *end = tree->tokens.end[id];
+	const char *begin = html_token_begin(tokens, id);
+
+	unicode_write_utf8_string_adaptive(begin, tokens->size[id], encoding, &str, &size);
 
-	unicode_write_utf8_string(begin, end-begin, &str, &size);
+	/* guaranteed space because the inital value of 'size' is 1 */
 	str[size] = 0;
 
 	return str;
@@ -367,8 +715,8 @@ static void dump_parse_table(struct html_parser_t *restrict parser)
 
 	printf("nodes:\n");
 	for (i=0; i < tree->node_count; ++i) {
-		char *parent = get_token_string(tree, tree->node_parent[i]);
-		char *tag_name = get_token_string(tree, tree->node_tag_name[i]);
+		char *parent = get_token_string(&tree->tokens, tree->encoding, tree->node_parent[i]);
+		char *tag_name = get_token_string(&tree->tokens, tree->encoding, tree->node_tag_name[i]);
 
 		printf("\ttag[%s]\tparent[%s]\n", tag_name, tree->node_parent[i]? parent : "");
 
@@ -378,9 +726,9 @@ static void dump_parse_table(struct html_parser_t *restrict parser)
 
 	printf("\nattributes:\n");
 	for (i=0; i < tree->attrib_count; ++i) {
-		char *parent = get_token_string(tree, tree->attrib_parent[i]);
-		char *name = get_token_string(tree, tree->attrib_name[i]);
-		char *value = get_token_string(tree, tree->attrib_value[i]);
+		char *parent = get_token_string(&tree->tokens, tree->encoding, tree->attrib_parent[i]);
+		char *name = get_token_string(&tree->tokens, tree->encoding, tree->attrib_name[i]);
+		char *value = get_token_string(&tree->tokens, tree->encoding, tree->attrib_value[i]);
 
 		printf("\tname[%s]\tvalue[%s]\tparent[%s]\n", name, tree->attrib_value[i] ? value : "true", parent);
 
@@ -391,17 +739,12 @@ static void dump_parse_table(struct html_parser_t *restrict parser)
 }
 
 #ifdef TRACE_TOKENS
-static void trace_token(html_token_id_t token_id, const utf32_t *restrict in_data, size_t in_size)
+static void trace_token(struct html_parser_t *restrict parser, html_token_idx_t p)
 {
-	char *str;
-	size_t size = 1;
+	html_token_idx_t idx = p - parser->window_first;
+	char *str = get_token_string(parser->window, parser->tree->encoding, idx);
 
-	unicode_write_utf8_string(in_data, in_size, &str, &size);
-
-	/* guaranteed space because the inital value of 'size' is 1 */
-	str[size] = 0;
-
-	switch (token_id) {
+	switch (parser->window->id[idx]) {
 	case HTML_TOKEN_GREATERTHAN:
 		printf("[>] '%s'\n", str);
 		break;
@@ -483,49 +826,91 @@ static void trace_token(html_token_id_t token_id, const utf32_t *restrict in_dat
 	case HTML_TOKEN_STYLE:
 		printf("[style]: '%s'\n", str);
 		break;
+	case HTML_TOKEN_ENTITY:
+		printf("[entity]: '%s'\n", str);
+		break;
+	case HTML_TOKEN_TEXTAREA:
+		printf("[textarea]: '%s'\n", str);
+		break;
+	case HTML_TOKEN_TITLE:
+		printf("[title]: '%s'\n", str);
+		break;
+	case HTML_TOKEN_CDATA:
+		printf("[cdata]: '%s'\n", str);
+		break;
 	}
 
 	unicode_utf8_string_free(&str, 1);
 }
 #endif
 
+/* Writes 'ch', an ASCII character, as a code unit of the output encoding */
+static void append_char(struct html_builder_t *builder, char ch)
+{
+	char *restrict out = builder->output + builder->current;
+
+	switch (builder->unit_size) {
+	case 1:
+		*out = ch;
+		break;
+	case 2:
+		*(uint16_t *) out = ch;
+		break;
+	default:
+		*(utf32_t *) out = ch;
+		break;
+	}
+
+	builder->current += builder->unit_size;
+	builder->max_size -= builder->unit_size;
+}
+
 static void append_token(struct html_builder_t *builder, html_token_idx_t token_idx)
 {
-	const utf32_t *begin = builder->tokens->begin[token_idx];
-	size_t size = builder->tokens->end[token_idx] - begin;
-	memcpy(builder->output + builder->current, begin, size * sizeof(utf32_t));
+	const char *begin = html_token_begin(builder->tokens, token_idx);
+	size_t size = html_token_bytes(builder->tokens, token_idx);
+	memcpy(builder->output + builder->current, begin, size);
 	builder->current += size;
 	builder->max_size -= size;
 }
 
-void html_build(
-		utf32_t *restrict *restrict out_data, size_t *restrict out_size,
+int html_build(
+		void *restrict *restrict out_data, size_t *restrict out_size,
 		const struct html_tree_t *restrict tree)
 {
-	/* create a lookup table to locate an instance of a token given its id */
-	html_token_idx_t token_idx[HTML_TOKEN_END];
+	const size_t unit_size = unicode_unit_size(tree->encoding);
 	const struct html_tokens_t *restrict tokens = &tree->tokens;
-	html_token_idx_t idx;
 
-	for (idx=0; idx < tokens->count; ++idx) {
-		html_token_id_t id = tokens->id[idx];
-		token_idx[id] = idx;
-	}
-
-	/* node stack */
-	html_token_idx_t node_stack[HTML_PARSER_MAX_STACK_SIZE];
+	/* node stack, no deeper than the tree */
+	html_token_idx_t *node_stack;
 	size_t node_stack_size = 0;
 
-	/* allocate memory for output data */
-	*out_size = HTML_PARSER_MAX_SIZE;
-	*out_data = malloc(HTML_PARSER_MAX_SIZE * sizeof(utf32_t));
-
 	size_t i;
+	size_t size = 0;
 	struct html_builder_t builder = {0};
 
+	/* every node is written as '<', its name, '>', '</', its name and '>' */
+	for (i=0; i < tree->node_count; ++i)
+		size += 2 * tokens->size[tree->node_tag_name[i]] + 5;
+
+	/* allocate memory for output data */
+	*out_size = 0;
+	*out_data = malloc(size * unit_size);
+	node_stack = malloc(tree->node_count * sizeof(*node_stack));
+
+	if (__builtin_expect((*out_data == 0 || node_stack == 0) && tree->node_count, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+				size * unit_size + tree->node_count * sizeof(*node_stack));
+		free(*out_data);
+		free(node_stack);
+		*out_data = 0;
+		return ENOMEM;
+	}
+
 	builder.tokens = tokens;
+	builder.unit_size = unit_size;
 	builder.output = *out_data;
-	builder.max_size = HTML_PARSER_MAX_SIZE;
+	builder.max_size = size * unit_size;
 
 	for (i=0; i < tree->node_count; ++i) {
 		html_token_idx_t tag_name = tree->node_tag_name[i];
@@ -533,32 +918,44 @@ void html_build(
 
 		/* write closing tags if we moved to a sibling node or a parent node */
 		while (node_stack_size > 0 && parent != node_stack[node_stack_size-1]) {
-			append_token(&builder, token_idx[HTML_TOKEN_LESSTHAN]);
-			append_token(&builder, token_idx[HTML_TOKEN_SLASH]);
+			append_char(&builder, '<');
+			append_char(&builder, '/');
 			append_token(&builder, node_stack[node_stack_size-1]);
-			append_token(&builder, token_idx[HTML_TOKEN_GREATERTHAN]);
+			append_char(&builder, '>');
 
 			--node_stack_size;
 		}
 
-		append_token(&builder, token_idx[HTML_TOKEN_LESSTHAN]);
+		append_char(&builder, '<');
 		append_token(&builder, tag_name);
-		append_token(&builder, token_idx[HTML_TOKEN_GREATERTHAN]);
+		append_char(&builder, '>');
 
 		node_stack[node_stack_size] = tag_name;
 		++node_stack_size;
 	}
 
 	for (; node_stack_size > 0; --node_stack_size) {
-		append_token(&builder, token_idx[HTML_TOKEN_LESSTHAN]);
-		append_token(&builder, token_idx[HTML_TOKEN_SLASH]);
+		append_char(&builder, '<');
+		append_char(&builder, '/');
 		append_token(&builder, node_stack[node_stack_size-1]);
-		append_token(&builder, token_idx[HTML_TOKEN_GREATERTHAN]);
+		append_char(&builder, '>');
 	}
 
+	free(node_stack);
 
-	*out_size = builder.current;
+	*out_size = builder.current / unit_size;
+	return 0;
 }
 
+void html_tree_free(struct html_tree_t *tree)
+{
+	html_tokens_free(&tree->tokens);
+	html_tokens_free(&tree->window);
+	html_lines_free(&tree->lines);
 
+	free(tree->node_arena);
+	free(tree->attrib_arena);
+	free(tree->stack);
 
+	*tree = (struct html_tree_t) {0};
+}
@@ -8,15 +8,21 @@
 #ifndef HTML_PARSER_H
 #define HTML_PARSER_H
 
+#include <html_names.h>
 #include <unicode.h>
 #include <stddef.h>
 #include <stdint.h>
 
-#define HTML_PARSER_MAX_TOKENS      2048
-#define HTML_PARSER_MAX_NODES       1024
-#define HTML_PARSER_MAX_ATTRIBUTES  2048
-#define HTML_PARSER_MAX_SIZE        65536    /* in characters */
-#define HTML_PARSER_MAX_STACK_SIZE  1000
+#define HTML_PARSER_MIN_TOKENS      1024     /* initial token capacity */
+#define HTML_PARSER_LOOKAHEAD       64       /* tokens lexed at a time while parsing */
+#define HTML_PARSER_MIN_LINES       256      /* initial line index capacity */
+#define HTML_PARSER_MIN_SEGMENT     262144   /* in code units, lexed by one thread */
+#define HTML_PARSER_MAX_THREADS     64
+#define HTML_PARSER_MIN_NODES       256      /* initial node capacity */
+#define HTML_PARSER_MIN_ATTRIBUTES  256      /* initial attribute capacity */
+#define HTML_PARSER_MIN_STACK_SIZE  64       /* initial open node capacity */
+#define HTML_PARSER_PADDING         64       /* in bytes, zero-filled after the input */
+#define HTML_PARSER_MAX_INPUT_SIZE  UINT32_MAX /* in code units, for 32-bit token offsets */
 
 enum {
 	HTML_TOKEN_GREATERTHAN,
@@ -47,40 +53,122 @@ enum {
 	HTML_TOKEN_COMMENT,
 	HTML_TOKEN_STYLE,
 	HTML_TOKEN_INCLUDE,
+	HTML_TOKEN_ENTITY,
+	HTML_TOKEN_TEXTAREA,
+	HTML_TOKEN_TITLE,
+	HTML_TOKEN_CDATA,
 	HTML_TOKEN_END
 };
 
 /* Must be less than HTML_TOKEN_END */
 typedef uint8_t html_token_id_t;
 
-/* Must be less than HTML_PARSER_MAX_TOKENS */
-typedef uint16_t html_token_idx_t;
+/* Must be less than the token capacity */
+typedef uint32_t html_token_idx_t;
 
+/* Tokens are located by their offset and size in code units of the input,
+ * whatever its encoding is, so the arrays hold no pointers. Identifiers and
+ * keywords also carry the name they spell, and the content of raw text
+ * elements, such as a script, the name of the element. The name is
+ * HTML_NAME_UNKNOWN for every other token.
+ *
+ * The arrays share a single allocation, 'arena', which doubles when it is
+ * full. Lexing another document into the same tokens keeps the capacity.
+ */
 struct html_tokens_t {
-	const utf32_t *begin[HTML_PARSER_MAX_TOKENS];
-	const utf32_t *end[HTML_PARSER_MAX_TOKENS];
-	html_token_id_t id[HTML_PARSER_MAX_TOKENS];
+	uint32_t *offset;
+	uint32_t *size;
+	html_token_id_t *id;
+	html_name_id_t *name;
 	size_t count;
+	size_t capacity;
+
+	/* the lexed input and the size of its code units */
+	const char *base;
+	size_t unit_size;
+
+	void *arena;
 };
 
+/* Returns a pointer to the first code unit of token 'i' */
+static inline const char *html_token_begin(const struct html_tokens_t *tokens, html_token_idx_t i)
+{
+	return tokens->base + (size_t) tokens->offset[i] * tokens->unit_size;
+}
+
+/* Returns the size of token 'i' in bytes */
+static inline size_t html_token_bytes(const struct html_tokens_t *tokens, html_token_idx_t i)
+{
+	return (size_t) tokens->size[i] * tokens->unit_size;
+}
+
+/* The offsets in code units of the line starts of an input, for diagnostics.
+ * Lines are indexed lazily, as far as the furthest location looked up so far,
+ * which is 'scanned'. Clearing the index for another input keeps the storage.
+ */
+struct html_lines_t {
+	uint32_t *start;
+	size_t count;
+	size_t capacity;
+	size_t scanned;
+};
+
+/* The tree refers to its tag names, attributes and variables by their index
+ * in 'tokens', which only holds these tokens. Index 0 is no token. 'window'
+ * holds the tokens that the parser looks ahead at.
+ *
+ * The node arrays share the allocation 'node_arena' and the attribute arrays
+ * 'attrib_arena', which double when they are full, like the arrays of the
+ * tokens. 'stack' holds the tag names of the open nodes while parsing.
+ * Parsing another document into the same tree reuses all of them without
+ * clearing them, so a tree is best kept for the documents that follow.
+ */
 struct html_tree_t {
 	struct html_tokens_t tokens;
+	struct html_tokens_t window;
+	struct html_lines_t lines;
 
-	html_token_idx_t node_parent[HTML_PARSER_MAX_NODES];
-	html_token_idx_t node_tag_name[HTML_PARSER_MAX_NODES];
-
-	html_token_idx_t attrib_parent[HTML_PARSER_MAX_ATTRIBUTES];
-	html_token_idx_t attrib_name[HTML_PARSER_MAX_ATTRIBUTES];
-	html_token_idx_t attrib_value[HTML_PARSER_MAX_ATTRIBUTES];
+	html_token_idx_t *node_parent;
+	html_token_idx_t *node_tag_name;
+	size_t node_count;
+	size_t node_capacity;
+	void *node_arena;
 
+	html_token_idx_t *attrib_parent;
+	html_token_idx_t *attrib_name;
+	html_token_idx_t *attrib_value;
 	size_t attrib_count;
-	size_t node_count;
+	size_t attrib_capacity;
+	void *attrib_arena;
+
+	html_token_idx_t *stack;
+	size_t stack_capacity;
+
+	unicode_encoding_t encoding;
+
+	/* set by the caller: lex large inputs on this many threads before parsing */
+	unsigned int lex_threads;
 };
 
-int html_parse(const utf32_t *restrict in_data, size_t in_size, struct html_tree_t *restrict tree);
-void html_build(
-		utf32_t *restrict *restrict out_data, size_t *restrict out_size,
+/* Parses 'in_size' code units of 'in_data'. The input must be followed by
+ * HTML_PARSER_PADDING zero bytes. 'tree' is either zero-initialized or holds
+ * a previous document, whose storage is reused.
+ */
+int html_parse(
+		const void *restrict in_data, size_t in_size, unicode_encoding_t encoding,
+		struct html_tree_t *restrict tree);
+
+/* Builds the document described by 'tree' into '*out_data', which the caller
+ * frees. The output is in the encoding of the parsed input and 'out_size' is
+ * in code units of that encoding. Returns ENOMEM if the output cannot be
+ * allocated.
+ */
+int html_build(
+		void *restrict *restrict out_data, size_t *restrict out_size,
 		const struct html_tree_t *restrict tree);
 
+/* Releases the storage of 'tree' */
+void html_tree_free(struct html_tree_t *tree);
+
 #endif
 
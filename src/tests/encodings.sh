@@ -0,0 +1,32 @@
+#!/bin/sh
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# encodings.sh
+#
+# Usage: encodings.sh <web-cc> <input>
+#
+# Compiles 'input' as utf-8, as utf-32 and in the narrowest encoding that
+# fits it. The documents, the parse tables and the error messages must be
+# the same as those of the utf-8 input.
+
+web_cc=$1
+input=$2
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+
+for encoding in utf8 utf32 auto; do
+	"$web_cc" -e $encoding -o "$dir/$encoding" "$input" > "$dir/$encoding.log" 2>&1
+
+	# an input with a syntax error produces no document
+	touch "$dir/$encoding/0.html"
+done
+
+status=0
+for encoding in utf32 auto; do
+	if ! cmp "$dir/utf8/0.html" "$dir/$encoding/0.html" || ! diff -u "$dir/utf8.log" "$dir/$encoding.log"; then
+		echo "$input: the $encoding output differs from utf8"
+		status=1
+	fi
+done
+
+exit $status
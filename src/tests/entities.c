@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * entities.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Lexes character references and checks the code points that
+ * html_entity_decode finds in their tokens, in every encoding
+ */
+
+#include <html_lexer.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct entity_case_t {
+	const char *text;
+
+	/* the code points of the reference, none if it is not one */
+	size_t count;
+	uint32_t code_points[2];
+};
+
+static const struct entity_case_t cases[] = {
+	/* named */
+	{ "&amp;",              1, { 0x26 } },
+	{ "&AMP;",              1, { 0x26 } },
+	{ "&notin;",            1, { 0x2209 } },
+	{ "&hearts;",           1, { 0x2665 } },
+	{ "&fjlig;",            2, { 0x66, 0x6a } },
+	{ "&NotEqualTilde;",    2, { 0x2242, 0x338 } },
+
+	/* decimal and hexadecimal */
+	{ "&#65;",              1, { 0x41 } },
+	{ "&#0233;",            1, { 0xe9 } },
+	{ "&#x1F600;",          1, { 0x1f600 } },
+	{ "&#X1f600;",          1, { 0x1f600 } },
+	{ "&#x10FFFF;",         1, { 0x10ffff } },
+
+	/* invalid code points are replaced */
+	{ "&#0;",               1, { 0xfffd } },
+	{ "&#xD800;",           1, { 0xfffd } },
+	{ "&#57343;",           1, { 0xfffd } },
+	{ "&#x110000;",         1, { 0xfffd } },
+	{ "&#99999999999999999999;", 1, { 0xfffd } },
+	{ "&#x00000000000041;", 1, { 0x41 } },
+	{ "&#xFFFFFFFFFFFFFFFF;", 1, { 0xfffd } },
+
+	/* the C1 controls that Windows-1252 assigns */
+	{ "&#128;",             1, { 0x20ac } },
+	{ "&#x9F;",             1, { 0x178 } },
+	{ "&#x81;",             1, { 0x81 } },
+
+	/* not references */
+	{ "&notanentity;",      0, { 0 } },
+	{ "&amp",               0, { 0 } },
+	{ "&#65",               0, { 0 } },
+	{ "&#;",                0, { 0 } },
+	{ "&#x;",               0, { 0 } },
+	{ "& amp;",             0, { 0 } },
+};
+
+static const unicode_encoding_t encodings[] = {
+	UNICODE_ENCODING_UTF8,
+	UNICODE_ENCODING_LATIN1,
+	UNICODE_ENCODING_UCS2,
+	UNICODE_ENCODING_UTF32,
+};
+
+static const char *const encoding_names[] = {
+	[UNICODE_ENCODING_UTF8] = "utf8",
+	[UNICODE_ENCODING_LATIN1] = "latin1",
+	[UNICODE_ENCODING_UCS2] = "ucs2",
+	[UNICODE_ENCODING_UTF32] = "utf32",
+};
+
+/* Stores the ASCII string 'in' in 'encoding' at 'out' and returns its size */
+static size_t encode(const char *in, unicode_encoding_t encoding, void *out)
+{
+	size_t size = strlen(in);
+
+	for (size_t i = 0; i < size; ++i) {
+		switch (unicode_unit_size(encoding)) {
+		case 1:
+			((uint8_t *) out)[i] = in[i];
+			break;
+		case 2:
+			((uint16_t *) out)[i] = in[i];
+			break;
+		default:
+			((utf32_t *) out)[i] = in[i];
+			break;
+		}
+	}
+
+	return size;
+}
+
+static int check(
+		const struct entity_case_t *entity_case, unicode_encoding_t encoding,
+		struct html_tokens_t *restrict tokens)
+{
+	char data[64 * sizeof(utf32_t) + HTML_PARSER_PADDING] = {0};
+	size_t size = encode(entity_case->text, encoding, data);
+	uint32_t code_points[2] = {0};
+	size_t count;
+
+	if (html_lex(data, size, encoding, tokens) != 0)
+		return 1;
+
+	count = html_entity_decode(tokens, 0, code_points);
+
+	/* a reference is one token that spans all of it */
+	if (count && (tokens->count != 1 || tokens->size[0] != size))
+		return 1;
+
+	if (count != entity_case->count)
+		return 1;
+
+	for (size_t i = 0; i < count; ++i) {
+		if (code_points[i] != entity_case->code_points[i])
+			return 1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	struct html_tokens_t tokens = {0};
+	int failed = 0;
+
+	for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+		for (size_t e = 0; e < sizeof(encodings) / sizeof(encodings[0]); ++e) {
+			if (check(&cases[c], encodings[e], &tokens) != 0) {
+				fprintf(stderr, "%s (%s): wrong code points\n",
+						cases[c].text, encoding_names[e]);
+				failed = 1;
+			}
+		}
+	}
+
+	html_tokens_free(&tokens);
+	return failed;
+}
@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * lex_parallel.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Lexes documents with html_lex_parallel on 2 to 8 threads and checks that
+ * the tokens are those that html_lex finds, in every encoding. The segments
+ * of one document start inside comments, scripts and the other constructs
+ * whose content has a '<' at the start of a line, and the other document is
+ * made of random fragments, many of which leave such a construct open.
+ */
+
+#include <html_lexer.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define THREADS_MIN 2
+#define THREADS_MAX 8
+
+/* large enough for every thread count to get a segment of its own */
+#define DOCUMENT_SIZE (THREADS_MAX * HTML_PARSER_MIN_SEGMENT + 4096)
+
+/* the markup that fills the document between the constructs, which is
+ * ASCII so that the positions of the code units are those of the bytes
+ */
+static const char filler[] = "<p class=\"x\">cafe &amp; {{ v }}</p>\n";
+
+/* constructs with a '<' at the start of a line inside, which is where the
+ * segment that starts in them begins
+ */
+static const char *const constructs[] = {
+	"<!-- a\n<p>commented out</p> -->",
+	"<script>if (a\n< b) { f(\"</p>\"); }</script>",
+	"<style>p\n< a { color: red }</style>",
+	"<p title=\"a\n<b\">x</p>",
+	"<p><![CDATA[ a\n<b> ]]></p>",
+	"<title>a\n<b {{ t }}</title>",
+	"<textarea>a\n<b &amp; c</textarea>",
+};
+
+/* the fragments of the random document */
+static const char *const fragments[] = {
+	"\n<script src=\"a.js\">", "if (a<b) {{ x }}", "</script>", "\n<title>", "{{ t }}", "&amp;",
+	"&bogus;", "{ {", "}}", "</title>", "\n<textarea data=\"r\">", "</textarea>", "<style>",
+	"p>a{}", "</style>", "\n<p class='x'>", "text ", "</p>", "<!-- c ", "-->", "<![CDATA[ x ",
+	"]]>", "\"str<ing\"", "'q'", "\n<", "<scriptx>", "<title", ">", "\n", "  ", "\xc3\xa9",
+	"{{", "&#65;",
+};
+
+static const unicode_encoding_t encodings[] = {
+	UNICODE_ENCODING_UTF8,
+	UNICODE_ENCODING_LATIN1,
+	UNICODE_ENCODING_UCS2,
+	UNICODE_ENCODING_UTF32,
+};
+
+static const char *const encoding_names[] = {
+	[UNICODE_ENCODING_UTF8] = "utf8",
+	[UNICODE_ENCODING_LATIN1] = "latin1",
+	[UNICODE_ENCODING_UCS2] = "ucs2",
+	[UNICODE_ENCODING_UTF32] = "utf32",
+};
+
+static uint32_t seed = 1;
+
+static uint32_t next_random(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 1;
+}
+
+/* Returns the position of the newline in 'text' */
+static size_t newline_at(const char *text)
+{
+	return strchr(text, '\n') - text;
+}
+
+/* Builds a document of DOCUMENT_SIZE bytes of filler with a construct at
+ * every point where some thread count starts to search for the end of a
+ * segment, so that the first boundary after it is inside the construct.
+ * Returns its size.
+ */
+static size_t build_constructs(char *out)
+{
+	size_t size = 0, next = 0;
+
+	while (size < DOCUMENT_SIZE) {
+		size_t point = DOCUMENT_SIZE, n;
+
+		/* the next point, in the order of the document */
+		for (size_t t = THREADS_MIN; t <= THREADS_MAX; ++t) {
+			for (size_t i = 1; i < t; ++i) {
+				size_t p = i * (DOCUMENT_SIZE / t);
+
+				if (p >= size + 64 && p < point)
+					point = p;
+			}
+		}
+
+		const char *construct = constructs[next % (sizeof(constructs) / sizeof(constructs[0]))];
+		size_t begin = (point < DOCUMENT_SIZE)? point - newline_at(construct) : DOCUMENT_SIZE;
+
+		for (; begin - size >= sizeof(filler) - 1; size += sizeof(filler) - 1)
+			memcpy(out + size, filler, sizeof(filler) - 1);
+
+		memset(out + size, ' ', begin - size);
+		size = begin;
+
+		if (point == DOCUMENT_SIZE)
+			break;
+
+		n = strlen(construct);
+		memcpy(out + size, construct, n);
+		size += n;
+		++next;
+	}
+
+	return size;
+}
+
+/* Builds a document of random fragments and returns its size */
+static size_t build_fragments(char *out)
+{
+	size_t size = 0;
+
+	for (;;) {
+		const char *fragment = fragments[next_random() % (sizeof(fragments) / sizeof(fragments[0]))];
+		size_t n = strlen(fragment);
+
+		if (size + n > DOCUMENT_SIZE)
+			break;
+
+		memcpy(out + size, fragment, n);
+		size += n;
+	}
+
+	return size;
+}
+
+/* Stores the 'size' bytes of utf-8 'in', whose characters are at most U+00FF,
+ * in 'encoding' at 'out', followed by the padding. Returns the number of
+ * code units.
+ */
+static size_t encode(const char *in, size_t size, unicode_encoding_t encoding, void *out)
+{
+	const uint8_t *p = (const uint8_t *) in, *end = p + size;
+	size_t n = 0;
+
+	while (p < end) {
+		uint32_t ch = *p++;
+
+		if (encoding != UNICODE_ENCODING_UTF8 && ch >= 0xc0)
+			ch = (ch & 0x1f) << 6 | (*p++ & 0x3f);
+
+		switch (unicode_unit_size(encoding)) {
+		case 1:
+			((uint8_t *) out)[n++] = ch;
+			break;
+		case 2:
+			((uint16_t *) out)[n++] = ch;
+			break;
+		default:
+			((utf32_t *) out)[n++] = ch;
+			break;
+		}
+	}
+
+	memset((char *) out + n * unicode_unit_size(encoding), 0, HTML_PARSER_PADDING);
+	return n;
+}
+
+static int compare(const struct html_tokens_t *a, const struct html_tokens_t *b)
+{
+	if (a->count != b->count)
+		return 1;
+
+	for (size_t i = 0; i < a->count; ++i) {
+		if (a->offset[i] != b->offset[i] || a->size[i] != b->size[i] ||
+				a->id[i] != b->id[i] || a->name[i] != b->name[i])
+			return 1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	static const char *const document_names[] = { "constructs", "fragments" };
+	struct html_tokens_t whole = {0}, parallel = {0};
+	char *text = malloc(DOCUMENT_SIZE);
+	void *data = malloc(DOCUMENT_SIZE * sizeof(utf32_t) + HTML_PARSER_PADDING);
+	int failed = 0;
+
+	if (__builtin_expect(text == 0 || data == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+				DOCUMENT_SIZE + DOCUMENT_SIZE * sizeof(utf32_t) + HTML_PARSER_PADDING);
+		free(text);
+		free(data);
+		return 1;
+	}
+
+	for (size_t d = 0; d < 2; ++d) {
+		size_t text_size = (d == 0)? build_constructs(text) : build_fragments(text);
+
+		for (size_t e = 0; e < sizeof(encodings) / sizeof(encodings[0]); ++e) {
+			size_t size = encode(text, text_size, encodings[e], data);
+			int rc = html_lex(data, size, encodings[e], &whole);
+
+			for (unsigned int t = THREADS_MIN; t <= THREADS_MAX; ++t) {
+				if (html_lex_parallel(data, size, encodings[e], &parallel, t) != rc ||
+						(rc == 0 && compare(&whole, &parallel) != 0)) {
+					fprintf(stderr, "%s (%s): %u threads differ from html_lex\n",
+							document_names[d], encoding_names[encodings[e]], t);
+					failed = 1;
+				}
+			}
+		}
+	}
+
+	html_tokens_free(&whole);
+	html_tokens_free(&parallel);
+	free(text);
+	free(data);
+	return failed;
+}
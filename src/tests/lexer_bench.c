@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * lexer_bench.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Measures how many tokens per second html_lex finds in a template of a few
+ * megabytes, in every encoding. The template repeats the markup of a listing
+ * page: elements with attributes, text with character references, template
+ * variables, comments and the occasional script and style. Each figure is
+ * the best of a few runs.
+ */
+
+#include <html_lexer.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define RUNS 5
+#define DOCUMENT_SIZE (4 << 20)
+
+/* the parts of the template, which only has characters that every encoding
+ * holds, with U+00E9 as its utf-8 bytes
+ */
+static const char *const parts[] = {
+	"<div class=\"card\" id=\"item\" data-index=\"7\">\n",
+	"  <h2 class=\"title\">{{ item.title }}</h2>\n",
+	"  <p>Lorem ipsum dolor sit amet, consectetur adipiscing elit &amp; sed do "
+		"eiusmod tempor caf\xc3\xa9 incididunt ut labore.</p>\n",
+	"  <a href=\"/items/{{ item.id }}\" title='Open'>Read more &rarr;</a>\n",
+	"  <!-- the footer of the card -->\n",
+	"  <ul><li>one</li><li>two</li><li>{{ item.count }}</li></ul>\n",
+	"</div>\n",
+};
+
+/* the blocks that come after every few cards */
+static const char *const blocks[] = {
+	"<script type=\"module\">\nfor (let i = 0; i < items.length; ++i) {\n"
+		"  if (items[i].id > 0 && items[i].visible) render(items[i]);\n}\n</script>\n",
+	"<style>\n.card > .title { font-weight: bold; color: #333 }\n"
+		".card a:hover { text-decoration: underline }\n</style>\n",
+};
+
+static const unicode_encoding_t encodings[] = {
+	UNICODE_ENCODING_UTF8,
+	UNICODE_ENCODING_LATIN1,
+	UNICODE_ENCODING_UCS2,
+	UNICODE_ENCODING_UTF32,
+};
+
+static const char *const encoding_names[] = {
+	[UNICODE_ENCODING_UTF8] = "utf8",
+	[UNICODE_ENCODING_LATIN1] = "latin1",
+	[UNICODE_ENCODING_UCS2] = "ucs2",
+	[UNICODE_ENCODING_UTF32] = "utf32",
+};
+
+static double elapsed_ms(const struct timespec *begin, const struct timespec *end)
+{
+	return (end->tv_sec - begin->tv_sec) * 1e3 + (end->tv_nsec - begin->tv_nsec) / 1e6;
+}
+
+/* Appends 'text' in 'encoding' to 'out' at code unit 'size' and returns the
+ * new size
+ */
+static size_t append(const char *text, unicode_encoding_t encoding, void *out, size_t size)
+{
+	const uint8_t *p = (const uint8_t *) text;
+
+	while (*p) {
+		uint32_t ch = *p++;
+
+		if (encoding != UNICODE_ENCODING_UTF8 && ch >= 0xc0)
+			ch = (ch & 0x1f) << 6 | (*p++ & 0x3f);
+
+		switch (unicode_unit_size(encoding)) {
+		case 1:
+			((uint8_t *) out)[size++] = ch;
+			break;
+		case 2:
+			((uint16_t *) out)[size++] = ch;
+			break;
+		default:
+			((utf32_t *) out)[size++] = ch;
+			break;
+		}
+	}
+
+	return size;
+}
+
+/* Writes the template in 'encoding' into 'out', followed by the padding, and
+ * returns its size in code units, which is at most DOCUMENT_SIZE
+ */
+static size_t build_document(unicode_encoding_t encoding, void *out)
+{
+	size_t size = 0, cards = 0;
+
+	for (;;) {
+		const char *block = blocks[cards % 2];
+
+		for (size_t i = 0; i < sizeof(parts) / sizeof(parts[0]); ++i) {
+			if (size + strlen(parts[i]) + strlen(block) > DOCUMENT_SIZE)
+				goto exit1;
+
+			size = append(parts[i], encoding, out, size);
+		}
+
+		if (++cards % 8 == 0)
+			size = append(block, encoding, out, size);
+	}
+
+exit1:
+	memset((char *) out + size * unicode_unit_size(encoding), 0, HTML_PARSER_PADDING);
+	return size;
+}
+
+int main(void)
+{
+	struct html_tokens_t tokens = {0};
+	void *document = malloc(DOCUMENT_SIZE * sizeof(utf32_t) + HTML_PARSER_PADDING);
+	int rc = 0;
+
+	if (__builtin_expect(document == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+				DOCUMENT_SIZE * sizeof(utf32_t) + HTML_PARSER_PADDING);
+		return 1;
+	}
+
+	printf("%-8s %10s %12s %10s\n", "", "tokens", "Mtokens/s", "MB/s");
+
+	for (size_t e = 0; e < sizeof(encodings) / sizeof(encodings[0]); ++e) {
+		size_t size = build_document(encodings[e], document);
+		double best = 1e30;
+
+		for (int run = 0; run < RUNS; ++run) {
+			struct timespec begin, end;
+
+			clock_gettime(CLOCK_MONOTONIC, &begin);
+			rc = html_lex(document, size, encodings[e], &tokens);
+			clock_gettime(CLOCK_MONOTONIC, &end);
+
+			if (__builtin_expect(rc != 0, 0)) {
+				fprintf(stderr, "%s: html_lex failed\n", encoding_names[encodings[e]]);
+				goto cleanup;
+			}
+
+			best = (elapsed_ms(&begin, &end) < best)? elapsed_ms(&begin, &end) : best;
+		}
+
+		printf("%-8s %10ld %12.1f %10.0f\n", encoding_names[encodings[e]], (long) tokens.count,
+				tokens.count / best / 1e3, size * unicode_unit_size(encodings[e]) / best / 1e3);
+	}
+
+cleanup:
+	html_tokens_free(&tokens);
+	free(document);
+	return rc;
+}
@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * lexer_chunks.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Lexes documents a chunk at a time with html_lex_next and html_lexer_shift,
+ * and checks that the tokens are those that html_lex finds in the whole input
+ */
+
+#include <html_lexer.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* tokens with the offsets in code units from the start of the document */
+struct token_list_t {
+	uint32_t offset[1024];
+	uint32_t size[1024];
+	html_token_id_t id[1024];
+	html_name_id_t name[1024];
+	size_t count;
+};
+
+/* the tokens of most documents are cut off by a chunk somewhere, and the
+ * non-ASCII characters take every width that the encodings have
+ */
+static const char *const documents[] = {
+	"<html><head><title>Chunks</title></head><body class=\"main\" id='x'></body></html>",
+	"<p title=\"a string that goes on for a while, past every chunk size\">text</p>",
+	"<!-- a comment that is longer than some of the chunks --><p>after</p>",
+	"<div data=\"rows\">{{ a_rather_long_identifier_name }} and {{ another }}</div>",
+	"<p>3.14159265358979323846264338327950288 ... 2.71828182845904523536 %%%%%%</p>",
+	"<p>fish &amp; chips &#233; &#x1F600; &notin; &notanentity</p>",
+	"<script>if (a < b && c > d) { run(); }</script><style>p > a { color: red }</style>",
+	"<p><![CDATA[ <not> markup ]]></p><textarea>x</textarea>",
+	"<title lang=\"en\">a {{ name }} &amp; b {{</title><textarea rows='3'>x &lt; {{y}}</textarea>",
+	"<script type=\"module\" src=\"a.js\">if (a < b) { f(\"</p>\"); }</script><p>x</p>",
+	"<p class=\"na\xc3\xafve\">h\xc3\xa9llo w\xc3\xb6rld caf\xc3\xa9 \xc3\xbc\xc3\xafn</p>",
+	"<p>\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e \xe2\x80\x94 x</p>",
+	"<p>\xf0\x9f\x98\x80 \xf0\x9d\x90\x80\xf0\x9d\x90\x81 {{ \xc3\xa9t\xc3\xa9 }}</p>",
+};
+
+static const size_t chunk_sizes[] = { 1, 3, 17, 64 };
+
+static const unicode_encoding_t encodings[] = {
+	UNICODE_ENCODING_UTF8,
+	UNICODE_ENCODING_LATIN1,
+	UNICODE_ENCODING_UCS2,
+	UNICODE_ENCODING_UTF32,
+};
+
+static const char *const encoding_names[] = {
+	[UNICODE_ENCODING_UTF8] = "utf8",
+	[UNICODE_ENCODING_LATIN1] = "latin1",
+	[UNICODE_ENCODING_UCS2] = "ucs2",
+	[UNICODE_ENCODING_UTF32] = "utf32",
+};
+
+/* Stores the utf-8 string 'in' in 'encoding' at 'out', which has room for
+ * 'strlen(in)' code units. Returns the number of code units, or 0 if a
+ * character does not fit the encoding.
+ */
+static size_t encode(const char *in, unicode_encoding_t encoding, void *out)
+{
+	const uint8_t *p = (const uint8_t *) in;
+	size_t size = 0;
+
+	while (*p) {
+		uint32_t ch = *p;
+		int extra = (ch >= 0xf0)? 3 : (ch >= 0xe0)? 2 : (ch >= 0xc0)? 1 : 0;
+
+		if (encoding == UNICODE_ENCODING_UTF8) {
+			((uint8_t *) out)[size++] = *p++;
+			continue;
+		}
+
+		if (extra)
+			ch &= 0x3f >> extra;
+		for (++p; extra; --extra)
+			ch = ch << 6 | (*p++ & 0x3f);
+
+		switch (encoding) {
+		case UNICODE_ENCODING_LATIN1:
+			if (ch > 0xff)
+				return 0;
+			((uint8_t *) out)[size++] = ch;
+			break;
+		case UNICODE_ENCODING_UCS2:
+			if (ch > 0xffff)
+				return 0;
+			((uint16_t *) out)[size++] = ch;
+			break;
+		default:
+			((utf32_t *) out)[size++] = ch;
+			break;
+		}
+	}
+
+	return size;
+}
+
+static void append_tokens(
+		struct token_list_t *restrict list, const struct html_tokens_t *restrict tokens,
+		size_t dropped)
+{
+	for (size_t i = 0; i < tokens->count && list->count < 1024; ++i, ++list->count) {
+		list->offset[list->count] = tokens->offset[i] + dropped;
+		list->size[list->count] = tokens->size[i];
+		list->id[list->count] = tokens->id[i];
+		list->name[list->count] = tokens->name[i];
+	}
+}
+
+/* Feeds the 'size' code units at 'data' to the lexer 'chunk_size' at a time,
+ * through a buffer that only keeps the tail that is not lexed yet
+ */
+static int lex_chunks(
+		const char *data, size_t size, unicode_encoding_t encoding, size_t chunk_size,
+		struct token_list_t *restrict list)
+{
+	const size_t unit_size = unicode_unit_size(encoding);
+	struct html_tokens_t tokens = {0};
+	struct html_lexer_t lexer;
+	size_t fed = 0, kept = 0, dropped = 0;
+	int rc = -1;
+
+	char *buffer = calloc(size * unit_size + HTML_PARSER_PADDING, 1);
+	if (__builtin_expect(buffer == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+				size * unit_size + HTML_PARSER_PADDING);
+		return rc;
+	}
+
+	if (html_lexer_init(&lexer, buffer, 0, encoding) != 0)
+		goto cleanup;
+
+	lexer.partial = 1;
+	list->count = 0;
+
+	while (fed < size) {
+		size_t n = (size - fed < chunk_size)? size - fed : chunk_size;
+
+		memcpy(buffer + kept * unit_size, data + fed * unit_size, n * unit_size);
+		memset(buffer + (kept + n) * unit_size, 0, HTML_PARSER_PADDING);
+		lexer.size += n;
+		fed += n;
+
+		if (fed == size)
+			lexer.partial = 0;
+
+		tokens.count = 0;
+		if (html_lex_next(&lexer, &tokens, SIZE_MAX) != 0)
+			goto cleanup;
+
+		append_tokens(list, &tokens, dropped);
+		dropped += lexer.position;
+		kept = html_lexer_shift(&lexer, buffer);
+	}
+
+	rc = (kept == 0)? 0 : -1;
+
+cleanup:
+	html_tokens_free(&tokens);
+	free(buffer);
+	return rc;
+}
+
+static int compare(const struct token_list_t *a, const struct token_list_t *b)
+{
+	if (a->count != b->count)
+		return 1;
+
+	for (size_t i = 0; i < a->count; ++i) {
+		if (a->offset[i] != b->offset[i] || a->size[i] != b->size[i] ||
+				a->id[i] != b->id[i] || a->name[i] != b->name[i])
+			return 1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	static struct token_list_t whole, chunked;
+	struct html_tokens_t tokens = {0};
+	int failed = 0;
+
+	for (size_t d = 0; d < sizeof(documents) / sizeof(documents[0]); ++d) {
+		size_t length = strlen(documents[d]);
+		char *data = calloc(length * sizeof(utf32_t) + HTML_PARSER_PADDING, 1);
+
+		if (__builtin_expect(data == 0, 0)) {
+			fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+					length * sizeof(utf32_t) + HTML_PARSER_PADDING);
+			return 1;
+		}
+
+		for (size_t e = 0; e < sizeof(encodings) / sizeof(encodings[0]); ++e) {
+			size_t size = encode(documents[d], encodings[e], data);
+
+			/* the document has characters that the encoding cannot hold */
+			if (size == 0)
+				continue;
+
+			memset(data + size * unicode_unit_size(encodings[e]), 0, HTML_PARSER_PADDING);
+
+			if (html_lex(data, size, encodings[e], &tokens) != 0) {
+				fprintf(stderr, "document %ld (%s): html_lex failed\n", d, encoding_names[e]);
+				failed = 1;
+				continue;
+			}
+
+			whole.count = 0;
+			append_tokens(&whole, &tokens, 0);
+
+			for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); ++c) {
+				if (lex_chunks(data, size, encodings[e], chunk_sizes[c], &chunked) != 0 ||
+						compare(&whole, &chunked) != 0) {
+					fprintf(stderr, "document %ld (%s): chunks of %ld differ from the whole input\n",
+							d, encoding_names[e], chunk_sizes[c]);
+					failed = 1;
+				}
+			}
+		}
+
+		free(data);
+	}
+
+	html_tokens_free(&tokens);
+	return failed;
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * markup.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Parses documents and checks the nodes and attributes of their trees */
+
+#include <html_parser.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct markup_case_t {
+	const char *text;
+
+	/* the nodes as 'tag/parent' and the attributes as 'parent.name=value',
+	 * in the order of the tree, or 0 if the document does not parse
+	 */
+	const char *nodes;
+	const char *attributes;
+};
+
+static const struct markup_case_t cases[] = {
+	/* the content of title and textarea is text with variables */
+	{ "<html><title>{{ x }}</title></html>", "html title/html x/title", "" },
+	{ "<textarea name=\"n\" data=\"rows\">a {{ y }} &amp; {{z}}</textarea>",
+		"textarea y/textarea z/textarea", "textarea.name=n textarea.data=rows" },
+	{ "<title>a &amp b { c }} {{ d</title>", "title", "" },
+
+	/* script and style keep their attributes and their content is raw */
+	{ "<script src=\"a.js\"></script>", "script", "script.src=a.js" },
+	{ "<script type='module'>if (a<b) f(\"{{ x }}\")</script>", "script", "script.type=module" },
+	{ "<style media=\"print\">p > a { color: red }</style>", "style", "style.media=print" },
+	{ "<SCRIPT Defer>a</b></script><p></p>", "SCRIPT p", "SCRIPT.Defer" },
+	{ "<titles>{{ x }}</titles>", "titles x/titles", "" },
+
+	/* attribute names may spell keywords */
+	{ "<div data=\"rows\" include=\"a.html\"></div>", "div", "div.data=rows div.include=a.html" },
+
+	/* comments and CDATA sections are skipped */
+	{ "<p><!-- <b> --></p>", "p", "" },
+	{ "<p><![CDATA[<b>]]></p>", "p", "" },
+
+	/* the CDATA keyword is case-sensitive */
+	{ "<p><![cdata[x]]></p>", 0, 0 },
+	{ "<p><![CdAtA[x]]></p>", 0, 0 },
+};
+
+/* Appends the text of token 'i' of 'tokens', which is ASCII, to 'out' */
+static char *append_token(char *out, const struct html_tokens_t *tokens, html_token_idx_t i)
+{
+	const char *text = html_token_begin(tokens, i);
+
+	for (size_t j = 0; j < tokens->size[i]; ++j)
+		*out++ = text[j];
+
+	return out;
+}
+
+/* Writes the nodes and the attributes of 'tree' like the cases list them */
+static void describe(const struct html_tree_t *tree, char *nodes, char *attributes)
+{
+	const struct html_tokens_t *tokens = &tree->tokens;
+
+	for (size_t i = 0; i < tree->node_count; ++i) {
+		if (i)
+			*nodes++ = ' ';
+
+		nodes = append_token(nodes, tokens, tree->node_tag_name[i]);
+
+		if (tree->node_parent[i]) {
+			*nodes++ = '/';
+			nodes = append_token(nodes, tokens, tree->node_parent[i]);
+		}
+	}
+
+	for (size_t i = 0; i < tree->attrib_count; ++i) {
+		if (i)
+			*attributes++ = ' ';
+
+		attributes = append_token(attributes, tokens, tree->attrib_parent[i]);
+		*attributes++ = '.';
+		attributes = append_token(attributes, tokens, tree->attrib_name[i]);
+
+		if (tree->attrib_value[i]) {
+			*attributes++ = '=';
+			attributes = append_token(attributes, tokens, tree->attrib_value[i]);
+		}
+	}
+
+	*nodes = 0;
+	*attributes = 0;
+}
+
+int main(void)
+{
+	struct html_tree_t tree = {0};
+	int failed = 0;
+
+	for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+		char data[256 + HTML_PARSER_PADDING] = {0};
+		char nodes[512], attributes[512];
+		size_t size = strlen(cases[c].text);
+		int rc;
+
+		memcpy(data, cases[c].text, size);
+		rc = html_parse(data, size, UNICODE_ENCODING_UTF8, &tree);
+
+		if (cases[c].nodes == 0) {
+			if (rc == 0) {
+				fprintf(stderr, "%s: parsed\n", cases[c].text);
+				failed = 1;
+			}
+
+			continue;
+		}
+
+		if (rc != 0) {
+			fprintf(stderr, "%s: does not parse\n", cases[c].text);
+			failed = 1;
+			continue;
+		}
+
+		describe(&tree, nodes, attributes);
+
+		if (strcmp(nodes, cases[c].nodes) != 0 || strcmp(attributes, cases[c].attributes) != 0) {
+			fprintf(stderr, "%s: nodes '%s', attributes '%s'\n", cases[c].text, nodes, attributes);
+			failed = 1;
+		}
+	}
+
+	html_tree_free(&tree);
+	return failed;
+}
@@ -0,0 +1,439 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * unicode_bench.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Measures the throughput of the unicode kernels of every instruction set
+ * that the CPU supports against the scalar code that they replace: the
+ * utf-8 decoder, the substring search and the keyword compare. Each figure
+ * is the best of a few runs over inputs of a few megabytes.
+ */
+
+#include <unicode.h>
+#include <unicode_kernels.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define RUNS 5
+#define INPUT_SIZE (16 << 20)
+
+/* long inline scripts, small enough to stay in the cache */
+#define FIND_SIZE (1 << 20)
+
+/* every position is compared with every keyword */
+#define COMPARE_SIZE (1 << 18)
+
+/* the rows of the results; the scalar row, without kernels, times the code
+ * that the kernels replace
+ */
+struct kernels_case_t {
+	const char *name;
+	const struct unicode_kernels_t *kernels;
+	int supported;
+};
+
+static struct kernels_case_t cases[] = {
+	{ "scalar", 0, 1 },
+	{ "baseline", &unicode_kernels_baseline, 1 },
+#if defined(__x86_64__) || defined(__i386__)
+	{ "sse42", &unicode_kernels_sse42, 0 },
+	{ "avx2", &unicode_kernels_avx2, 0 },
+	{ "avx512", &unicode_kernels_avx512, 0 },
+#endif
+	{ 0, 0, 0 },
+};
+
+/* the text that the decoder inputs repeat, from the ASCII markup that most
+ * templates are made of to scripts that are all multi-byte
+ */
+struct text_case_t {
+	const char *name;
+	const char *text;
+};
+
+static const struct text_case_t texts[] = {
+	{ "ascii", "<li class=\"item\"><a href=\"/posts/{{ id }}\">{{ title }}</a> by {{ author }}</li>\n" },
+	{ "sparse", "<p>The quick brown fox jumps over the lazy dog \xe2\x80\x94 again, and again, "
+		"until the paragraph is long enough to fill a few vectors.</p>\n" },
+	{ "latin", "<p>Caf\xc3\xa9 cr\xc3\xa8me br\xc3\xbbl\xc3\xa9" "e, na\xc3\xafve fa\xc3\xa7" "ade.</p>\n" },
+	{ "cyrillic", "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xd0\xbc\xd0\xb8\xd1\x80 " },
+	{ "cjk", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe6\x96\x87\xe7\xab\xa0\xe3\x80\x82" },
+};
+
+#define TEXT_COUNT (sizeof(texts) / sizeof(texts[0]))
+
+/* the keywords that the lexer compares the input with */
+static const char *const keywords[] = {
+	"<script", "</script>", "<style", "</style>", "<textarea", "</textarea>",
+	"<title", "</title>", "<!--", "-->", "<![CDATA[", "]]>",
+};
+
+#define KEYWORD_COUNT (sizeof(keywords) / sizeof(keywords[0]))
+#define KEYWORD_MAX_SIZE 16
+
+static volatile uint32_t sink;
+
+static double elapsed_ms(const struct timespec *begin, const struct timespec *end)
+{
+	return (end->tv_sec - begin->tv_sec) * 1e3 + (end->tv_nsec - begin->tv_nsec) / 1e6;
+}
+
+static void detect_kernels(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	cases[2].supported = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+	cases[3].supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")
+		&& __builtin_cpu_supports("lzcnt");
+	cases[4].supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+		&& __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("lzcnt");
+#endif
+}
+
+/* Fills 'out' with whole copies of 'text' and returns their size, which is
+ * at most 'size'
+ */
+static size_t repeat_text(const char *text, char *out, size_t size)
+{
+	size_t text_size = strlen(text), n = 0;
+
+	for (; size - n >= text_size; n += text_size)
+		memcpy(out + n, text, text_size);
+
+	return n;
+}
+
+/* the decoder that unicode_read_utf8_string used before the kernels */
+static size_t read_utf8_scalar(const char *in, size_t size, utf32_t *out)
+{
+	const char *p = in, *end = in + size;
+	size_t i = 0;
+
+	while (p < end) {
+		out[i] = unicode_read_utf8_char(&p);
+
+		if (__builtin_expect(out[i] < 0, 0))
+			++p;
+
+		++i;
+	}
+
+	return i;
+}
+
+/* the search that unicode_find and its variants used before the kernels: the
+ * first character is compared alone and the rest only when it matches
+ */
+#define DEFINE_FIND_SCALAR(name, type) \
+static int name(const type *hay, const type *needle, size_t hay_size, size_t needle_size) \
+{ \
+	for (size_t i = 0; i + needle_size <= hay_size; ++i) { \
+		size_t j = 1; \
+ \
+		if (hay[i] != needle[0]) \
+			continue; \
+ \
+		while (j < needle_size && hay[i + j] == needle[j]) \
+			++j; \
+ \
+		if (j == needle_size) \
+			return i; \
+	} \
+ \
+	return -1; \
+}
+
+DEFINE_FIND_SCALAR(find_utf8_scalar, char)
+DEFINE_FIND_SCALAR(find_ucs2_scalar, uint16_t)
+DEFINE_FIND_SCALAR(find_scalar, utf32_t)
+
+/* the compare that unicode_compare_likely_equal used before the kernels,
+ * which the lexer called in another translation unit
+ */
+#define DEFINE_COMPARE_SCALAR(name, type) \
+__attribute__((noinline)) \
+static int name(const type *s1, const type *s2, size_t size) \
+{ \
+	int diff = 0; \
+ \
+	for (size_t i = 0; i < size; ++i) { \
+		diff = s1[i] - s2[i]; \
+		if (__builtin_expect(diff, 0)) \
+			break; \
+	} \
+ \
+	return diff; \
+}
+
+DEFINE_COMPARE_SCALAR(compare_utf8_scalar, uint8_t)
+DEFINE_COMPARE_SCALAR(compare_ucs2_scalar, uint16_t)
+DEFINE_COMPARE_SCALAR(compare_scalar, utf32_t)
+
+/* Prints the best throughput of every supported row in MB/s of input over
+ * each text
+ */
+static void bench_read_utf8(char *in, utf32_t *out)
+{
+	size_t sizes[TEXT_COUNT];
+
+	printf("%-16s", "read_utf8 MB/s");
+	for (size_t t = 0; t < TEXT_COUNT; ++t) {
+		sizes[t] = repeat_text(texts[t].text, in + t * INPUT_SIZE, INPUT_SIZE);
+		printf(" %10s", texts[t].name);
+	}
+	printf("\n");
+
+	for (size_t k = 0; cases[k].name; ++k) {
+		if (!cases[k].supported)
+			continue;
+
+		printf("%-16s", cases[k].name);
+
+		for (size_t t = 0; t < TEXT_COUNT; ++t) {
+			const char *text = in + t * INPUT_SIZE;
+			double best = 1e30;
+
+			for (int run = 0; run < RUNS; ++run) {
+				struct timespec begin, end;
+				size_t n;
+
+				clock_gettime(CLOCK_MONOTONIC, &begin);
+				n = (cases[k].kernels == 0)? read_utf8_scalar(text, sizes[t], out)
+					: cases[k].kernels->read_utf8(text, sizes[t], out);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+
+				sink += out[n - 1];
+				best = (elapsed_ms(&begin, &end) < best)? elapsed_ms(&begin, &end) : best;
+			}
+
+			printf(" %10.0f", sizes[t] / best / 1e3);
+		}
+
+		printf("\n");
+	}
+}
+
+/* Prints the best throughput of every supported row in millions of code
+ * units per second, in each encoding, of a search for 'needle' at the end of
+ * 'size' code units of script. The script has the first character of the
+ * needle every few characters, as '<' is in scripts.
+ */
+static void bench_find(const char *needle, size_t size, void *hay)
+{
+	static const char script[] = "if (a < b && items[i].id > 0) { render(items[i]); }\n";
+	const size_t needle_size = strlen(needle);
+	char *utf8 = hay;
+	uint16_t *ucs2 = hay;
+	utf32_t *utf32 = hay;
+	uint16_t ucs2_needle[16];
+	utf32_t utf32_needle[16];
+
+	for (size_t i = 0; i < needle_size; ++i) {
+		ucs2_needle[i] = needle[i];
+		utf32_needle[i] = needle[i];
+	}
+
+	printf("\n%-16s %10s %10s %10s\n", needle, "utf8", "ucs2", "utf32");
+
+	for (size_t k = 0; cases[k].name; ++k) {
+		const struct unicode_kernels_t *kernels = cases[k].kernels;
+
+		if (!cases[k].supported)
+			continue;
+
+		printf("%-16s", cases[k].name);
+
+		for (size_t unit_size = 1; unit_size <= 4; unit_size *= 2) {
+			double best = 1e30;
+
+			/* the script, then the needle at its end */
+			for (size_t i = 0; i < size; ++i) {
+				char ch = (i < size - needle_size)? script[i % (sizeof(script) - 1)]
+					: needle[i - (size - needle_size)];
+
+				if (unit_size == 1)
+					utf8[i] = ch;
+				else if (unit_size == 2)
+					ucs2[i] = ch;
+				else
+					utf32[i] = ch;
+			}
+
+			for (int run = 0; run < RUNS; ++run) {
+				struct timespec begin, end;
+				int found;
+
+				clock_gettime(CLOCK_MONOTONIC, &begin);
+				if (unit_size == 1)
+					found = (kernels == 0)? find_utf8_scalar(utf8, needle, size, needle_size)
+						: kernels->find_utf8(utf8, needle, size, needle_size);
+				else if (unit_size == 2)
+					found = (kernels == 0)? find_ucs2_scalar(ucs2, ucs2_needle, size, needle_size)
+						: kernels->find_ucs2(ucs2, ucs2_needle, size, needle_size);
+				else
+					found = (kernels == 0)? find_scalar(utf32, utf32_needle, size, needle_size)
+						: kernels->find(utf32, utf32_needle, size, needle_size);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+
+				sink += found;
+				best = (elapsed_ms(&begin, &end) < best)? elapsed_ms(&begin, &end) : best;
+			}
+
+			printf(" %10.0f", size / best / 1e3);
+		}
+
+		printf("\n");
+	}
+}
+
+/* the keywords in every encoding */
+static uint8_t utf8_keywords[KEYWORD_COUNT][KEYWORD_MAX_SIZE];
+static uint16_t ucs2_keywords[KEYWORD_COUNT][KEYWORD_MAX_SIZE];
+static utf32_t utf32_keywords[KEYWORD_COUNT][KEYWORD_MAX_SIZE];
+static size_t keyword_sizes[KEYWORD_COUNT];
+
+static void encode_keywords(void)
+{
+	for (size_t w = 0; w < KEYWORD_COUNT; ++w) {
+		keyword_sizes[w] = strlen(keywords[w]);
+
+		for (size_t i = 0; i < keyword_sizes[w]; ++i) {
+			utf8_keywords[w][i] = keywords[w][i];
+			ucs2_keywords[w][i] = keywords[w][i];
+			utf32_keywords[w][i] = keywords[w][i];
+		}
+	}
+}
+
+/* Compares the keyword 'w' with the code units at 'i' of the text in the
+ * encoding of 'unit_size', as the row of 'kernels' does
+ */
+static inline int compare_at(
+		const struct unicode_kernels_t *kernels, size_t unit_size, const void *text, size_t i,
+		size_t w)
+{
+	const size_t size = keyword_sizes[w];
+
+	if (unit_size == 1)
+		return (kernels == 0)? compare_utf8_scalar((const uint8_t *) text + i, utf8_keywords[w], size)
+			: kernels->compare_utf8((const char *) text + i, (const char *) utf8_keywords[w], size);
+	else if (unit_size == 2)
+		return (kernels == 0)? compare_ucs2_scalar((const uint16_t *) text + i, ucs2_keywords[w], size)
+			: kernels->compare_ucs2((const uint16_t *) text + i, ucs2_keywords[w], size);
+	else
+		return (kernels == 0)? compare_scalar((const utf32_t *) text + i, utf32_keywords[w], size)
+			: kernels->compare((const utf32_t *) text + i, utf32_keywords[w], size);
+}
+
+/* Prints the best rate of every supported row in millions of compares per
+ * second, in each encoding, over 'size' code units. A probe compares every
+ * keyword at every position of markup, as the lexer once did, and nearly
+ * every compare fails at the first character. A match compares each keyword
+ * of a run of keywords with itself, as a search does to verify a candidate.
+ */
+static void bench_compare(int match, size_t size, void *text)
+{
+	const char *markup = texts[0].text;
+	const size_t markup_size = strlen(markup);
+
+	printf("\n%-16s %10s %10s %10s\n", (match)? "keyword match" : "keyword probe",
+			"utf8", "ucs2", "utf32");
+
+	for (size_t k = 0; cases[k].name; ++k) {
+		const struct unicode_kernels_t *kernels = cases[k].kernels;
+
+		if (!cases[k].supported)
+			continue;
+
+		printf("%-16s", cases[k].name);
+
+		for (size_t unit_size = 1; unit_size <= 4; unit_size *= 2) {
+			size_t w = 0, count = 0;
+			double best = 1e30;
+
+			/* the markup, or the keywords one after the other */
+			for (size_t i = 0, j = 0; i < size; ++i, ++j) {
+				char ch = (match)? keywords[w][j] : markup[i % markup_size];
+
+				if (match && ch == 0) {
+					w = (w + 1) % KEYWORD_COUNT;
+					j = 0;
+					ch = keywords[w][0];
+				}
+
+				if (unit_size == 1)
+					((uint8_t *) text)[i] = ch;
+				else if (unit_size == 2)
+					((uint16_t *) text)[i] = ch;
+				else
+					((utf32_t *) text)[i] = ch;
+			}
+
+			for (int run = 0; run < RUNS; ++run) {
+				struct timespec begin, end;
+				int diff = 0;
+
+				count = 0;
+				clock_gettime(CLOCK_MONOTONIC, &begin);
+
+				if (match) {
+					for (size_t i = 0; i + KEYWORD_MAX_SIZE < size; ) {
+						diff |= compare_at(kernels, unit_size, text, i, w = count % KEYWORD_COUNT);
+						i += keyword_sizes[w];
+						++count;
+					}
+				}
+				else {
+					for (size_t i = 0; i + KEYWORD_MAX_SIZE < size; ++i) {
+						for (w = 0; w < KEYWORD_COUNT; ++w, ++count)
+							diff += compare_at(kernels, unit_size, text, i, w);
+					}
+				}
+
+				clock_gettime(CLOCK_MONOTONIC, &end);
+
+				sink += diff;
+				best = (elapsed_ms(&begin, &end) < best)? elapsed_ms(&begin, &end) : best;
+			}
+
+			printf(" %10.0f", count / best / 1e3);
+		}
+
+		printf("\n");
+	}
+}
+
+int main(void)
+{
+	char *in = malloc(TEXT_COUNT * INPUT_SIZE);
+	utf32_t *out = malloc(INPUT_SIZE * sizeof(utf32_t));
+
+	if (__builtin_expect(in == 0 || out == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+				TEXT_COUNT * INPUT_SIZE + INPUT_SIZE * sizeof(utf32_t));
+		free(in);
+		free(out);
+		return 1;
+	}
+
+	detect_kernels();
+	encode_keywords();
+	bench_read_utf8(in, out);
+
+	/* the end delimiters that the lexer searches raw text for */
+	bench_find("</script>", FIND_SIZE, out);
+	bench_find("-->", FIND_SIZE, out);
+
+	bench_compare(0, COMPARE_SIZE, out);
+	bench_compare(1, COMPARE_SIZE, out);
+
+	free(in);
+	free(out);
+	return 0;
+}
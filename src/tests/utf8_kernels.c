@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * utf8_kernels.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Encodes strings with the utf-8 encoder of every instruction set that the
+ * CPU supports, and checks that the bytes are those of the scalar encoder of
+ * the baseline kernels and that nothing is written past them
+ */
+
+#include <unicode.h>
+#include <unicode_kernels.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the ranges that the characters of a string are drawn from */
+struct char_range_t {
+	utf32_t first;
+	utf32_t last;
+};
+
+static const struct char_range_t ranges[] = {
+	{ 0, 0x7f },                  /* 1 byte */
+	{ 0x80, 0x7ff },              /* 2 bytes */
+	{ 0x800, 0xffff },            /* 3 bytes */
+	{ 0x10000, 0x1fffff },        /* 4 bytes */
+	{ 0x200000, 0x7fffffff },     /* out of range of the vector encoder */
+	{ INT32_MIN, -1 },            /* invalid, no bytes */
+};
+
+#define RANGE_COUNT (sizeof(ranges) / sizeof(ranges[0]))
+
+/* every string draws from the ranges in the mask, as a bit per range */
+static const unsigned range_masks[] = {
+	0x01, 0x02, 0x04, 0x08, 0x0f, 0x03, 0x09, 0x11, 0x21, 0x2f, 0x1f, 0x3f, 0x20,
+};
+
+/* the strings are a run of ASCII, so that the vector encoder starts on an
+ * ASCII block, followed by the mixed characters and their tail
+ */
+static const size_t prefix_sizes[] = { 0, 16, 37 };
+
+#define TAIL_MAX 47
+#define STRING_MAX (37 + 64 + TAIL_MAX)
+
+/* bytes past the encoded size that the encoders must leave alone */
+#define GUARD_SIZE 64
+
+struct kernels_case_t {
+	const char *name;
+	const struct unicode_kernels_t *kernels;
+	int supported;
+};
+
+static uint32_t seed = 1;
+
+static uint32_t next_random(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 1;
+}
+
+/* Fills 'str' with 'prefix' ASCII characters and 'size - prefix' characters
+ * from the ranges in 'mask'
+ */
+static void build(utf32_t *str, size_t prefix, size_t size, unsigned mask)
+{
+	size_t i;
+
+	for (i=0; i < prefix; ++i)
+		str[i] = 'a' + next_random() % 26;
+
+	while (i < size) {
+		const struct char_range_t *range = &ranges[next_random() % RANGE_COUNT];
+
+		if (!(mask >> (range - ranges) & 1))
+			continue;
+
+		str[i++] = range->first +
+			(utf32_t) (((uint64_t) next_random() << 1 ^ next_random())
+				% ((uint64_t) range->last - range->first + 1));
+	}
+}
+
+/* Encodes 'str' with 'kernels' into an output of exactly its encoded size
+ * and compares it with 'expected'
+ */
+static int check(
+		const struct unicode_kernels_t *kernels, const utf32_t *str, size_t size,
+		const char *expected, size_t expected_size)
+{
+	static char out[STRING_MAX * 6 + GUARD_SIZE];
+	size_t out_size;
+
+	if (kernels->utf8_length(str, size) != expected_size)
+		return 1;
+
+	memset(out, 0x55, sizeof(out));
+	out_size = kernels->write_utf8(str, size, out, expected_size);
+
+	if (out_size != expected_size || memcmp(out, expected, expected_size) != 0)
+		return 1;
+
+	for (size_t i = expected_size; i < expected_size + GUARD_SIZE; ++i) {
+		if (out[i] != 0x55)
+			return 1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	static utf32_t str[STRING_MAX];
+	static char expected[STRING_MAX * 6];
+	struct kernels_case_t cases[] = {
+#if defined(__x86_64__) || defined(__i386__)
+		{ "sse42", &unicode_kernels_sse42, 0 },
+		{ "avx2", &unicode_kernels_avx2, 0 },
+		{ "avx512", &unicode_kernels_avx512, 0 },
+#endif
+		{ 0, 0, 0 },
+	};
+	int failed = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	cases[0].supported = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+	cases[1].supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")
+		&& __builtin_cpu_supports("lzcnt");
+	cases[2].supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+		&& __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("lzcnt");
+#endif
+
+	for (size_t m = 0; m < sizeof(range_masks) / sizeof(range_masks[0]); ++m) {
+		for (size_t p = 0; p < sizeof(prefix_sizes) / sizeof(prefix_sizes[0]); ++p) {
+			/* a tail after no block, after one and after several */
+			for (size_t blocks = 0; blocks <= 64; blocks += 32) {
+				for (size_t tail = 0; tail <= TAIL_MAX; ++tail) {
+					size_t size = prefix_sizes[p] + blocks + tail;
+					size_t expected_size;
+
+					build(str, prefix_sizes[p], size, range_masks[m]);
+					expected_size = unicode_kernels_baseline.write_utf8(
+							str, size, expected, sizeof(expected));
+
+					for (size_t k = 0; cases[k].name; ++k) {
+						if (!cases[k].supported)
+							continue;
+
+						if (check(cases[k].kernels, str, size, expected, expected_size) != 0) {
+							fprintf(stderr, "%s: ranges 0x%02x, %ld characters: wrong output\n",
+									cases[k].name, range_masks[m], size);
+							failed = 1;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return failed;
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * utf8_write.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Decodes utf-8 strings with invalid bytes and encodes them back, and checks
+ * that only the valid characters come out and that the encoder writes no
+ * further than the encoded size
+ */
+
+#include <unicode.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the bytes that are mixed with the invalid ones; every run of them is a
+ * whole number of characters
+ */
+static const char *const fillers[] = {
+	"A",
+	"<p>",
+	"\xc3\xa9",
+	"\xe6\x97\xa5",
+	"\xf0\x9f\x98\x80",
+};
+
+/* bytes that never start a valid sequence and decode into -1 each */
+static const char invalid[] = { '\xfc', '\xfe', '\xff' };
+
+/* bytes past the encoded size that the encoder must leave alone */
+#define GUARD_SIZE 64
+
+/* Builds a string of 'filler' followed by 'count' invalid bytes, repeated
+ * 'repeat' times, into 'in' and the same string without the invalid bytes
+ * into 'expected'. Returns the size of 'in'.
+ */
+static size_t build(
+		const char *filler, char bad, size_t count, size_t repeat, char *in,
+		char *expected, size_t *expected_size)
+{
+	size_t size = 0, filler_size = strlen(filler);
+
+	*expected_size = 0;
+
+	for (size_t r = 0; r < repeat; ++r) {
+		memcpy(in + size, filler, filler_size);
+		memcpy(expected + *expected_size, filler, filler_size);
+		size += filler_size;
+		*expected_size += filler_size;
+
+		memset(in + size, bad, count);
+		size += count;
+	}
+
+	return size;
+}
+
+static int check(const char *in, size_t size, const char *expected, size_t expected_size)
+{
+	utf32_t *str = 0;
+	char *out = 0, *buf;
+	size_t str_size = 0, out_size = 0, buf_size = expected_size;
+	int failed = 0;
+
+	if (unicode_read_utf8_string(in, size, &str, &str_size) != 0)
+		return 1;
+
+	/* the string is allocated at exactly the encoded size */
+	if (unicode_write_utf8_string(str, str_size, &out, &out_size) != 0) {
+		unicode_utf32_string_free(&str, 1);
+		return 1;
+	}
+
+	if (out_size != expected_size || memcmp(out, expected, expected_size) != 0)
+		failed = 1;
+
+	/* the buffer is only as large as the encoded size, as far as the encoder
+	 * knows, so it must neither grow it nor write into the guard after it
+	 */
+	buf = malloc(expected_size + GUARD_SIZE);
+	if (__builtin_expect(buf == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n",
+				expected_size + GUARD_SIZE);
+		failed = 1;
+		goto cleanup;
+	}
+
+	memset(buf, 0x55, expected_size + GUARD_SIZE);
+
+	if (unicode_write_utf8_buffer(str, str_size, &buf, &buf_size, &out_size) != 0 ||
+			buf_size != expected_size || out_size != expected_size ||
+			memcmp(buf, expected, expected_size) != 0) {
+		failed = 1;
+	}
+	else {
+		for (size_t i = expected_size; i < expected_size + GUARD_SIZE; ++i)
+			failed |= buf[i] != 0x55;
+	}
+
+	free(buf);
+cleanup:
+	unicode_utf8_string_free(&out, 1);
+	unicode_utf32_string_free(&str, 1);
+	return failed;
+}
+
+int main(void)
+{
+	static char in[4096], expected[4096];
+	size_t size, expected_size;
+	int failed = 0;
+
+	for (size_t f = 0; f < sizeof(fillers) / sizeof(fillers[0]); ++f) {
+		for (size_t b = 0; b < sizeof(invalid); ++b) {
+			for (size_t count = 0; count <= 48; ++count) {
+				for (size_t repeat = 1; repeat <= 4; ++repeat) {
+					size = build(fillers[f], invalid[b], count, repeat, in, expected,
+							&expected_size);
+
+					if (check(in, size, expected, expected_size) != 0) {
+						fprintf(stderr, "'%s' and %ld bytes 0x%02x, %ld times: wrong output\n",
+								fillers[f], count, (uint8_t) invalid[b], repeat);
+						failed = 1;
+					}
+				}
+			}
+		}
+	}
+
+	return failed;
+}
@@ -6,15 +6,73 @@
  */
 
 #include <unicode.h>
+#include <unicode_kernels.h>
 
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 #include <sys/mman.h>
 
+static int load_mapped(
+		int fd, const char *filename, size_t size, size_t padding, unicode_loader_t loader,
+		void **out_data);
+static int load_pooled(int fd, const char *filename, size_t size, size_t padding, void **out_data);
+static int load_huge_pages(
+		int fd, const char *filename, size_t size, size_t padding, void **out_data);
+static int read_all(int fd, const char *filename, char *restrict data, size_t size);
+static int stream_decode_chunk(struct unicode_utf8_stream_t *restrict stream);
+static size_t utf8_complete_size(const char *restrict in, size_t size);
+static int grow_buffer(char **restrict buf, size_t *restrict buf_size, size_t size);
+static size_t utf8_length_adaptive(
+		const void *restrict in_str, size_t in_size, unicode_encoding_t encoding);
+static size_t write_utf8_adaptive(
+		const void *restrict in_str, size_t in_size, unicode_encoding_t encoding,
+		char *restrict out, size_t out_size);
+
+/* The longest sequence that unicode_read_utf8_char accepts */
+#define UTF8_SEQUENCE_MAX 5
+
+#define UNICODE_KERNELS unicode_kernels_baseline
+#include <unicode_kernels_impl.h>
+
+/* kernels for the widest instruction set that the CPU supports */
+static const struct unicode_kernels_t *kernels = &unicode_kernels_baseline;
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <unicode_shuffle_table.h>
+
+__attribute__((constructor))
+static void init_kernels(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+			&& __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("lzcnt"))
+		kernels = &unicode_kernels_avx512;
+	else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")
+			&& __builtin_cpu_supports("lzcnt"))
+		kernels = &unicode_kernels_avx2;
+	else if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+		kernels = &unicode_kernels_sse42;
+}
+#endif
+
+size_t unicode_unit_size(unicode_encoding_t encoding)
+{
+	static const uint8_t unit_size[UNICODE_ENCODING_END] = {
+		[UNICODE_ENCODING_UTF8] = sizeof(char),
+		[UNICODE_ENCODING_LATIN1] = sizeof(uint8_t),
+		[UNICODE_ENCODING_UCS2] = sizeof(uint16_t),
+		[UNICODE_ENCODING_UTF32] = sizeof(utf32_t),
+	};
+
+	return unit_size[encoding];
+}
+
 void unicode_utf32_string_free(utf32_t *restrict *restrict str, size_t count)
 {
 	size_t i;
@@ -33,33 +91,70 @@ void unicode_utf8_string_free(char *restrict *restrict str, size_t count)
 
 int unicode_write_utf8_file(int fd, const char *filename, const utf32_t *in_str, size_t in_size)
 {
-	int out_fd, rc = 0;
+	/* every thread reuses its encoding buffer for all the files it writes */
+	static __thread char *utf8_buf;
+	static __thread size_t utf8_buf_size;
+
+	int rc = 0;
 	size_t utf8_size = 0;
-	char *utf8_buf;
 
-	rc = unicode_write_utf8_string(in_str, in_size, &utf8_buf, &utf8_size);
+	rc = unicode_write_utf8_buffer(in_str, in_size, &utf8_buf, &utf8_buf_size, &utf8_size);
+	if (__builtin_expect(rc != 0, 0)) {
+		goto exit1;
+	}
+
+	rc = unicode_write_file(fd, filename, utf8_buf, utf8_size);
+exit1:
+	return rc;
+}
+
+int unicode_write_utf8_file_adaptive(
+		int fd, const char *filename, const void *in_str, size_t in_size,
+		unicode_encoding_t encoding)
+{
+	static __thread char *utf8_buf;
+	static __thread size_t utf8_buf_size;
+
+	int rc = 0;
+	size_t utf8_size;
+
+	/* utf-8 documents are written as they are */
+	if (encoding == UNICODE_ENCODING_UTF8)
+		return unicode_write_file(fd, filename, in_str, in_size);
+
+	utf8_size = utf8_length_adaptive(in_str, in_size, encoding);
+
+	rc = grow_buffer(&utf8_buf, &utf8_buf_size, utf8_size);
 	if (__builtin_expect(rc != 0, 0)) {
 		goto exit1;
 	}
 
+	write_utf8_adaptive(in_str, in_size, encoding, utf8_buf, utf8_buf_size);
+	rc = unicode_write_file(fd, filename, utf8_buf, utf8_size);
+exit1:
+	return rc;
+}
+
+int unicode_write_file(int fd, const char *filename, const void *data, size_t size)
+{
+	int out_fd, rc = 0;
+
 	/* open the output file */
 	out_fd = openat(fd, filename, O_CREAT | O_WRONLY | O_TRUNC, 0644);
 	if (__builtin_expect(out_fd == -1, 0)) {
 		rc = errno;
 		fprintf(stderr, "cannot open '%s' for writing. error %d\n", filename, rc);
-		goto exit2;
+		goto exit1;
 	}
 
-	/* write utf-8 data into file */
-	if (__builtin_expect(write(out_fd, utf8_buf, utf8_size) == -1, 0)) {
+	/* write the encoded data into file */
+	if (__builtin_expect(write(out_fd, data, size) == -1, 0)) {
 		rc = errno;
 		fprintf(stderr, "cannot write to '%s'. error %d\n", filename, rc);
 	}
 
 	/* clean up */
 	close(out_fd);
-exit2:
-	free(utf8_buf);
 exit1:
 	return rc;
 }
@@ -69,16 +164,7 @@ int unicode_write_utf8_string(
 		size_t *restrict out_size)
 {
 	int rc = 0;
-	size_t i;
-	char *p;
-
-	/* In the worst case, a utf-8 encoded character can take 50% more space
-	 * compared to its equivalent utf-32 encoded character. For this reason
-	 * we are allocating at least 150% to store the utf-8 encoded string.
-	 * To guard against rounding errors, we will actually allocate memory
-	 * that is 160% the size of the utf-32 string.
-	 */
-	const size_t utf8_buf_size = sizeof(utf32_t) * (in_size * 1.6) + *out_size;
+	const size_t utf8_buf_size = unicode_utf8_length(in_str, in_size) + *out_size;
 
 	*out_str = malloc(utf8_buf_size);
 	if (__builtin_expect(*out_str == 0, 0)) {
@@ -87,48 +173,205 @@ int unicode_write_utf8_string(
 		goto exit1;
 	}
 
-	p = *out_str;
-	for (i=0; i < in_size; ++i) {
-		unicode_write_utf8_char(&p, in_str[i]);
+	*out_size = kernels->write_utf8(in_str, in_size, *out_str, utf8_buf_size);
+exit1:
+	return rc;
+}
+
+int unicode_write_utf8_string_adaptive(
+		const void *restrict in_str, size_t in_size, unicode_encoding_t encoding,
+		char **restrict out_str, size_t *restrict out_size)
+{
+	int rc = 0;
+	const size_t utf8_buf_size = utf8_length_adaptive(in_str, in_size, encoding) + *out_size;
+
+	*out_str = malloc(utf8_buf_size);
+	if (__builtin_expect(*out_str == 0, 0)) {
+		rc = ENOMEM;
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", utf8_buf_size);
+		goto exit1;
 	}
 
-	*out_size = p - *out_str;
+	*out_size = write_utf8_adaptive(in_str, in_size, encoding, *out_str, utf8_buf_size);
 exit1:
 	return rc;
 }
 
-int unicode_write_utf8_char(char **restrict s, utf32_t ch)
+int unicode_write_utf8_buffer(
+		const utf32_t *restrict in_str, size_t in_size, char **restrict buf,
+		size_t *restrict buf_size, size_t *restrict out_size)
 {
-	uint8_t *p = (uint8_t*) *s;
+	int rc = 0;
+	const size_t utf8_size = unicode_utf8_length(in_str, in_size);
 
-	if (__builtin_expect(ch < 0, 0)) {
-		return -1;
-	}
-	else if (ch < 128) {
-		p[0] = ch;
-		++*s;
+	rc = grow_buffer(buf, buf_size, utf8_size);
+	if (__builtin_expect(rc != 0, 0)) {
+		goto exit1;
 	}
-	else {
-#ifdef __BMI2__
-		uint32_t i, cnt = 6 - (__builtin_ia32_lzcnt_u32(ch) - 1) / 5;
-#else
-		int i, cnt = (ch != 0)? 6 - (__builtin_clz(ch) - 1) / 5 : 0;
-#endif
-		p[0] = 255 << (8 - cnt) | ch >> 6 * (cnt - 1);
 
-		for (i=1; i < cnt; ++i) {
-			p[i] = 128 | (ch >> 6 * (cnt - i - 1) & 63);
+	*out_size = kernels->write_utf8(in_str, in_size, *buf, *buf_size);
+exit1:
+	return rc;
+}
+
+/* Grows '*buf' to at least 'size' bytes. The buffer grows geometrically so
+ * that a reused buffer settles quickly.
+ */
+static int grow_buffer(char **restrict buf, size_t *restrict buf_size, size_t size)
+{
+	if (size > *buf_size) {
+		size_t new_size = (size > 2 * *buf_size)? size : 2 * *buf_size;
+		char *new_buf = realloc(*buf, new_size);
+
+		if (__builtin_expect(new_buf == 0, 0)) {
+			fprintf(stderr, "not enough memory to allocate %ld bytes\n", new_size);
+			return ENOMEM;
 		}
 
-		*s += cnt;
+		*buf = new_buf;
+		*buf_size = new_size;
 	}
 
 	return 0;
 }
 
-int unicode_read_utf8_file(int fd, const char *filename, utf32_t **out_str, size_t *out_size)
+size_t unicode_utf8_length(const utf32_t *restrict in_str, size_t in_size)
+{
+	return kernels->utf8_length(in_str, in_size);
+}
+
+/* Returns the number of bytes needed to encode the 'in_size' code units of
+ * 'in_str' as utf-8
+ */
+static size_t utf8_length_adaptive(
+		const void *restrict in_str, size_t in_size, unicode_encoding_t encoding)
+{
+	const uint8_t *restrict latin1 = in_str;
+	const uint16_t *restrict ucs2 = in_str;
+	size_t i, size = in_size;
+
+	switch (encoding) {
+	case UNICODE_ENCODING_LATIN1:
+		for (i=0; i < in_size; ++i)
+			size += latin1[i] >= 0x80;
+		break;
+	case UNICODE_ENCODING_UCS2:
+		for (i=0; i < in_size; ++i)
+			size += (ucs2[i] >= 0x80) + (ucs2[i] >= 0x800);
+		break;
+	case UNICODE_ENCODING_UTF32:
+		size = unicode_utf8_length(in_str, in_size);
+		break;
+	}
+
+	return size;
+}
+
+/* Encodes the 'in_size' code units of 'in_str' into the 'out_size' bytes at
+ * 'out', which must be large enough to hold the encoded string, and returns
+ * the number of bytes written. Latin-1 and UCS-2 strings are widened a block
+ * at a time so that they go through the same vectorized encoder as utf-32
+ * strings.
+ */
+static size_t write_utf8_adaptive(
+		const void *restrict in_str, size_t in_size, unicode_encoding_t encoding,
+		char *restrict out, size_t out_size)
+{
+	const uint8_t *restrict latin1 = in_str;
+	const uint16_t *restrict ucs2 = in_str;
+	utf32_t block[256];
+	size_t i, j, n, size = 0;
+
+	switch (encoding) {
+	case UNICODE_ENCODING_UTF8:
+		memcpy(out, in_str, in_size);
+		size = in_size;
+		break;
+	case UNICODE_ENCODING_LATIN1:
+		for (i=0; i < in_size; i += n) {
+			n = (in_size - i < 256)? in_size - i : 256;
+			for (j=0; j < n; ++j)
+				block[j] = latin1[i + j];
+
+			size += kernels->write_utf8(block, n, out + size, out_size - size);
+		}
+		break;
+	case UNICODE_ENCODING_UCS2:
+		for (i=0; i < in_size; i += n) {
+			n = (in_size - i < 256)? in_size - i : 256;
+			for (j=0; j < n; ++j)
+				block[j] = ucs2[i + j];
+
+			size += kernels->write_utf8(block, n, out + size, out_size - size);
+		}
+		break;
+	case UNICODE_ENCODING_UTF32:
+		size = kernels->write_utf8(in_str, in_size, out, out_size);
+		break;
+	}
+
+	return size;
+}
+
+int unicode_write_utf8_char(char **restrict s, utf32_t ch)
+{
+	return write_utf8_char(s, ch);
+}
+
+int unicode_read_utf8_file(
+		int fd, const char *filename, unicode_loader_t loader, utf32_t **out_str,
+		size_t *out_size)
+{
+	int rc;
+	const char *in_data;
+	size_t in_size = 0;
+
+	rc = unicode_load_file(fd, filename, loader, &in_data, &in_size);
+	if (__builtin_expect(rc != 0, 0))
+		return rc;
+
+	rc = unicode_read_utf8_string(in_data, in_size, out_str, out_size);
+	unicode_unload_file(in_data, in_size, 0, loader);
+	return rc;
+}
+
+int unicode_read_utf8_file_adaptive(
+		int fd, const char *filename, unicode_loader_t loader, void **out_str,
+		size_t *out_size, unicode_encoding_t *out_encoding)
+{
+	int rc;
+	const char *in_data;
+	size_t in_size = 0;
+
+	rc = unicode_load_file(fd, filename, loader, &in_data, &in_size);
+	if (__builtin_expect(rc != 0, 0))
+		return rc;
+
+	rc = unicode_read_utf8_string_adaptive(in_data, in_size, out_str, out_size, out_encoding);
+	unicode_unload_file(in_data, in_size, 0, loader);
+	return rc;
+}
+
+const char *unicode_loader_name(unicode_loader_t loader)
+{
+	static const char *const name[UNICODE_LOADER_END] = {
+		[UNICODE_LOADER_MMAP] = "mmap",
+		[UNICODE_LOADER_MMAP_SEQUENTIAL] = "mmap-sequential",
+		[UNICODE_LOADER_MMAP_POPULATE] = "mmap-populate",
+		[UNICODE_LOADER_READ] = "read",
+		[UNICODE_LOADER_HUGE_PAGES] = "huge-pages",
+	};
+
+	return name[loader];
+}
+
+int unicode_load_file(
+		int fd, const char *filename, unicode_loader_t loader, const char **out_str,
+		size_t *out_size)
 {
-	int in_fd, rc;
+	int in_fd, rc = 0;
+	const size_t padding = *out_size;
+	void *in_data = 0;
 
 	in_fd = openat(fd, filename, O_RDONLY);
 	if (__builtin_expect(in_fd == -1, 0)) {
@@ -138,34 +381,391 @@ int unicode_read_utf8_file(int fd, const char *filename, utf32_t **out_str, size
 	}
 
 	size_t in_size = lseek(in_fd, 0, SEEK_END);
-	if (__builtin_expect(in_size == -1, 0)) {
+	if (__builtin_expect(in_size == (size_t) -1, 0)) {
 		rc = errno;
 		fprintf(stderr, "cannot check the file size of '%s'. error %d\n", filename, rc);
 		goto exit2;
 	}
 
-	void *in_data = mmap(0, in_size, PROT_READ, MAP_SHARED, in_fd, 0);
-	if (__builtin_expect(in_data == MAP_FAILED, 0)) {
+	switch (loader) {
+	case UNICODE_LOADER_READ:
+		rc = load_pooled(in_fd, filename, in_size, padding, &in_data);
+		break;
+	case UNICODE_LOADER_HUGE_PAGES:
+		rc = load_huge_pages(in_fd, filename, in_size, padding, &in_data);
+		break;
+	default:
+		rc = load_mapped(in_fd, filename, in_size, padding, loader, &in_data);
+		break;
+	}
+
+	if (__builtin_expect(rc != 0, 0))
+		goto exit2;
+
+	*out_str = in_data;
+	*out_size = in_size;
+exit2:
+	close(in_fd);
+exit1:
+	return rc;
+}
+
+/* every thread keeps the buffer of its last read() load for the next one */
+static __thread char *pool_data;
+static __thread size_t pool_size;
+static __thread int pool_in_use;
+
+/* transparent huge pages are used for whole 2 MiB pages only */
+#define HUGE_PAGE_SIZE (2ul << 20)
+#define HUGE_PAGE_ROUND(size) (((size) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1))
+
+void unicode_unload_file(const char *str, size_t size, size_t padding, unicode_loader_t loader)
+{
+	switch (loader) {
+	case UNICODE_LOADER_READ:
+		if (str == pool_data)
+			pool_in_use = 0;
+		else
+			free((void *) str);
+		break;
+	case UNICODE_LOADER_HUGE_PAGES:
+		munmap((void *) str, HUGE_PAGE_ROUND(size + padding));
+		break;
+	default:
+		munmap((void *) str, size + padding);
+		break;
+	}
+}
+
+/* Maps the file for the mmap loaders. The padding comes from anonymous
+ * memory.
+ */
+static int load_mapped(
+		int fd, const char *filename, size_t size, size_t padding, unicode_loader_t loader,
+		void **out_data)
+{
+	int flags = MAP_PRIVATE | MAP_FIXED;
+
+	/* Reserve anonymous zero pages for the file and its padding first, and
+	 * then map the file over the start of the reservation. The bytes past
+	 * the end of the file in its last page are zero-filled by the kernel,
+	 * and the pages after that remain anonymous.
+	 */
+	void *reserved = mmap(0, size + padding, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (__builtin_expect(reserved == MAP_FAILED, 0)) {
+		int rc = errno;
+		fprintf(stderr, "cannot reserve memory for '%s'. error %d\n", filename, rc);
+		return rc;
+	}
+
+	/* prefault the whole file rather than taking a page fault per page */
+	if (loader == UNICODE_LOADER_MMAP_POPULATE)
+		flags |= MAP_POPULATE;
+
+	if (size > 0) {
+		void *in_data = mmap(reserved, size, PROT_READ, flags, fd, 0);
+		if (__builtin_expect(in_data == MAP_FAILED, 0)) {
+			int rc = errno;
+			fprintf(stderr, "cannot memory map '%s' for reading. error %d\n", filename, rc);
+			munmap(reserved, size + padding);
+			return rc;
+		}
+
+		/* the input is scanned front to back, so read ahead aggressively.
+		 * this is only a hint and its failure is harmless.
+		 */
+		if (loader == UNICODE_LOADER_MMAP_SEQUENTIAL)
+			madvise(in_data, size, MADV_SEQUENTIAL);
+	}
+
+	*out_data = reserved;
+	return 0;
+}
+
+/* Reads the file into the pooled buffer of the thread, or into a buffer of
+ * its own while the pooled buffer is in use
+ */
+static int load_pooled(int fd, const char *filename, size_t size, size_t padding, void **out_data)
+{
+	int rc;
+	char *data;
+
+	if (!pool_in_use) {
+		if (size + padding > pool_size) {
+			free(pool_data);
+			pool_size = 0;
+
+			pool_data = malloc(size + padding);
+			if (__builtin_expect(pool_data == 0, 0)) {
+				fprintf(stderr, "not enough memory to allocate %ld bytes\n", size + padding);
+				return ENOMEM;
+			}
+
+			pool_size = size + padding;
+		}
+
+		data = pool_data;
+	}
+	else {
+		data = malloc(size + padding);
+		if (__builtin_expect(data == 0, 0)) {
+			fprintf(stderr, "not enough memory to allocate %ld bytes\n", size + padding);
+			return ENOMEM;
+		}
+	}
+
+	rc = read_all(fd, filename, data, size);
+	if (__builtin_expect(rc != 0, 0)) {
+		if (data != pool_data)
+			free(data);
+		return rc;
+	}
+
+	pool_in_use |= (data == pool_data);
+	memset(data + size, 0, padding);
+	*out_data = data;
+	return 0;
+}
+
+/* Reads the file into anonymous memory that is backed by transparent huge
+ * pages, which cuts the page faults and TLB misses of large inputs
+ */
+static int load_huge_pages(
+		int fd, const char *filename, size_t size, size_t padding, void **out_data)
+{
+	int rc;
+	const size_t mapped_size = HUGE_PAGE_ROUND(size + padding);
+
+	/* anonymous memory is zero-filled, which provides the padding */
+	char *data = mmap(0, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (__builtin_expect(data == MAP_FAILED, 0)) {
+		rc = errno;
+		fprintf(stderr, "cannot reserve memory for '%s'. error %d\n", filename, rc);
+		return rc;
+	}
+
+	/* this is only a hint, and the kernel may not support huge pages */
+	madvise(data, mapped_size, MADV_HUGEPAGE);
+
+	rc = read_all(fd, filename, data, size);
+	if (__builtin_expect(rc != 0, 0)) {
+		munmap(data, mapped_size);
+		return rc;
+	}
+
+	*out_data = data;
+	return 0;
+}
+
+/* Reads 'size' bytes from the start of the file into 'data'
+ */
+static int read_all(int fd, const char *filename, char *restrict data, size_t size)
+{
+	size_t offset = 0;
+	ssize_t bytes;
+
+	while (offset < size) {
+		bytes = pread(fd, data + offset, size - offset, offset);
+		if (__builtin_expect(bytes == -1, 0)) {
+			if (errno == EINTR)
+				continue;
+
+			fprintf(stderr, "cannot read '%s'. error %d\n", filename, errno);
+			return errno;
+		}
+		else if (__builtin_expect(bytes == 0, 0)) {
+			fprintf(stderr, "'%s' was truncated while reading it\n", filename);
+			return EIO;
+		}
+
+		offset += bytes;
+	}
+
+	return 0;
+}
+
+int unicode_utf8_stream_open(
+		struct unicode_utf8_stream_t *restrict stream, int fd, const char *filename,
+		size_t chunk_size)
+{
+	int rc = 0;
+	size_t ring_size = 1, ring_bytes, chunk_bytes;
+
+	memset(stream, 0, sizeof(*stream));
+
+	stream->fd = openat(fd, filename, O_RDONLY);
+	if (__builtin_expect(stream->fd == -1, 0)) {
 		rc = errno;
-		fprintf(stderr, "cannot memory map '%s' for reading. error %d\n", filename, rc);
+		fprintf(stderr, "cannot open '%s' for reading. error %d\n", filename, rc);
+		goto exit1;
+	}
+
+	/* A chunk decodes into at most one character per byte, including the
+	 * bytes carried over from the previous chunk. The ring holds two decoded
+	 * chunks so that the next chunk can be decoded before the previous one is
+	 * consumed, and it is followed by an overflow area so that a chunk is
+	 * always decoded into contiguous memory.
+	 */
+	while (ring_size < 2 * (chunk_size + UTF8_SEQUENCE_MAX))
+		ring_size *= 2;
+
+	ring_bytes = sizeof(utf32_t) * (ring_size + chunk_size + UTF8_SEQUENCE_MAX);
+	stream->ring = malloc(ring_bytes);
+	if (__builtin_expect(stream->ring == 0, 0)) {
+		rc = ENOMEM;
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", ring_bytes);
 		goto exit2;
 	}
 
-	rc = unicode_read_utf8_string(in_data, in_size, out_str, out_size);
-	munmap(in_data, in_size);
+	/* the chunk is followed by zero padding that stops the decoder at a
+	 * truncated sequence at the end of the file
+	 */
+	chunk_bytes = chunk_size + 2 * UTF8_SEQUENCE_MAX;
+	stream->chunk = malloc(chunk_bytes);
+	if (__builtin_expect(stream->chunk == 0, 0)) {
+		rc = ENOMEM;
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", chunk_bytes);
+		goto exit3;
+	}
+
+	stream->chunk_size = chunk_size;
+	stream->ring_size = ring_size;
+	return 0;
+
+exit3:
+	free(stream->ring);
 exit2:
-	close(in_fd);
+	close(stream->fd);
 exit1:
 	return rc;
 }
 
+int unicode_utf8_stream_read(
+		struct unicode_utf8_stream_t *restrict stream, utf32_t *restrict out, size_t size,
+		size_t *restrict out_size)
+{
+	int rc = 0;
+	size_t i = 0, n, pos, avail;
+	const size_t mask = stream->ring_size - 1;
+	const size_t chunk_capacity = stream->chunk_size + UTF8_SEQUENCE_MAX;
+
+	while (i < size) {
+		avail = stream->tail - stream->head;
+
+		/* decode another chunk when the ring cannot satisfy the request */
+		if (avail < size - i && !stream->eof && stream->ring_size - avail >= chunk_capacity) {
+			rc = stream_decode_chunk(stream);
+			if (__builtin_expect(rc != 0, 0))
+				break;
+
+			continue;
+		}
+
+		if (avail == 0)
+			break;
+
+		pos = stream->head & mask;
+		n = stream->ring_size - pos;
+		n = (avail < n)? avail : n;
+		n = (size - i < n)? size - i : n;
+
+		memcpy(out + i, stream->ring + pos, sizeof(utf32_t) * n);
+		stream->head += n;
+		i += n;
+	}
+
+	*out_size = i;
+	return rc;
+}
+
+void unicode_utf8_stream_close(struct unicode_utf8_stream_t *restrict stream)
+{
+	free(stream->chunk);
+	free(stream->ring);
+	close(stream->fd);
+}
+
+/* Reads the next chunk of the file and decodes it at the tail of the ring
+ * buffer, which must have room for a decoded chunk
+ */
+static int stream_decode_chunk(struct unicode_utf8_stream_t *restrict stream)
+{
+	const size_t full = stream->carry + stream->chunk_size;
+	size_t size = stream->carry, complete, n, pos;
+	ssize_t bytes;
+
+	/* short reads are retried so that only the end of the file produces a
+	 * partial chunk
+	 */
+	while (size < full) {
+		bytes = read(stream->fd, stream->chunk + size, full - size);
+		if (__builtin_expect(bytes == -1, 0)) {
+			if (errno == EINTR)
+				continue;
+
+			fprintf(stderr, "cannot read the input stream. error %d\n", errno);
+			return errno;
+		}
+		else if (bytes == 0) {
+			stream->eof = 1;
+			break;
+		}
+
+		size += bytes;
+	}
+
+	/* an incomplete sequence at the end of the file is decoded as invalid */
+	complete = (stream->eof)? size : utf8_complete_size(stream->chunk, size);
+	memset(stream->chunk + size, 0, UTF8_SEQUENCE_MAX);
+
+	/* decode into the overflow area past the end of the ring and move the
+	 * characters that landed there to the start of the ring
+	 */
+	pos = stream->tail & (stream->ring_size - 1);
+	n = kernels->read_utf8(stream->chunk, complete, stream->ring + pos);
+	if (pos + n > stream->ring_size) {
+		memcpy(stream->ring, stream->ring + stream->ring_size,
+				sizeof(utf32_t) * (pos + n - stream->ring_size));
+	}
+
+	stream->tail += n;
+	stream->carry = size - complete;
+	memmove(stream->chunk, stream->chunk + complete, stream->carry);
+	return 0;
+}
+
+/* Returns the length of the longest prefix of 'in' that does not end with
+ * an incomplete sequence. Only the last lead byte can start a sequence that
+ * extends past the end, because the decoder stops at the first byte that is
+ * not a continuation byte.
+ */
+static size_t utf8_complete_size(const char *restrict in, size_t size)
+{
+	const uint8_t *restrict p = (const uint8_t *) in;
+	size_t k;
+
+	for (k=1; k < UTF8_SEQUENCE_MAX && k <= size; ++k) {
+		uint8_t ch = p[size - k];
+
+		if ((ch & 0xc0) == 0x80)
+			continue;
+
+		/* the number of leading ones is the length of the sequence */
+		if (ch >= 0xc0 && ch < 0xfc && (size_t) __builtin_clz((uint32_t) ~ch << 24) > k)
+			return size - k;
+
+		break;
+	}
+
+	return size;
+}
+
 int unicode_read_utf8_string(
 		const char *in_str, size_t in_size,
 		utf32_t *restrict *restrict out_str, size_t *restrict out_size)
 {
 	int rc = 0;
 	size_t i;
-	const char *p, *q;
 
 	/* In the worst case, all the characters in the utf-8 string are
 	 * single-byte characters, and so we would need to allocate one
@@ -180,49 +780,67 @@ int unicode_read_utf8_string(
 		goto exit1;
 	}
 
-	for (p = in_str, q = p + in_size, i = 0; p < q; ++i) {
-		(*out_str)[i] = unicode_read_utf8_char(&p);
-	}
-
+	i = kernels->read_utf8(in_str, in_size, *out_str);
+	memset(*out_str + i, 0, buf_size - sizeof(utf32_t) * i);
 	*out_size = i;
 exit1:
 	return rc;
 }
 
-int32_t unicode_read_utf8_char(const char **restrict s)
+int unicode_read_utf8_string_adaptive(
+		const char *in_str, size_t in_size, void **restrict out_str,
+		size_t *restrict out_size, unicode_encoding_t *restrict out_encoding)
 {
-	const uint8_t *p = (const uint8_t *) *s;
-	utf32_t code = 0;
+	int invalid = 0;
+	size_t unit_size, buf_size, size;
 
-#ifdef __BMI2__
-	uint16_t ch1 = p[0];
-	uint16_t i, cnt = __builtin_ia32_lzcnt_u16(~ch1 << 8);
-#else
-	uint32_t ch1 = p[0];
-	uint32_t lshift_invert = ~ch1 << 24;
-	int i, cnt = (lshift_invert)? __builtin_clz(lshift_invert) : 0;
-#endif
+	/* The largest byte determines the largest code point: lead bytes below
+	 * 0xc4 encode at most U+00FF and lead bytes below 0xf0 encode at most
+	 * U+FFFF.
+	 */
+	uint8_t max_byte = kernels->utf8_max_byte(in_str, in_size);
 
-	if (cnt == 0) {
-		++*s;
-		code = ch1 & 127;
+	if (max_byte < 0xc4) {
+		*out_encoding = UNICODE_ENCODING_LATIN1;
 	}
-	else if (cnt < 6) {
-		for (i=1; i < cnt; ++i)
-			if ((p[i] & 192) == 128)
-				code = code << 6 | (p[i] & 63);
-			else
-				goto fail;
-
-		*s += cnt;
-		code = (ch1 & (255 >> cnt)) << (cnt - 1) * 6 | code;
+	else if (max_byte < 0xf0) {
+		*out_encoding = UNICODE_ENCODING_UCS2;
 	}
 	else {
-fail:
-		code = -1;
+		*out_encoding = UNICODE_ENCODING_UTF32;
+		return unicode_read_utf8_string(in_str, in_size, (utf32_t **) out_str, out_size);
 	}
 
-	return code;
+	/* every byte decodes into at most one code unit */
+	unit_size = unicode_unit_size(*out_encoding);
+	buf_size = unit_size * in_size + *out_size;
+
+	*out_str = malloc(buf_size);
+	if (__builtin_expect(*out_str == 0, 0)) {
+		fprintf(stderr, "not enough memory to allocate %ld bytes\n", buf_size);
+		return ENOMEM;
+	}
+
+	if (*out_encoding == UNICODE_ENCODING_LATIN1)
+		size = kernels->read_utf8_latin1(in_str, in_size, *out_str, &invalid);
+	else
+		size = kernels->read_utf8_ucs2(in_str, in_size, *out_str, &invalid);
+
+	/* invalid sequences can only be represented in utf-32 */
+	if (__builtin_expect(invalid, 0)) {
+		free(*out_str);
+		*out_encoding = UNICODE_ENCODING_UTF32;
+		return unicode_read_utf8_string(in_str, in_size, (utf32_t **) out_str, out_size);
+	}
+
+	memset((char *) *out_str + unit_size * size, 0, buf_size - unit_size * size);
+	*out_size = size;
+	return 0;
+}
+
+int32_t unicode_read_utf8_char(const char **restrict s)
+{
+	return read_utf8_char(s);
 }
 
 int unicode_read_ascii_string(
@@ -262,55 +880,34 @@ int unicode_find(
 		const utf32_t *restrict hay, const utf32_t *restrict needle,
 		size_t hay_size, size_t needle_size)
 {
-	size_t i, hay_minus_needle;
-
-	if (__builtin_expect(hay_size == 0 || needle_size == 0, 0))
-		return -1;
-
-	hay_minus_needle = hay_size - needle_size;
-
-	/* search for the first needle character in the hay with the expectation
-	 * that it will not match (which is the most common case). once we find
-	 * the first matching character, we check the remaining characters in the
-	 * needle with the expectation that it will match.
-	 */
-	for (i=0; i<=hay_minus_needle; ++i) {
-		if (hay[i] != *needle) {
-			continue;
-		}
+	return kernels->find(hay, needle, hay_size, needle_size);
+}
 
-		if (__builtin_expect(unicode_compare_likely_equal(hay + i, needle, needle_size) == 0, 1))
-			return i;
-	}
+int unicode_find_utf8(
+		const char *restrict hay, const char *restrict needle,
+		size_t hay_size, size_t needle_size)
+{
+	return kernels->find_utf8(hay, needle, hay_size, needle_size);
+}
 
-	return -1;
+int unicode_find_ucs2(
+		const uint16_t *restrict hay, const uint16_t *restrict needle,
+		size_t hay_size, size_t needle_size)
+{
+	return kernels->find_ucs2(hay, needle, hay_size, needle_size);
 }
 
 utf32_t unicode_compare_likely_equal(const utf32_t *s1, const utf32_t *s2, size_t size)
 {
-	size_t i;
-	utf32_t diff = 0;
-
-	for (i=0; i<size; ++i) {
-		diff = s1[i] - s2[i];
-		if (__builtin_expect(diff, 0))
-			break;
-	}
-
-	return diff;
+	return kernels->compare(s1, s2, size);
 }
 
-utf32_t unicode_compare_likely_different(const utf32_t *s1, const utf32_t *s2, size_t size)
+int unicode_compare_likely_equal_utf8(const char *s1, const char *s2, size_t size)
 {
-	size_t i;
-	utf32_t diff = 0;
-
-	for (i=0; i<size; ++i) {
-		diff = s1[i] - s2[i];
-		if (__builtin_expect(diff, 1))
-			break;
-	}
-
-	return diff;
+	return kernels->compare_utf8(s1, s2, size);
 }
 
+int unicode_compare_likely_equal_ucs2(const uint16_t *s1, const uint16_t *s2, size_t size)
+{
+	return kernels->compare_ucs2(s1, s2, size);
+}
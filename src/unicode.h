@@ -13,6 +13,54 @@
 
 typedef int32_t utf32_t;
 
+/* Encodings that a document can be processed in. UTF-8 documents are used
+ * as-is, while the other encodings store one code unit per character. Latin-1
+ * and UCS-2 can only hold code points up to U+00FF and U+FFFF respectively.
+ */
+enum {
+	UNICODE_ENCODING_UTF8,
+	UNICODE_ENCODING_LATIN1,
+	UNICODE_ENCODING_UCS2,
+	UNICODE_ENCODING_UTF32,
+	UNICODE_ENCODING_END
+};
+
+/* Must be less than UNICODE_ENCODING_END */
+typedef uint8_t unicode_encoding_t;
+
+/* Ways of loading a file into memory. Which one is fastest depends on the
+ * file size, the page cache and the storage of the host.
+ */
+enum {
+	/* memory map the file and fault its pages in on access */
+	UNICODE_LOADER_MMAP,
+
+	/* same as UNICODE_LOADER_MMAP with sequential read-ahead */
+	UNICODE_LOADER_MMAP_SEQUENTIAL,
+
+	/* memory map the file and fault all of its pages in up front */
+	UNICODE_LOADER_MMAP_POPULATE,
+
+	/* read the file into a buffer that is reused by the next load */
+	UNICODE_LOADER_READ,
+
+	/* read the file into memory backed by transparent huge pages */
+	UNICODE_LOADER_HUGE_PAGES,
+
+	UNICODE_LOADER_END
+};
+
+/* Must be less than UNICODE_LOADER_END */
+typedef uint8_t unicode_loader_t;
+
+/* Return the size in bytes of a single code unit of 'encoding'
+ */
+size_t unicode_unit_size(unicode_encoding_t encoding);
+
+/* Return the name of 'loader'
+ */
+const char *unicode_loader_name(unicode_loader_t loader);
+
 /* Release memory held by the utf32 strings
  */
 void unicode_utf32_string_free(utf32_t *restrict *restrict str, size_t count);
@@ -27,9 +75,21 @@ void unicode_utf8_string_free(char *restrict *restrict str, size_t count);
  */
 int unicode_write_utf8_file(int fd, const char *filename, const utf32_t *in_str, size_t in_size);
 
+/* Same as unicode_write_utf8_file but encodes 'in_size' code units of
+ * 'in_str' stored in any of the supported encodings
+ */
+int unicode_write_utf8_file_adaptive(
+		int fd, const char *filename, const void *in_str, size_t in_size,
+		unicode_encoding_t encoding);
+
+/* Write 'size' bytes of already encoded data to the specified file.
+ * 'filename' is relative with respect to the directory referenced by 'fd'.
+ */
+int unicode_write_file(int fd, const char *filename, const void *data, size_t size);
+
 /* Encodes the unicode string 'in_str' and writes the utf-8 string into
- * 'out_str'. The function estimates the memory allocation size based on
- * the worst case scenario and it also pads the allocation request size
+ * 'out_str'. The function allocates exactly the encoded size, as computed by
+ * unicode_utf8_length, and it also pads the allocation request size
  * with the initial value of 'out_size'. This allows the caller to guarantee
  * an additional padding at the end of the string.
  *
@@ -41,6 +101,29 @@ int unicode_write_utf8_string(
 		const utf32_t *restrict in_str, size_t in_size, char **restrict out_str,
 		size_t *restrict out_size);
 
+/* Same as unicode_write_utf8_string but encodes 'in_size' code units of
+ * 'in_str' stored in any of the supported encodings
+ */
+int unicode_write_utf8_string_adaptive(
+		const void *restrict in_str, size_t in_size, unicode_encoding_t encoding,
+		char **restrict out_str, size_t *restrict out_size);
+
+/* Encodes the unicode string 'in_str' into the caller-owned buffer '*buf' of
+ * '*buf_size' bytes. The buffer is reallocated, and '*buf_size' updated, when
+ * the encoded string does not fit, so the same buffer can be reused across
+ * calls. The caller is expected to free '*buf' when it is no longer needed.
+ *
+ * The number of bytes written is recorded in the output parameter 'out_size'.
+ */
+int unicode_write_utf8_buffer(
+		const utf32_t *restrict in_str, size_t in_size, char **restrict buf,
+		size_t *restrict buf_size, size_t *restrict out_size);
+
+/* Returns the number of bytes needed to encode the unicode string 'in_str'
+ * as utf-8
+ */
+size_t unicode_utf8_length(const utf32_t *restrict in_str, size_t in_size);
+
 /* Encodes the unicode character 'ch' as UTF-8 and write the bytes into
  * the string '*s'. The 's' pointer is incremented to the next character
  * position.
@@ -48,7 +131,8 @@ int unicode_write_utf8_string(
 int unicode_write_utf8_char(char **restrict s, utf32_t ch);
 
 /* Decode a utf-8 file into a utf-32 string. 'filename' is relative with
- * respect to the directory referenced by 'fd'. The function estimates the
+ * respect to the directory referenced by 'fd' and the file is loaded with
+ * 'loader'. The function estimates the
  * memory allocation size based on the worst case scenario and it also pads
  * the allocation request size with the initial value of 'out_size'. This
  * allows the caller to guarantee an additional padding at the end of the
@@ -57,13 +141,90 @@ int unicode_write_utf8_char(char **restrict s, utf32_t ch);
  * The caller is expected to call unicode_utf32_string_free to release the
  * memory allocated in this function.
  */
-int unicode_read_utf8_file(int fd, const char *filename, utf32_t **out_str, size_t *out_size);
+int unicode_read_utf8_file(
+		int fd, const char *filename, unicode_loader_t loader, utf32_t **out_str,
+		size_t *out_size);
+
+/* Same as unicode_read_utf8_file but decodes into the narrowest encoding that
+ * can hold every character of the file: Latin-1, UCS-2 or UTF-32. The chosen
+ * encoding is recorded in 'out_encoding' and 'out_size' is in code units of
+ * that encoding.
+ */
+int unicode_read_utf8_file_adaptive(
+		int fd, const char *filename, unicode_loader_t loader, void **out_str,
+		size_t *out_size, unicode_encoding_t *out_encoding);
+
+/* Load a file into memory with 'loader' without decoding it. 'filename' is
+ * relative with respect to the directory referenced by 'fd'. The data is
+ * followed by at least the initial value of 'out_size' zero bytes of padding,
+ * even when the file size is a multiple of the page size.
+ *
+ * The number of bytes in the file is recorded in the output parameter
+ * 'out_size'. The caller is expected to call unicode_unload_file with the
+ * same padding and loader to release the data.
+ */
+int unicode_load_file(
+		int fd, const char *filename, unicode_loader_t loader, const char **out_str,
+		size_t *out_size);
+
+/* Release data loaded by unicode_load_file
+ */
+void unicode_unload_file(const char *str, size_t size, size_t padding, unicode_loader_t loader);
+
+/* Decodes a utf-8 file a chunk at a time into a ring buffer of utf-32
+ * characters, so that files of any size can be processed with a bounded
+ * amount of memory. A sequence that is split across two chunks is carried
+ * over and decoded with the next chunk.
+ */
+struct unicode_utf8_stream_t {
+	int fd;
+	int eof;
+
+	/* the bytes of the current chunk, starting with the 'carry' bytes of the
+	 * incomplete sequence at the end of the previous chunk
+	 */
+	char *chunk;
+	size_t chunk_size;
+	size_t carry;
+
+	/* decoded characters. 'head' and 'tail' only ever grow and are reduced
+	 * modulo 'ring_size', which is a power of two.
+	 */
+	utf32_t *ring;
+	size_t ring_size;
+	size_t head;
+	size_t tail;
+};
+
+/* Open a utf-8 file for streaming. 'filename' is relative with respect to
+ * the directory referenced by 'fd'. The file is read 'chunk_size' bytes at a
+ * time, and 'chunk_size' must not be 0.
+ *
+ * The caller is expected to call unicode_utf8_stream_close to release the
+ * stream.
+ */
+int unicode_utf8_stream_open(
+		struct unicode_utf8_stream_t *restrict stream, int fd, const char *filename,
+		size_t chunk_size);
+
+/* Decodes up to 'size' characters from the stream into 'out', reading more
+ * of the file as needed. The number of characters decoded is recorded in the
+ * output parameter 'out_size', which is 0 only at the end of the file.
+ * Invalid sequences decode as in unicode_read_utf8_string.
+ */
+int unicode_utf8_stream_read(
+		struct unicode_utf8_stream_t *restrict stream, utf32_t *restrict out, size_t size,
+		size_t *restrict out_size);
+
+/* Release the memory and the file held by the stream
+ */
+void unicode_utf8_stream_close(struct unicode_utf8_stream_t *restrict stream);
 
 /* Decodes the utf-8 string 'in_str' and writes the utf-32 string into
  * 'out_str'. The function estimates the memory allocation size based on
  * the worst case scenario and it also pads the allocation request size
  * with the initial value of 'out_size'. This allows the caller to guarantee
- * an additional padding at the end of the string.
+ * an additional zero-filled padding at the end of the string.
  *
  * The number of characters written is recorded in the output
  * parameter 'out_size'. The caller is expected to call
@@ -73,6 +234,14 @@ int unicode_read_utf8_string(
 		const char *in_str, size_t in_size, utf32_t *restrict *restrict out_str,
 		size_t *restrict out_size);
 
+/* Same as unicode_read_utf8_string but decodes into the narrowest encoding
+ * that can hold every character of 'in_str'. The padding is in bytes, as in
+ * unicode_read_utf8_string.
+ */
+int unicode_read_utf8_string_adaptive(
+		const char *in_str, size_t in_size, void **restrict out_str,
+		size_t *restrict out_size, unicode_encoding_t *restrict out_encoding);
+
 /* Decodes the UTF-8 character stored in the string '*s' and returns it
  * as a unicode character. The 's' pointer is incremented to the next
  * character position.
@@ -104,21 +273,38 @@ int unicode_find(
 		const utf32_t *restrict hay, const utf32_t *restrict needle,
 		size_t hay_size, size_t needle_size);
 
+/* Same as unicode_find but operates on the bytes of utf-8 or Latin-1 strings.
+ * 'hay_size' and 'needle_size' are in bytes.
+ */
+int unicode_find_utf8(
+		const char *restrict hay, const char *restrict needle,
+		size_t hay_size, size_t needle_size);
+
+/* Same as unicode_find but operates on UCS-2 strings
+ */
+int unicode_find_ucs2(
+		const uint16_t *restrict hay, const uint16_t *restrict needle,
+		size_t hay_size, size_t needle_size);
+
 /* Compares 's1' and 's2' for upto 'size' characters'. The function returns the
  * difference of the first divergent character of 's2' from the same indexed
  * character of 's1'. If the strings are equal, the return value is 0.
  *
- * Use this function if you suspect the two strings are equal.
+ * Use this function if you suspect the two strings are equal. The strings
+ * are compared a vector at a time, which costs more than a scalar loop when
+ * they differ at the first character, so callers that probe for a string at
+ * many positions should compare that character first.
  */
 utf32_t unicode_compare_likely_equal(const utf32_t *s1, const utf32_t *s2, size_t size);
 
-/* Compares 's1' and 's2' for upto 'size' characters'. The function returns the
- * difference of the first divergent character of 's2' from the same indexed
- * character of 's1'. If the strings are equal, the return value is 0.
- *
- * Use this function if you suspect the two strings are different.
+/* Same as unicode_compare_likely_equal but compares the bytes of utf-8 or
+ * Latin-1 strings. 'size' is in bytes.
+ */
+int unicode_compare_likely_equal_utf8(const char *s1, const char *s2, size_t size);
+
+/* Same as unicode_compare_likely_equal but compares UCS-2 strings
  */
-utf32_t unicode_compare_likely_different(const utf32_t *s1, const utf32_t *s2, size_t size);
+int unicode_compare_likely_equal_ucs2(const uint16_t *s1, const uint16_t *s2, size_t size);
 
 #endif
 
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * unicode_avx2.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* AVX2 kernels. This file is compiled with the flags of its instruction set
+ * and must only be called after checking that the CPU supports it.
+ */
+
+#include <unicode_kernels.h>
+
+#define UNICODE_KERNELS unicode_kernels_avx2
+#include <unicode_kernels_impl.h>
@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * unicode_avx512.c
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* AVX-512 kernels. This file is compiled with the flags of its instruction set
+ * and must only be called after checking that the CPU supports it.
+ */
+
+#include <unicode_kernels.h>
+
+#define UNICODE_KERNELS unicode_kernels_avx512
+#include <unicode_kernels_impl.h>
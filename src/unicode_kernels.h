@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * unicode_kernels.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+#ifndef UNICODE_KERNELS_H
+#define UNICODE_KERNELS_H
+
+#include <unicode.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* The vectorized parts of the codec, compiled once per instruction set from
+ * unicode_kernels_impl.h. unicode.c selects the kernels of the widest
+ * instruction set that the CPU supports when the program starts, so that the
+ * same binary runs at full speed on every host.
+ */
+struct unicode_kernels_t {
+	size_t (*utf8_length)(const utf32_t *restrict in_str, size_t in_size);
+	size_t (*write_utf8)(
+			const utf32_t *restrict in_str, size_t in_size, char *restrict out, size_t out_size);
+	uint8_t (*utf8_max_byte)(const char *restrict in, size_t size);
+	size_t (*read_utf8)(const char *restrict in, size_t size, utf32_t *restrict out);
+	size_t (*read_utf8_latin1)(
+			const char *restrict in, size_t size, uint8_t *restrict out, int *restrict invalid);
+	size_t (*read_utf8_ucs2)(
+			const char *restrict in, size_t size, uint16_t *restrict out, int *restrict invalid);
+	int (*find)(
+			const utf32_t *restrict hay, const utf32_t *restrict needle,
+			size_t hay_size, size_t needle_size);
+	int (*find_utf8)(
+			const char *restrict hay, const char *restrict needle,
+			size_t hay_size, size_t needle_size);
+	int (*find_ucs2)(
+			const uint16_t *restrict hay, const uint16_t *restrict needle,
+			size_t hay_size, size_t needle_size);
+	utf32_t (*compare)(const utf32_t *s1, const utf32_t *s2, size_t size);
+	int (*compare_utf8)(const char *s1, const char *s2, size_t size);
+	int (*compare_ucs2)(const uint16_t *s1, const uint16_t *s2, size_t size);
+};
+
+/* Kernels built with the compiler's default flags */
+extern const struct unicode_kernels_t unicode_kernels_baseline;
+
+#if defined(__x86_64__) || defined(__i386__)
+extern const struct unicode_kernels_t unicode_kernels_sse42;
+extern const struct unicode_kernels_t unicode_kernels_avx2;
+extern const struct unicode_kernels_t unicode_kernels_avx512;
+
+/* shuffle masks that compact four code points, each widened to a 4-byte
+ * utf-8 candidate, into their encoded bytes. The index holds the encoded
+ * length minus one of every code point in consecutive 2-bit fields.
+ */
+extern const uint8_t unicode_utf8_compact_shuffle[256][16];
+#endif
+
+/* Same as unicode_write_utf8_char, inlined into the kernels so that it uses
+ * the instructions of their instruction set
+ */
+static inline int write_utf8_char(char **restrict s, utf32_t ch)
+{
+	uint8_t *p = (uint8_t*) *s;
+
+	if (__builtin_expect(ch < 0, 0)) {
+		return -1;
+	}
+	else if (ch < 128) {
+		p[0] = ch;
+		++*s;
+	}
+	else {
+#ifdef __BMI2__
+		uint32_t i, cnt = 6 - (__builtin_ia32_lzcnt_u32(ch) - 1) / 5;
+#else
+		int i, cnt = (ch != 0)? 6 - (__builtin_clz(ch) - 1) / 5 : 0;
+#endif
+		p[0] = 255 << (8 - cnt) | ch >> 6 * (cnt - 1);
+
+		for (i=1; i < cnt; ++i) {
+			p[i] = 128 | (ch >> 6 * (cnt - i - 1) & 63);
+		}
+
+		*s += cnt;
+	}
+
+	return 0;
+}
+
+/* Same as unicode_read_utf8_char, inlined into the kernels so that it uses
+ * the instructions of their instruction set
+ */
+static inline int32_t read_utf8_char(const char **restrict s)
+{
+	const uint8_t *p = (const uint8_t *) *s;
+	utf32_t code = 0;
+
+#ifdef __BMI2__
+	uint16_t ch1 = p[0];
+	uint16_t i, cnt = __builtin_ia32_lzcnt_u16(~ch1 << 8);
+#else
+	uint32_t ch1 = p[0];
+	uint32_t lshift_invert = ~ch1 << 24;
+	int i, cnt = (lshift_invert)? __builtin_clz(lshift_invert) : 0;
+#endif
+
+	if (cnt == 0) {
+		++*s;
+		code = ch1 & 127;
+	}
+	else if (cnt < 6) {
+		for (i=1; i < cnt; ++i)
+			if ((p[i] & 192) == 128)
+				code = code << 6 | (p[i] & 63);
+			else
+				goto fail;
+
+		*s += cnt;
+		code = (ch1 & (255 >> cnt)) << (cnt - 1) * 6 | code;
+	}
+	else {
+fail:
+		code = -1;
+	}
+
+	return code;
+}
+
+#endif
@@ -0,0 +1,954 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * unicode_kernels_impl.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* This file is included once per instruction set: by unicode.c for the
+ * baseline kernels and by unicode_<isa>.c, which are compiled with the flags
+ * of their instruction set. The vector paths below are selected from the
+ * instruction sets that the compiler targets. The includer defines the
+ * following macro, which is undefined at the end of this file:
+ *
+ *  - UNICODE_KERNELS: the name of the struct unicode_kernels_t to define
+ */
+
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE4_1__)
+/* Returns non-zero if a vector of 'size' bytes can be loaded from 'p' without
+ * crossing into the next page
+ */
+static inline int load_within_page(const void *p, size_t size)
+{
+	return ((uintptr_t) p & 4095) <= 4096 - size;
+}
+
+/* Returns the index of the first byte that differs between 's1' and 's2', or
+ * 'size' if the first 'size' bytes are equal. Short strings such as keywords
+ * are compared with a single vector compare: with AVX-512 the tail is loaded
+ * with a masked load, and otherwise a full vector is loaded when that cannot
+ * fault and the bytes past 'size' are masked out of the result.
+ */
+static inline size_t first_mismatch(const void *s1, const void *s2, size_t size)
+{
+	const uint8_t *p1 = s1;
+	const uint8_t *p2 = s2;
+	size_t i = 0;
+
+#if defined(__AVX512BW__)
+	for (; size - i >= 64; i += 64) {
+		uint64_t neq = _mm512_cmpneq_epi8_mask(
+				_mm512_loadu_si512(p1 + i), _mm512_loadu_si512(p2 + i));
+
+		if (neq)
+			return i + __builtin_ctzll(neq);
+	}
+
+	if (i < size) {
+		__mmask64 tail = (1ull << (size - i)) - 1;
+		uint64_t neq = _mm512_cmpneq_epi8_mask(
+				_mm512_maskz_loadu_epi8(tail, p1 + i), _mm512_maskz_loadu_epi8(tail, p2 + i));
+
+		return (neq)? i + __builtin_ctzll(neq) : size;
+	}
+
+	return size;
+#elif defined(__AVX2__)
+	for (; size - i >= 32; i += 32) {
+		uint32_t neq = ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_loadu_si256((const __m256i *) (p1 + i)),
+					_mm256_loadu_si256((const __m256i *) (p2 + i))));
+
+		if (neq)
+			return i + __builtin_ctz(neq);
+	}
+
+	if (i < size && load_within_page(p1 + i, 32) && load_within_page(p2 + i, 32)) {
+		uint32_t neq = ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_loadu_si256((const __m256i *) (p1 + i)),
+					_mm256_loadu_si256((const __m256i *) (p2 + i))));
+
+		neq &= (1u << (size - i)) - 1;
+		return (neq)? i + __builtin_ctz(neq) : size;
+	}
+#else
+	for (; size - i >= 16; i += 16) {
+		uint32_t neq = ~_mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *) (p1 + i)),
+					_mm_loadu_si128((const __m128i *) (p2 + i)))) & 0xffff;
+
+		if (neq)
+			return i + __builtin_ctz(neq);
+	}
+
+	if (i < size && load_within_page(p1 + i, 16) && load_within_page(p2 + i, 16)) {
+		uint32_t neq = ~_mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((const __m128i *) (p1 + i)),
+					_mm_loadu_si128((const __m128i *) (p2 + i))));
+
+		neq &= (1u << (size - i)) - 1;
+		return (neq)? i + __builtin_ctz(neq) : size;
+	}
+#endif
+
+	for (; i < size; ++i) {
+		if (p1[i] != p2[i])
+			break;
+	}
+
+	return i;
+}
+#endif
+
+/* Returns the difference between the first code units that differ in 's1'
+ * and 's2', or 0 if their first 'size' code units are equal
+ */
+static utf32_t compare_utf32(const utf32_t *s1, const utf32_t *s2, size_t size)
+{
+#if defined(__SSE4_1__)
+	size_t i = first_mismatch(s1, s2, sizeof(utf32_t) * size) / sizeof(utf32_t);
+
+	return (i < size)? s1[i] - s2[i] : 0;
+#else
+	size_t i;
+	utf32_t diff = 0;
+
+	for (i=0; i<size; ++i) {
+		diff = s1[i] - s2[i];
+		if (__builtin_expect(diff, 0))
+			break;
+	}
+
+	return diff;
+#endif
+}
+
+static int compare_utf8(const char *s1, const char *s2, size_t size)
+{
+#if defined(__SSE4_1__)
+	size_t i = first_mismatch(s1, s2, size);
+
+	return (i < size)? (uint8_t) s1[i] - (uint8_t) s2[i] : 0;
+#else
+	const uint8_t *p1 = (const uint8_t *) s1;
+	const uint8_t *p2 = (const uint8_t *) s2;
+	size_t i;
+	int diff = 0;
+
+	for (i=0; i<size; ++i) {
+		diff = p1[i] - p2[i];
+		if (__builtin_expect(diff, 0))
+			break;
+	}
+
+	return diff;
+#endif
+}
+
+static int compare_ucs2(const uint16_t *s1, const uint16_t *s2, size_t size)
+{
+#if defined(__SSE4_1__)
+	size_t i = first_mismatch(s1, s2, sizeof(uint16_t) * size) / sizeof(uint16_t);
+
+	return (i < size)? s1[i] - s2[i] : 0;
+#else
+	size_t i;
+	int diff = 0;
+
+	for (i=0; i<size; ++i) {
+		diff = s1[i] - s2[i];
+		if (__builtin_expect(diff, 0))
+			break;
+	}
+
+	return diff;
+#endif
+}
+
+/* Returns the index of the first occurrence of 'needle' in 'hay', or -1 if
+ * there is none
+ */
+static int find_utf32(
+		const utf32_t *restrict hay, const utf32_t *restrict needle,
+		size_t hay_size, size_t needle_size)
+{
+	size_t i = 0, hay_minus_needle;
+
+	if (__builtin_expect(hay_size < needle_size || needle_size == 0, 0))
+		return -1;
+
+	hay_minus_needle = hay_size - needle_size;
+
+#if defined(__AVX2__)
+	const __m256i first = _mm256_set1_epi32(needle[0]);
+	const __m256i last = _mm256_set1_epi32(needle[needle_size - 1]);
+
+	for (; hay_size - i >= needle_size - 1 + 8; i += 8) {
+		__m256i a = _mm256_loadu_si256((const __m256i *) (hay + i));
+		__m256i b = _mm256_loadu_si256((const __m256i *) (hay + i + needle_size - 1));
+		__m256i eq = _mm256_and_si256(_mm256_cmpeq_epi32(a, first), _mm256_cmpeq_epi32(b, last));
+		uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (__builtin_expect(compare_utf32(hay + j, needle, needle_size) == 0, 1))
+				return j;
+
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__SSE4_1__)
+	const __m128i first = _mm_set1_epi32(needle[0]);
+	const __m128i last = _mm_set1_epi32(needle[needle_size - 1]);
+
+	for (; hay_size - i >= needle_size - 1 + 4; i += 4) {
+		__m128i a = _mm_loadu_si128((const __m128i *) (hay + i));
+		__m128i b = _mm_loadu_si128((const __m128i *) (hay + i + needle_size - 1));
+		__m128i eq = _mm_and_si128(_mm_cmpeq_epi32(a, first), _mm_cmpeq_epi32(b, last));
+		uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (__builtin_expect(compare_utf32(hay + j, needle, needle_size) == 0, 1))
+				return j;
+
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	/* search for the first needle character in the hay with the expectation
+	 * that it will not match (which is the most common case). once we find
+	 * the first matching character, we check the remaining characters in the
+	 * needle with the expectation that it will match. the vector loop above
+	 * does the same for a whole vector of positions, comparing both the first
+	 * and the last needle characters before checking the rest.
+	 */
+	for (; i<=hay_minus_needle; ++i) {
+		if (hay[i] != *needle) {
+			continue;
+		}
+
+		if (__builtin_expect(compare_utf32(hay + i, needle, needle_size) == 0, 1))
+			return i;
+	}
+
+	return -1;
+}
+
+static int find_utf8(
+		const char *restrict hay, const char *restrict needle,
+		size_t hay_size, size_t needle_size)
+{
+	size_t i = 0, hay_minus_needle;
+
+	if (__builtin_expect(hay_size < needle_size || needle_size == 0, 0))
+		return -1;
+
+	hay_minus_needle = hay_size - needle_size;
+
+#if defined(__AVX2__)
+	const __m256i first = _mm256_set1_epi8(needle[0]);
+	const __m256i last = _mm256_set1_epi8(needle[needle_size - 1]);
+
+	for (; hay_size - i >= needle_size - 1 + 32; i += 32) {
+		__m256i a = _mm256_loadu_si256((const __m256i *) (hay + i));
+		__m256i b = _mm256_loadu_si256((const __m256i *) (hay + i + needle_size - 1));
+		__m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last));
+		uint32_t mask = _mm256_movemask_epi8(eq);
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (__builtin_expect(compare_utf8(hay + j, needle, needle_size) == 0, 1))
+				return j;
+
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__SSE4_1__)
+	const __m128i first = _mm_set1_epi8(needle[0]);
+	const __m128i last = _mm_set1_epi8(needle[needle_size - 1]);
+
+	for (; hay_size - i >= needle_size - 1 + 16; i += 16) {
+		__m128i a = _mm_loadu_si128((const __m128i *) (hay + i));
+		__m128i b = _mm_loadu_si128((const __m128i *) (hay + i + needle_size - 1));
+		__m128i eq = _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last));
+		uint32_t mask = _mm_movemask_epi8(eq);
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask);
+
+			if (__builtin_expect(compare_utf8(hay + j, needle, needle_size) == 0, 1))
+				return j;
+
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i<=hay_minus_needle; ++i) {
+		if (hay[i] != *needle) {
+			continue;
+		}
+
+		if (__builtin_expect(compare_utf8(hay + i, needle, needle_size) == 0, 1))
+			return i;
+	}
+
+	return -1;
+}
+
+static int find_ucs2(
+		const uint16_t *restrict hay, const uint16_t *restrict needle,
+		size_t hay_size, size_t needle_size)
+{
+	size_t i = 0, hay_minus_needle;
+
+	if (__builtin_expect(hay_size < needle_size || needle_size == 0, 0))
+		return -1;
+
+	hay_minus_needle = hay_size - needle_size;
+
+#if defined(__AVX2__)
+	const __m256i first = _mm256_set1_epi16(needle[0]);
+	const __m256i last = _mm256_set1_epi16(needle[needle_size - 1]);
+
+	for (; hay_size - i >= needle_size - 1 + 16; i += 16) {
+		__m256i a = _mm256_loadu_si256((const __m256i *) (hay + i));
+		__m256i b = _mm256_loadu_si256((const __m256i *) (hay + i + needle_size - 1));
+		__m256i eq = _mm256_and_si256(_mm256_cmpeq_epi16(a, first), _mm256_cmpeq_epi16(b, last));
+		uint32_t mask = _mm256_movemask_epi8(eq) & 0x55555555;
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask) / 2;
+
+			if (__builtin_expect(compare_ucs2(hay + j, needle, needle_size) == 0, 1))
+				return j;
+
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__SSE4_1__)
+	const __m128i first = _mm_set1_epi16(needle[0]);
+	const __m128i last = _mm_set1_epi16(needle[needle_size - 1]);
+
+	for (; hay_size - i >= needle_size - 1 + 8; i += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *) (hay + i));
+		__m128i b = _mm_loadu_si128((const __m128i *) (hay + i + needle_size - 1));
+		__m128i eq = _mm_and_si128(_mm_cmpeq_epi16(a, first), _mm_cmpeq_epi16(b, last));
+		uint32_t mask = _mm_movemask_epi8(eq) & 0x5555;
+
+		while (mask) {
+			size_t j = i + __builtin_ctz(mask) / 2;
+
+			if (__builtin_expect(compare_ucs2(hay + j, needle, needle_size) == 0, 1))
+				return j;
+
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i<=hay_minus_needle; ++i) {
+		if (hay[i] != *needle) {
+			continue;
+		}
+
+		if (__builtin_expect(compare_ucs2(hay + i, needle, needle_size) == 0, 1))
+			return i;
+	}
+
+	return -1;
+}
+
+/* Returns the largest byte of 'in'
+ */
+static uint8_t utf8_max_byte(const char *restrict in, size_t size)
+{
+	const uint8_t *restrict p = (const uint8_t *) in;
+	size_t i = 0;
+	uint8_t max = 0;
+
+#if defined(__AVX2__)
+	__m256i acc = _mm256_setzero_si256();
+	__m128i acc128;
+
+	for (; size - i >= 32; i += 32)
+		acc = _mm256_max_epu8(acc, _mm256_loadu_si256((const __m256i *) (p + i)));
+
+	acc128 = _mm_max_epu8(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	acc128 = _mm_max_epu8(acc128, _mm_srli_si128(acc128, 8));
+	acc128 = _mm_max_epu8(acc128, _mm_srli_si128(acc128, 4));
+	acc128 = _mm_max_epu8(acc128, _mm_srli_si128(acc128, 2));
+	acc128 = _mm_max_epu8(acc128, _mm_srli_si128(acc128, 1));
+	max = _mm_cvtsi128_si32(acc128);
+#elif defined(__SSE4_1__)
+	__m128i acc = _mm_setzero_si128();
+
+	for (; size - i >= 16; i += 16)
+		acc = _mm_max_epu8(acc, _mm_loadu_si128((const __m128i *) (p + i)));
+
+	acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 8));
+	acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 4));
+	acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 2));
+	acc = _mm_max_epu8(acc, _mm_srli_si128(acc, 1));
+	max = _mm_cvtsi128_si32(acc);
+#endif
+
+	for (; i < size; ++i)
+		max = (p[i] > max)? p[i] : max;
+
+	return max;
+}
+
+/* Returns non-zero if the 8 bytes at 'p', before 'q', are ASCII. The decoders
+ * only go back to the vector path at the start of such a run, since widening
+ * a vector costs far more than a scalar character when text is mostly
+ * multi-byte and the vector would keep only a few bytes of it.
+ */
+static inline int ascii_run_ahead(const char *p, const char *q)
+{
+	uint64_t bytes;
+
+	if (q - p < 8)
+		return 0;
+
+	__builtin_memcpy(&bytes, p, 8);
+	return !(bytes & 0x8080808080808080ull);
+}
+
+/* Widens the leading ASCII characters of 'in' into 'out'. Only whole vectors
+ * that fit within 'size' bytes are loaded. Every vector is widened and stored
+ * in full, but only its ASCII prefix is counted, so the output must have room
+ * for 'size' characters. Returns the number of characters decoded.
+ */
+static size_t read_utf8_ascii(const char *restrict in, size_t size, utf32_t *restrict out)
+{
+	size_t i = 0;
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+	while (size - i >= 64) {
+		__m512i v = _mm512_loadu_si512(in + i);
+		uint64_t mask = _mm512_movepi8_mask(v);
+
+		_mm512_storeu_si512(out + i,      _mm512_cvtepu8_epi32(_mm512_castsi512_si128(v)));
+		_mm512_storeu_si512(out + i + 16, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 1)));
+		_mm512_storeu_si512(out + i + 32, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 2)));
+		_mm512_storeu_si512(out + i + 48, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 3)));
+
+		size_t n = (mask)? __builtin_ctzll(mask) : 64;
+		i += n;
+		if (n < 64)
+			break;
+	}
+#elif defined(__AVX2__)
+	while (size - i >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *) (in + i));
+		uint32_t mask = _mm256_movemask_epi8(v);
+		__m128i lo = _mm256_castsi256_si128(v);
+		__m128i hi = _mm256_extracti128_si256(v, 1);
+
+		_mm256_storeu_si256((__m256i *) (out + i),      _mm256_cvtepu8_epi32(lo));
+		_mm256_storeu_si256((__m256i *) (out + i + 8),  _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+		_mm256_storeu_si256((__m256i *) (out + i + 16), _mm256_cvtepu8_epi32(hi));
+		_mm256_storeu_si256((__m256i *) (out + i + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+
+		size_t n = (mask)? __builtin_ctz(mask) : 32;
+		i += n;
+		if (n < 32)
+			break;
+	}
+#elif defined(__SSE4_1__)
+	while (size - i >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *) (in + i));
+		uint32_t mask = _mm_movemask_epi8(v);
+
+		_mm_storeu_si128((__m128i *) (out + i),      _mm_cvtepu8_epi32(v));
+		_mm_storeu_si128((__m128i *) (out + i + 4),  _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+		_mm_storeu_si128((__m128i *) (out + i + 8),  _mm_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+		_mm_storeu_si128((__m128i *) (out + i + 12), _mm_cvtepu8_epi32(_mm_srli_si128(v, 12)));
+
+		size_t n = (mask)? __builtin_ctz(mask) : 16;
+		i += n;
+		if (n < 16)
+			break;
+	}
+#else
+	(void) in;
+	(void) size;
+	(void) out;
+#endif
+
+	return i;
+}
+
+/* Same as read_utf8_ascii but copies the ASCII characters into a Latin-1
+ * string
+ */
+static size_t read_utf8_ascii_latin1(const char *restrict in, size_t size, uint8_t *restrict out)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	while (size - i >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *) (in + i));
+		uint32_t mask = _mm256_movemask_epi8(v);
+
+		_mm256_storeu_si256((__m256i *) (out + i), v);
+
+		size_t n = (mask)? __builtin_ctz(mask) : 32;
+		i += n;
+		if (n < 32)
+			break;
+	}
+#elif defined(__SSE4_1__)
+	while (size - i >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *) (in + i));
+		uint32_t mask = _mm_movemask_epi8(v);
+
+		_mm_storeu_si128((__m128i *) (out + i), v);
+
+		size_t n = (mask)? __builtin_ctz(mask) : 16;
+		i += n;
+		if (n < 16)
+			break;
+	}
+#else
+	(void) in;
+	(void) size;
+	(void) out;
+#endif
+
+	return i;
+}
+
+/* Same as read_utf8_ascii but widens the ASCII characters into a UCS-2
+ * string
+ */
+static size_t read_utf8_ascii_ucs2(const char *restrict in, size_t size, uint16_t *restrict out)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	while (size - i >= 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *) (in + i));
+		uint32_t mask = _mm256_movemask_epi8(v);
+
+		_mm256_storeu_si256((__m256i *) (out + i),      _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+		_mm256_storeu_si256((__m256i *) (out + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+
+		size_t n = (mask)? __builtin_ctz(mask) : 32;
+		i += n;
+		if (n < 32)
+			break;
+	}
+#elif defined(__SSE4_1__)
+	while (size - i >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *) (in + i));
+		uint32_t mask = _mm_movemask_epi8(v);
+
+		_mm_storeu_si128((__m128i *) (out + i),     _mm_cvtepu8_epi16(v));
+		_mm_storeu_si128((__m128i *) (out + i + 8), _mm_cvtepu8_epi16(_mm_srli_si128(v, 8)));
+
+		size_t n = (mask)? __builtin_ctz(mask) : 16;
+		i += n;
+		if (n < 16)
+			break;
+	}
+#else
+	(void) in;
+	(void) size;
+	(void) out;
+#endif
+
+	return i;
+}
+
+/* Decodes the utf-8 string 'in' into 'out', which must have room for 'size'
+ * characters, and returns the number of characters decoded. A byte that does
+ * not start a valid sequence decodes into -1.
+ */
+static size_t read_utf8(const char *restrict in, size_t size, utf32_t *restrict out)
+{
+	const char *p = in, *q = in + size;
+	size_t i = 0, n;
+
+	/* widen runs of ASCII characters a vector at a time and fall back to the
+	 * scalar decoder for multi-byte sequences and for the tail of the string
+	 */
+	while (p < q) {
+		n = read_utf8_ascii(p, q - p, out + i);
+		p += n;
+		i += n;
+
+		/* decode characters one at a time up to the next ASCII run */
+		while (p < q) {
+			out[i] = read_utf8_char(&p);
+
+			/* skip a byte that does not start a valid sequence */
+			if (__builtin_expect(out[i] < 0, 0))
+				++p;
+
+			++i;
+			if (ascii_run_ahead(p, q))
+				break;
+		}
+	}
+
+	return i;
+}
+
+/* Decodes a utf-8 string whose code points are at most U+00FF into 'out'.
+ * '*invalid' is set when an invalid sequence is found, in which case the
+ * decoding stops. Returns the number of characters decoded.
+ */
+static size_t read_utf8_latin1(
+		const char *restrict in, size_t size, uint8_t *restrict out, int *restrict invalid)
+{
+	const char *p = in, *q = in + size;
+	size_t i = 0, n;
+
+	while (p < q) {
+		n = read_utf8_ascii_latin1(p, q - p, out + i);
+		p += n;
+		i += n;
+
+		while (p < q) {
+			utf32_t ch = read_utf8_char(&p);
+
+			if (__builtin_expect((uint32_t) ch > 0xff, 0)) {
+				*invalid = 1;
+				return i;
+			}
+
+			out[i] = ch;
+			++i;
+			if (ascii_run_ahead(p, q))
+				break;
+		}
+	}
+
+	return i;
+}
+
+/* Decodes a utf-8 string whose code points are at most U+FFFF into 'out'.
+ * '*invalid' is set when an invalid sequence is found, in which case the
+ * decoding stops. Returns the number of characters decoded.
+ */
+static size_t read_utf8_ucs2(
+		const char *restrict in, size_t size, uint16_t *restrict out, int *restrict invalid)
+{
+	const char *p = in, *q = in + size;
+	size_t i = 0, n;
+
+	while (p < q) {
+		n = read_utf8_ascii_ucs2(p, q - p, out + i);
+		p += n;
+		i += n;
+
+		while (p < q) {
+			utf32_t ch = read_utf8_char(&p);
+
+			if (__builtin_expect((uint32_t) ch > 0xffff, 0)) {
+				*invalid = 1;
+				return i;
+			}
+
+			out[i] = ch;
+			++i;
+			if (ascii_run_ahead(p, q))
+				break;
+		}
+	}
+
+	return i;
+}
+
+/* Returns the number of bytes unicode_write_utf8_char writes for each of the
+ * 'in_size' characters of 'in_str'
+ */
+static size_t utf8_length_scalar(const utf32_t *restrict in_str, size_t in_size)
+{
+	size_t i, size = 0;
+
+	for (i=0; i < in_size; ++i) {
+		utf32_t ch = in_str[i];
+
+		if (__builtin_expect(ch < 0, 0))
+			continue;
+		else if (ch < 128)
+			size += 1;
+		else
+			size += 6 - (__builtin_clz(ch) - 1) / 5;
+	}
+
+	return size;
+}
+
+/* Returns the number of bytes needed to encode 'in_str' as utf-8
+ */
+static size_t utf8_length(const utf32_t *restrict in_str, size_t in_size)
+{
+	size_t i = 0, size = 0;
+
+#if defined(__AVX512F__)
+	const __m512i out_of_range = _mm512_set1_epi32(~0x1fffff);
+
+	for (; in_size - i >= 16; i += 16) {
+		__m512i v = _mm512_loadu_si512(in_str + i);
+
+		if (__builtin_expect(_mm512_test_epi32_mask(v, out_of_range) != 0, 0)) {
+			size += utf8_length_scalar(in_str + i, 16);
+			continue;
+		}
+
+		size += 16
+			+ __builtin_popcount(_mm512_cmpgt_epi32_mask(v, _mm512_set1_epi32(0x7f)))
+			+ __builtin_popcount(_mm512_cmpgt_epi32_mask(v, _mm512_set1_epi32(0x7ff)))
+			+ __builtin_popcount(_mm512_cmpgt_epi32_mask(v, _mm512_set1_epi32(0xffff)));
+	}
+#elif defined(__AVX2__)
+	const __m256i out_of_range = _mm256_set1_epi32(~0x1fffff);
+
+	for (; in_size - i >= 8; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i *) (in_str + i));
+
+		if (__builtin_expect(!_mm256_testz_si256(v, out_of_range), 0)) {
+			size += utf8_length_scalar(in_str + i, 8);
+			continue;
+		}
+
+		size += 8
+			+ __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(
+							_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x7f)))))
+			+ __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(
+							_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x7ff)))))
+			+ __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(
+							_mm256_cmpgt_epi32(v, _mm256_set1_epi32(0xffff)))));
+	}
+#elif defined(__SSE4_1__)
+	const __m128i out_of_range = _mm_set1_epi32(~0x1fffff);
+
+	for (; in_size - i >= 4; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i *) (in_str + i));
+
+		if (__builtin_expect(!_mm_test_all_zeros(v, out_of_range), 0)) {
+			size += utf8_length_scalar(in_str + i, 4);
+			continue;
+		}
+
+		size += 4
+			+ __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(
+							_mm_cmpgt_epi32(v, _mm_set1_epi32(0x7f)))))
+			+ __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(
+							_mm_cmpgt_epi32(v, _mm_set1_epi32(0x7ff)))))
+			+ __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(
+							_mm_cmpgt_epi32(v, _mm_set1_epi32(0xffff)))));
+	}
+#endif
+
+	return size + utf8_length_scalar(in_str + i, in_size - i);
+}
+
+#if defined(__SSE4_1__)
+/* Encodes the four code points in 'v' into 'p' and returns the number of
+ * bytes written. All four code points must be within [0, 0x1fffff]. The
+ * full 16-byte vector is stored, so 'p' must have room for that many bytes.
+ */
+static inline size_t write_utf8_block4(__m128i v, uint8_t *restrict p)
+{
+	/* spreads a 4-bit lane mask into the 2-bit fields of the shuffle index */
+	static const uint8_t spread[16] = {
+		0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15,
+		0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55
+	};
+
+	const __m128i cont_mask = _mm_set1_epi32(63);
+	const __m128i cont_tag = _mm_set1_epi32(128);
+
+	__m128i ge2 = _mm_cmpgt_epi32(v, _mm_set1_epi32(0x7f));
+	__m128i ge3 = _mm_cmpgt_epi32(v, _mm_set1_epi32(0x7ff));
+	__m128i ge4 = _mm_cmpgt_epi32(v, _mm_set1_epi32(0xffff));
+
+	/* continuation bytes for the low 18 bits */
+	__m128i c0 = _mm_or_si128(_mm_and_si128(v, cont_mask), cont_tag);
+	__m128i c1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 6), cont_mask), cont_tag);
+	__m128i c2 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 12), cont_mask), cont_tag);
+
+	/* candidate encodings for every sequence length, leading byte first */
+	__m128i e2 = _mm_or_si128(
+			_mm_or_si128(_mm_srli_epi32(v, 6), _mm_set1_epi32(0xc0)),
+			_mm_slli_epi32(c0, 8));
+	__m128i e3 = _mm_or_si128(
+			_mm_or_si128(_mm_srli_epi32(v, 12), _mm_set1_epi32(0xe0)),
+			_mm_or_si128(_mm_slli_epi32(c1, 8), _mm_slli_epi32(c0, 16)));
+	__m128i e4 = _mm_or_si128(
+			_mm_or_si128(_mm_srli_epi32(v, 18), _mm_set1_epi32(0xf0)),
+			_mm_or_si128(
+				_mm_slli_epi32(c2, 8),
+				_mm_or_si128(_mm_slli_epi32(c1, 16), _mm_slli_epi32(c0, 24))));
+
+	__m128i e = _mm_blendv_epi8(v, e2, ge2);
+	e = _mm_blendv_epi8(e, e3, ge3);
+	e = _mm_blendv_epi8(e, e4, ge4);
+
+	int m2 = _mm_movemask_ps(_mm_castsi128_ps(ge2));
+	int m3 = _mm_movemask_ps(_mm_castsi128_ps(ge3));
+	int m4 = _mm_movemask_ps(_mm_castsi128_ps(ge4));
+	int idx = spread[m2] + spread[m3] + spread[m4];
+
+	__m128i shuffle = _mm_loadu_si128((const __m128i *) unicode_utf8_compact_shuffle[idx]);
+	_mm_storeu_si128((__m128i *) p, _mm_shuffle_epi8(e, shuffle));
+
+	return 4 + __builtin_popcount(m2 | m3 << 4 | m4 << 8);
+}
+
+/* Narrows 16 code points into 'p' and returns the length of their ASCII
+ * prefix. All 16 bytes are stored even when the prefix is shorter.
+ */
+static inline size_t write_utf8_ascii16(const utf32_t *restrict in, uint8_t *restrict p)
+{
+	uint32_t non_ascii;
+
+#if defined(__AVX512F__)
+	__m512i v = _mm512_loadu_si512(in);
+
+	non_ascii = _mm512_test_epi32_mask(v, _mm512_set1_epi32(~0x7f));
+	_mm_storeu_si128((__m128i *) p, _mm512_cvtepi32_epi8(v));
+#elif defined(__AVX2__)
+	const __m256i high_bits = _mm256_set1_epi32(~0x7f);
+	__m256i a = _mm256_loadu_si256((const __m256i *) in);
+	__m256i b = _mm256_loadu_si256((const __m256i *) (in + 8));
+	__m256i ab = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xd8);
+
+	__m256i a_ascii = _mm256_cmpeq_epi32(_mm256_and_si256(a, high_bits), _mm256_setzero_si256());
+	__m256i b_ascii = _mm256_cmpeq_epi32(_mm256_and_si256(b, high_bits), _mm256_setzero_si256());
+
+	non_ascii = ~(_mm256_movemask_ps(_mm256_castsi256_ps(a_ascii))
+			| _mm256_movemask_ps(_mm256_castsi256_ps(b_ascii)) << 8) & 0xffff;
+	_mm_storeu_si128((__m128i *) p,
+			_mm_packus_epi16(_mm256_castsi256_si128(ab), _mm256_extracti128_si256(ab, 1)));
+#else
+	const __m128i high_bits = _mm_set1_epi32(~0x7f);
+	__m128i a = _mm_loadu_si128((const __m128i *) in);
+	__m128i b = _mm_loadu_si128((const __m128i *) (in + 4));
+	__m128i c = _mm_loadu_si128((const __m128i *) (in + 8));
+	__m128i d = _mm_loadu_si128((const __m128i *) (in + 12));
+
+	__m128i ascii = _mm_packs_epi16(
+			_mm_packs_epi32(
+				_mm_cmpeq_epi32(_mm_and_si128(a, high_bits), _mm_setzero_si128()),
+				_mm_cmpeq_epi32(_mm_and_si128(b, high_bits), _mm_setzero_si128())),
+			_mm_packs_epi32(
+				_mm_cmpeq_epi32(_mm_and_si128(c, high_bits), _mm_setzero_si128()),
+				_mm_cmpeq_epi32(_mm_and_si128(d, high_bits), _mm_setzero_si128())));
+
+	non_ascii = ~_mm_movemask_epi8(ascii) & 0xffff;
+	_mm_storeu_si128((__m128i *) p,
+			_mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d)));
+#endif
+
+	return (non_ascii)? __builtin_ctz(non_ascii) : 16;
+}
+#endif
+
+/* Encodes the leading characters of 'in' into '*out' and advances '*out' past
+ * the bytes written. ASCII runs are narrowed 16 characters at a time and the
+ * remaining characters are encoded four at a time. Vectors are stored in
+ * full, so a vector is only stored while at least 16 bytes remain before
+ * 'out_end'; characters outside [0, 0x1fffff] encode to fewer bytes than
+ * there are characters, so the input size alone does not bound the output.
+ * Returns the number of characters encoded; it stops early at a character
+ * outside [0, 0x1fffff] so that the scalar encoder can handle it.
+ */
+static size_t write_utf8_vector(
+		const utf32_t *restrict in, size_t size, char *restrict *restrict out,
+		const char *out_end)
+{
+	size_t i = 0;
+
+#if defined(__SSE4_1__)
+	uint8_t *restrict p = (uint8_t *) *out;
+	const __m128i out_of_range = _mm_set1_epi32(~0x1fffff);
+
+	while (size - i >= 32 && out_end - (char *) p >= 16) {
+		size_t j, n = write_utf8_ascii16(in + i, p);
+
+		i += n;
+		p += n;
+		if (n == 16)
+			continue;
+
+		/* encode the non-ASCII span before looking for the next ASCII run */
+		for (j=0; j < 4 && size - i >= 16 && out_end - (char *) p >= 16; ++j) {
+			__m128i v = _mm_loadu_si128((const __m128i *) (in + i));
+
+			if (!_mm_test_all_zeros(v, out_of_range))
+				goto exit1;
+
+			p += write_utf8_block4(v, p);
+			i += 4;
+		}
+	}
+
+exit1:
+	*out = (char *) p;
+#else
+	(void) in;
+	(void) size;
+	(void) out;
+	(void) out_end;
+#endif
+
+	return i;
+}
+
+/* Encodes 'in_size' characters of 'in_str' into the 'out_size' bytes at
+ * 'out', which must be large enough to hold the encoded string, and returns
+ * the number of bytes written
+ */
+static size_t write_utf8(
+		const utf32_t *restrict in_str, size_t in_size, char *restrict out, size_t out_size)
+{
+	size_t i;
+	char *p = out;
+
+	/* encode blocks of characters a vector at a time and fall back to the
+	 * scalar encoder for characters the vector path rejects and for the
+	 * tail of the string
+	 */
+	for (i=0; i < in_size; ) {
+		i += write_utf8_vector(in_str + i, in_size - i, &p, out + out_size);
+
+		if (i < in_size) {
+			write_utf8_char(&p, in_str[i]);
+			++i;
+		}
+	}
+
+	return p - out;
+}
+
+const struct unicode_kernels_t UNICODE_KERNELS = {
+	.utf8_length = utf8_length,
+	.write_utf8 = write_utf8,
+	.utf8_max_byte = utf8_max_byte,
+	.read_utf8 = read_utf8,
+	.read_utf8_latin1 = read_utf8_latin1,
+	.read_utf8_ucs2 = read_utf8_ucs2,
+	.find = find_utf32,
+	.find_utf8 = find_utf8,
+	.find_ucs2 = find_ucs2,
+	.compare = compare_utf32,
+	.compare_utf8 = compare_utf8,
+	.compare_ucs2 = compare_ucs2,
+};
+
+#undef UNICODE_KERNELS
@@ -19,16 +19,34 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 
+#include <time.h>
+
 static int open_cwd(int *restrict fd);
 static int prepare_output(int cwd_fd, const char *output, int *restrict out_fd);
-static int compile_data(const int *restrict input, size_t size, int out_fd);
-static int write_data(int out_fd, unsigned char idx, const int *data, size_t size);
+static int parse_encoding(
+		const char *name, unicode_encoding_t *restrict encoding, int *restrict adaptive);
+static int parse_loader(const char *name, unicode_loader_t *restrict loader);
+static int benchmark_loaders(int cwd_fd, const char *input);
+static int compile_data(
+		const void *restrict input, size_t size, unicode_encoding_t encoding,
+		struct html_tree_t *restrict tree, int out_fd);
+static int write_data(
+		int out_fd, unsigned char idx, const void *data, size_t size,
+		unicode_encoding_t encoding);
 
 int main(int argc, char **argv)
 {
 	int c;
 	char *input = 0;
 	char *output = 0;
+	unicode_encoding_t encoding = UNICODE_ENCODING_UTF8;
+	unicode_loader_t loader = UNICODE_LOADER_MMAP;
+	int adaptive = 0;
+	int benchmark = 0;
+	unsigned int lex_threads = 1;
+
+	/* the tree keeps its storage for every document that is compiled */
+	struct html_tree_t tree = {0};
 
 	/* get command line options */
 	if (__builtin_expect(argc < 2, 0)) {
@@ -36,14 +54,28 @@ int main(int argc, char **argv)
 		return -1;
 	}
 
-	while ((c = getopt(argc, argv, "o:")) != -1) {
+	while ((c = getopt(argc, argv, "o:e:l:j:b")) != -1) {
 		switch (c) {
 		case 'o':
 			output = optarg;
 			break;
+		case 'e':
+			if (__builtin_expect(parse_encoding(optarg, &encoding, &adaptive) != 0, 0))
+				return -1;
+			break;
+		case 'l':
+			if (__builtin_expect(parse_loader(optarg, &loader) != 0, 0))
+				return -1;
+			break;
+		case 'j':
+			lex_threads = strtoul(optarg, 0, 10);
+			break;
+		case 'b':
+			benchmark = 1;
+			break;
 		case '?':
-			if (optopt == 'o')
-				fputs("Option -o requires an argument.\n", stderr);
+			if (optopt == 'o' || optopt == 'e' || optopt == 'l' || optopt == 'j')
+				fprintf(stderr, "Option -%c requires an argument.\n", optopt);
 
 			else if (isprint(optopt))
 				fprintf(stderr, "Unknown option '-%c'.\n", optopt);
@@ -61,7 +93,7 @@ int main(int argc, char **argv)
 		return -1;
 	}
 
-	if (__builtin_expect(output == 0, 0)) {
+	if (__builtin_expect(output == 0 && !benchmark, 0)) {
 		fputs("output file not specified\n", stderr);
 		return -1;
 	}
@@ -69,16 +101,35 @@ int main(int argc, char **argv)
 	input = argv[optind];
 
 	int rc, out_fd, cwd_fd;
-	int *input_data;
-	size_t input_size = 0;
+	void *input_data;
+	size_t input_size = HTML_PARSER_PADDING;
 
 	/* open the current directory */
 	rc = open_cwd(&cwd_fd);
 	if (__builtin_expect(rc != 0, 0))
 		goto exit1;
 
-	/* read input file as utf-8 and store the data in 'input_data' as utf-32 */
-	rc = unicode_read_utf8_file(cwd_fd, input, &input_data, &input_size);
+	if (benchmark) {
+		rc = benchmark_loaders(cwd_fd, input);
+		goto exit2;
+	}
+
+	/* Load the input file and process it as utf-8, or decode it and store
+	 * the data in 'input_data' as utf-32 or in the narrowest encoding that
+	 * fits the file. All of them guarantee the zero padding that the parser
+	 * requires.
+	 */
+	if (encoding == UNICODE_ENCODING_UTF8) {
+		rc = unicode_load_file(cwd_fd, input, loader, (const char **) &input_data, &input_size);
+	}
+	else if (adaptive) {
+		rc = unicode_read_utf8_file_adaptive(
+				cwd_fd, input, loader, &input_data, &input_size, &encoding);
+	}
+	else {
+		rc = unicode_read_utf8_file(cwd_fd, input, loader, (utf32_t **) &input_data, &input_size);
+	}
+
 	if (__builtin_expect(rc != 0, 0))
 		goto exit2;
 
@@ -88,12 +139,19 @@ int main(int argc, char **argv)
 		goto exit3;
 
 	/* perform the actual compiling task */
-	rc = compile_data(input_data, input_size, out_fd);
+	tree.lex_threads = lex_threads;
+	rc = compile_data(input_data, input_size, encoding, &tree, out_fd);
+	html_tree_free(&tree);
 
 	/* clean up */
 	close(out_fd);
 exit3:
-	unicode_utf32_string_free(&input_data, 1);
+	if (encoding == UNICODE_ENCODING_UTF8) {
+		unicode_unload_file(input_data, input_size, HTML_PARSER_PADDING, loader);
+	}
+	else {
+		free(input_data);
+	}
 exit2:
 	close(cwd_fd);
 exit1:
@@ -137,25 +195,148 @@ exit1:
 	return rc;
 }
 
-static int compile_data(const int *restrict input, size_t size, int out_fd)
+static int parse_encoding(
+		const char *name, unicode_encoding_t *restrict encoding, int *restrict adaptive)
+{
+	/* 'auto' decodes into Latin-1, UCS-2 or UTF-32 depending on the input */
+	if (strcmp(name, "utf8") == 0) {
+		*encoding = UNICODE_ENCODING_UTF8;
+	}
+	else if (strcmp(name, "utf32") == 0) {
+		*encoding = UNICODE_ENCODING_UTF32;
+	}
+	else if (strcmp(name, "auto") == 0) {
+		*encoding = UNICODE_ENCODING_UTF32;
+		*adaptive = 1;
+	}
+	else {
+		fprintf(stderr, "Unknown encoding '%s'. Expected 'utf8', 'utf32' or 'auto'.\n", name);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int parse_loader(const char *name, unicode_loader_t *restrict loader)
+{
+	unicode_loader_t i;
+
+	for (i=0; i < UNICODE_LOADER_END; ++i) {
+		if (strcmp(name, unicode_loader_name(i)) == 0) {
+			*loader = i;
+			return 0;
+		}
+	}
+
+	fprintf(stderr, "Unknown loader '%s'. Expected one of:", name);
+	for (i=0; i < UNICODE_LOADER_END; ++i)
+		fprintf(stderr, " '%s'", unicode_loader_name(i));
+
+	fputs("\n", stderr);
+	return -1;
+}
+
+/* Times every loader on 'input' and reports the fastest one. A load is only
+ * complete once every byte has been read, so each run also scans the data.
+ * Cold runs evict the file from the page cache first, which reproduces
+ * the I/O bound case of a fresh build.
+ */
+static int benchmark_loaders(int cwd_fd, const char *input)
+{
+	enum { RUNS = 5 };
+	static const char *const mode_name[2] = { "warm", "cold" };
+
+	int rc = 0, in_fd, mode, run;
+	unicode_loader_t loader, fastest[2] = { 0 };
+	double best[2][UNICODE_LOADER_END];
+	volatile uint8_t sink = 0;
+
+	in_fd = openat(cwd_fd, input, O_RDONLY);
+	if (__builtin_expect(in_fd == -1, 0)) {
+		rc = errno;
+		fprintf(stderr, "cannot open '%s' for reading. error %d\n", input, rc);
+		return rc;
+	}
+
+	printf("%-16s %12s %12s\n", "loader", "warm (ms)", "cold (ms)");
+
+	for (loader=0; loader < UNICODE_LOADER_END; ++loader) {
+		for (mode=0; mode < 2; ++mode) {
+			best[mode][loader] = 1e30;
+
+			for (run=0; run < RUNS; ++run) {
+				struct timespec begin, end;
+				const char *data;
+				size_t i, size = HTML_PARSER_PADDING;
+				uint8_t sum = 0;
+
+				/* only clean pages are dropped, so this needs no privileges */
+				if (mode == 1)
+					posix_fadvise(in_fd, 0, 0, POSIX_FADV_DONTNEED);
+
+				clock_gettime(CLOCK_MONOTONIC, &begin);
+
+				rc = unicode_load_file(cwd_fd, input, loader, &data, &size);
+				if (__builtin_expect(rc != 0, 0))
+					goto exit1;
+
+				for (i=0; i < size; ++i)
+					sum += data[i];
+
+				unicode_unload_file(data, size, HTML_PARSER_PADDING, loader);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+
+				double ms = (end.tv_sec - begin.tv_sec) * 1e3
+					+ (end.tv_nsec - begin.tv_nsec) / 1e6;
+
+				best[mode][loader] = (ms < best[mode][loader])? ms : best[mode][loader];
+				sink += sum;
+			}
+
+			if (best[mode][loader] < best[mode][fastest[mode]])
+				fastest[mode] = loader;
+		}
+
+		printf("%-16s %12.3f %12.3f\n", unicode_loader_name(loader),
+				best[0][loader], best[1][loader]);
+	}
+
+	for (mode=0; mode < 2; ++mode)
+		printf("fastest %s loader: %s\n", mode_name[mode], unicode_loader_name(fastest[mode]));
+
+exit1:
+	close(in_fd);
+	return rc;
+}
+
+static int compile_data(
+		const void *restrict input, size_t size, unicode_encoding_t encoding,
+		struct html_tree_t *restrict tree, int out_fd)
 {
-	struct html_tree_t tree = { 0 };
-	html_parse(input, size, &tree);
+	html_parse(input, size, encoding, tree);
 
-	utf32_t *output;
+	void *output;
 	size_t output_size = 0;
-	html_build(&output, &output_size, &tree);
+	int rc = html_build(&output, &output_size, tree);
+	if (__builtin_expect(rc != 0, 0))
+		return rc;
 
 	/* FIXME: for debugging only */
-	write_data(out_fd, 0, output, output_size);
+	write_data(out_fd, 0, output, output_size, encoding);
+
+	free(output);
 
 	return 0;
 }
 
-static int write_data(int out_fd, unsigned char idx, const int *data, size_t size)
+static int write_data(
+		int out_fd, unsigned char idx, const void *data, size_t size,
+		unicode_encoding_t encoding)
 {
 	char filename[16];
 	snprintf(filename, sizeof(filename), "%d.html", (int) idx);
-	return unicode_write_utf8_file(out_fd, filename, data, size);
+
+	/* utf-8 output is a copy of the input spans and needs no encoding */
+	return unicode_write_utf8_file_adaptive(out_fd, filename, data, size, encoding);
 }
 
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# gen_html_chars.py
+#
+# Generates src/html_chars_table.h, the character classes of the lexer for
+# every code point. Run it from the root of the repository after changing the
+# classes or to update the Unicode version, which is that of Python's
+# unicodedata module.
+
+import sys
+import unicodedata
+
+# the flags of a character, which the lexer tests with char_type_check
+IDENTIFIER = 1 << 0
+NUMBER = 1 << 1
+NOT_TEXT = 1 << 2
+WHITESPACE = 1 << 3
+
+# HTML only defines ASCII whitespace. Other Unicode whitespace, like U+00A0,
+# is text.
+ASCII = {
+    '\t': WHITESPACE, '\n': WHITESPACE, '\r': WHITESPACE, ' ': WHITESPACE,
+
+    # HTML special characters
+    '<': NOT_TEXT, '>': NOT_TEXT, '&': NOT_TEXT, '\'': NOT_TEXT, '"': NOT_TEXT,
+
+    '{': NOT_TEXT, '}': NOT_TEXT, '_': IDENTIFIER,
+}
+for c in range(ord('A'), ord('Z') + 1):
+    ASCII[chr(c)] = IDENTIFIER
+for c in range(ord('a'), ord('z') + 1):
+    ASCII[chr(c)] = IDENTIFIER
+for c in range(ord('0'), ord('9') + 1):
+    ASCII[chr(c)] = NUMBER
+
+CODE_POINTS = 0x110000
+BLOCK_BITS = 8
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+
+def flags(cp):
+    ch = chr(cp)
+
+    if cp < 128:
+        return ASCII.get(ch, 0)
+
+    # str.isidentifier() tests XID_Start for the first character and
+    # XID_Continue for the others
+    if ch.isidentifier():
+        return IDENTIFIER
+    if ('a' + ch).isidentifier():
+        return NUMBER
+    return 0
+
+
+def build():
+    blocks = {}
+    index = []
+
+    for b in range(CODE_POINTS // BLOCK_SIZE):
+        block = tuple(flags(cp) for cp in range(b * BLOCK_SIZE, (b + 1) * BLOCK_SIZE))
+        index.append(blocks.setdefault(block, len(blocks)))
+
+    return index, list(blocks)
+
+
+def main():
+    index, blocks = build()
+
+    # the lookup maps code points past U+10FFFF to the last block
+    if len(blocks) > 256 or any(blocks[index[-1]]):
+        sys.exit('the tables do not fit the lookup in html_lexer.c')
+
+    with open('src/html_chars_table.h', 'w') as f:
+        f.write('''/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * html_chars_table.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_html_chars.py from Unicode %s. Do not edit. */
+
+/* The character classes of the lexer. Beyond ASCII, the characters with the
+ * XID_Start property start identifiers, and the other characters with the
+ * XID_Continue property continue them like digits do.
+ */
+enum {
+	CHAR_INFO_IDENTIFIER = %d,
+	CHAR_INFO_NUMBER     = %d,
+	CHAR_INFO_NOT_TEXT   = %d,
+	CHAR_INFO_WHITESPACE = %d
+};
+
+/* The flags of code point 'ch' are
+ * char_info_block[char_info_index[ch >> %d]][ch & %d]. Blocks of %d code
+ * points with the same flags are stored once.
+ */
+#define CHAR_INFO_BLOCK_BITS %d
+#define CHAR_INFO_INDEX_SIZE %d
+
+static const uint8_t char_info_index[CHAR_INFO_INDEX_SIZE] = {
+''' % (unicodedata.unidata_version, IDENTIFIER, NUMBER, NOT_TEXT, WHITESPACE,
+       BLOCK_BITS, BLOCK_SIZE - 1, BLOCK_SIZE, BLOCK_BITS, len(index)))
+        for i in range(0, len(index), 16):
+            f.write('\t' + ', '.join('%d' % b for b in index[i:i + 16]) + ',\n')
+        f.write('''};
+
+static const uint8_t char_info_block[%d][1 << CHAR_INFO_BLOCK_BITS] = {
+''' % len(blocks))
+        for b, block in enumerate(blocks):
+            f.write('\t[%d] = {\n' % b)
+            for i in range(0, BLOCK_SIZE, 32):
+                f.write('\t\t' + ','.join('%d' % x for x in block[i:i + 32]) + ',\n')
+            f.write('\t},\n')
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# gen_html_entities.py
+#
+# Generates src/html_entities_table.h, a perfect hash from the name of a named
+# character reference to the code points that it stands for. Run it from the
+# root of the repository to update the names, which are those of Python's
+# html.entities module.
+
+import sys
+from html.entities import html5
+
+# The references that may omit the semicolon are legacy forms, which the
+# lexer does not recognize
+ENTITIES = sorted((name[:-1], value) for name, value in html5.items() if name.endswith(';'))
+
+BUCKET_BITS = 10
+SLOT_BITS = 12
+
+MASK64 = (1 << 64) - 1
+
+
+# must match lookup_entity in html_lexer.c
+def mix(name):
+    h = 0xcbf29ce484222325
+    for c in name.encode('ascii'):
+        h = ((h ^ c) * 0x100000001b3) & MASK64
+    return h ^ (h >> 32)
+
+
+def slot(x, disp):
+    return ((x >> 16) + disp * ((x >> 40) | 1)) & ((1 << SLOT_BITS) - 1)
+
+
+def build():
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for idx, (name, _) in enumerate(ENTITIES):
+        x = mix(name)
+        buckets[x & ((1 << BUCKET_BITS) - 1)].append((idx + 1, x))
+
+    table = [0] * (1 << SLOT_BITS)
+    disp = [0] * (1 << BUCKET_BITS)
+
+    # place the largest buckets first, while most slots are still free
+    for b in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+        for d in range(256):
+            slots = [slot(x, d) for _, x in buckets[b]]
+            if len(set(slots)) == len(slots) and all(table[s] == 0 for s in slots):
+                break
+        else:
+            sys.exit('no displacement found for bucket %d' % b)
+
+        disp[b] = d
+        for (idx, _), s in zip(buckets[b], slots):
+            table[s] = idx
+
+    return disp, table
+
+
+def main():
+    assert len(ENTITIES) < 65535
+    assert all(len(value) in (1, 2) for _, value in ENTITIES)
+
+    disp, table = build()
+    max_size = max(len(name) for name, _ in ENTITIES)
+
+    # the names follow each other without terminators
+    offsets = []
+    pool = ''
+    for name, _ in ENTITIES:
+        offsets.append(len(pool))
+        pool += name
+
+    with open('src/html_entities_table.h', 'w') as f:
+        f.write('''/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * html_entities_table.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_html_entities.py. Do not edit. */
+
+/* Hash and displace tables of the %d named character references, without
+ * their '&' and ';'. The low %d bits of the hash select a displacement,
+ * which moves the names of that bucket to free slots. A slot holds the
+ * index of its entity plus one, or zero if it is free. An entity stands for
+ * one code point, or two if the second is not zero.
+ */
+#define HTML_ENTITY_COUNT %d
+#define HTML_ENTITY_MAX_SIZE %d
+#define HTML_ENTITY_BUCKET_BITS %d
+#define HTML_ENTITY_SLOT_BITS %d
+
+static const uint8_t html_entity_disp[1 << HTML_ENTITY_BUCKET_BITS] = {
+''' % (len(ENTITIES), BUCKET_BITS, len(ENTITIES), max_size, BUCKET_BITS, SLOT_BITS))
+        for i in range(0, len(disp), 16):
+            f.write('\t' + ', '.join('%d' % d for d in disp[i:i + 16]) + ',\n')
+        f.write('''};
+
+static const uint16_t html_entity_slot[1 << HTML_ENTITY_SLOT_BITS] = {
+''')
+        for i in range(0, len(table), 16):
+            f.write('\t' + ', '.join('%d' % idx for idx in table[i:i + 16]) + ',\n')
+        f.write('''};
+
+static const char html_entity_names[] =
+''')
+        for i in range(0, len(pool), 64):
+            f.write('\t"%s"\n' % pool[i:i + 64])
+        f.write(''';
+
+static const uint16_t html_entity_offset[HTML_ENTITY_COUNT] = {
+''')
+        for i in range(0, len(offsets), 16):
+            f.write('\t' + ', '.join('%d' % o for o in offsets[i:i + 16]) + ',\n')
+        f.write('''};
+
+static const uint8_t html_entity_size[HTML_ENTITY_COUNT] = {
+''')
+        for i in range(0, len(ENTITIES), 16):
+            f.write('\t' + ', '.join('%d' % len(name) for name, _ in ENTITIES[i:i + 16]) + ',\n')
+        f.write('''};
+
+static const uint32_t html_entity_code_points[HTML_ENTITY_COUNT][2] = {
+''')
+        for name, value in ENTITIES:
+            cps = [ord(c) for c in value] + [0]
+            f.write('\t{ 0x%x, 0x%x },  /* %s */\n' % (cps[0], cps[1], name))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# gen_html_names.py
+#
+# Generates src/html_names.h, the ids of the names that the lexer recognizes,
+# and src/html_names_table.h, a perfect hash from a name to its id. Run it
+# from the root of the repository after changing NAMES.
+
+import sys
+
+# template keywords come first, and their ids must stay in this order
+KEYWORDS = ['html', 'data', 'include']
+
+ELEMENTS = [
+    'a', 'abbr', 'address', 'area', 'article', 'aside', 'audio', 'b', 'base',
+    'blockquote', 'body', 'br', 'button', 'canvas', 'caption', 'cite', 'code',
+    'col', 'colgroup', 'dd', 'del', 'details', 'dfn', 'dialog', 'div', 'dl',
+    'dt', 'em', 'embed', 'fieldset', 'figcaption', 'figure', 'footer', 'form',
+    'h1', 'h2', 'h3', 'h4', 'h5', 'h6', 'head', 'header', 'hr', 'i', 'iframe',
+    'img', 'input', 'ins', 'kbd', 'label', 'legend', 'li', 'link', 'main',
+    'map', 'mark', 'meta', 'meter', 'nav', 'noscript', 'object', 'ol',
+    'optgroup', 'option', 'output', 'p', 'param', 'picture', 'pre', 'progress',
+    'q', 's', 'samp', 'script', 'section', 'select', 'slot', 'small', 'source',
+    'span', 'strong', 'style', 'sub', 'summary', 'sup', 'table', 'tbody', 'td',
+    'template', 'textarea', 'tfoot', 'th', 'thead', 'time', 'title', 'tr',
+    'track', 'u', 'ul', 'var', 'video', 'wbr',
+]
+
+NAMES = KEYWORDS + ELEMENTS
+
+# names are packed into two little-endian 64-bit keys, so they are limited to
+# 16 characters
+MAX_SIZE = 16
+BUCKET_BITS = 6
+SLOT_BITS = 8
+
+MASK64 = (1 << 64) - 1
+
+
+def keys(name):
+    data = name.encode('ascii').ljust(MAX_SIZE, b'\0')
+    return int.from_bytes(data[:8], 'little'), int.from_bytes(data[8:], 'little')
+
+
+# must match html_name_hash in html_lexer.c
+def mix(key1, key2):
+    x = ((key1 ^ (key2 * 0x9e3779b97f4a7c15)) * 0xff51afd7ed558ccd) & MASK64
+    return x ^ (x >> 32)
+
+
+def slot(x, disp):
+    return ((x >> 8) + disp * ((x >> 24) | 1)) & ((1 << SLOT_BITS) - 1)
+
+
+def build():
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for idx, name in enumerate(NAMES):
+        x = mix(*keys(name))
+        buckets[x & ((1 << BUCKET_BITS) - 1)].append((idx + 1, x))
+
+    table = [0] * (1 << SLOT_BITS)
+    disp = [0] * (1 << BUCKET_BITS)
+
+    # place the largest buckets first, while most slots are still free
+    for b in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+        for d in range(256):
+            slots = [slot(x, d) for _, x in buckets[b]]
+            if len(set(slots)) == len(slots) and all(table[s] == 0 for s in slots):
+                break
+        else:
+            sys.exit('no displacement found for bucket %d' % b)
+
+        disp[b] = d
+        for (idx, _), s in zip(buckets[b], slots):
+            table[s] = idx
+
+    return disp, table
+
+
+def ident(name):
+    return 'HTML_NAME_' + name.upper()
+
+
+def main():
+    assert len(NAMES) == len(set(NAMES)) and len(NAMES) < 255
+    assert all(len(name) <= MAX_SIZE for name in NAMES)
+
+    disp, table = build()
+    header = '''/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * %s
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_html_names.py. Do not edit. */
+'''
+
+    with open('src/html_names.h', 'w') as f:
+        f.write(header % 'html_names.h')
+        f.write('''
+#ifndef HTML_NAMES_H
+#define HTML_NAMES_H
+
+#include <stdint.h>
+
+/* Names of the keywords and the elements that the lexer recognizes. The
+ * keywords come first, up to and including HTML_NAME_KEYWORD_LAST.
+ */
+enum {
+	HTML_NAME_UNKNOWN,
+''')
+        for i, name in enumerate(NAMES):
+            f.write('\t%s,\n' % ident(name))
+            if i + 1 == len(KEYWORDS):
+                f.write('\tHTML_NAME_KEYWORD_LAST = %s,\n' % ident(name))
+        f.write('''	HTML_NAME_END
+};
+
+/* Must be less than HTML_NAME_END */
+typedef uint8_t html_name_id_t;
+
+#endif
+''')
+
+    with open('src/html_names_table.h', 'w') as f:
+        f.write(header % 'html_names_table.h')
+        f.write('''
+/* Hash and displace tables of the names in html_names.h. The low %d bits of
+ * the hash select a displacement, which moves the names of that bucket to
+ * free slots. The keys of a name hold its characters in little-endian order,
+ * padded with zeros.
+ */
+#define HTML_NAME_MAX_SIZE %d
+#define HTML_NAME_BUCKET_BITS %d
+#define HTML_NAME_SLOT_BITS %d
+
+static const uint8_t html_name_disp[1 << HTML_NAME_BUCKET_BITS] = {
+''' % (BUCKET_BITS, MAX_SIZE, BUCKET_BITS, SLOT_BITS))
+        for i in range(0, len(disp), 16):
+            f.write('\t' + ', '.join('%d' % d for d in disp[i:i + 16]) + ',\n')
+        f.write('''};
+
+static const html_name_id_t html_name_slot[1 << HTML_NAME_SLOT_BITS] = {
+''')
+        for s, idx in enumerate(table):
+            if idx:
+                f.write('\t[%d] = %s,\n' % (s, ident(NAMES[idx - 1])))
+        f.write('''};
+
+static const uint64_t html_name_key[HTML_NAME_END][2] = {
+''')
+        for name in NAMES:
+            k1, k2 = keys(name)
+            f.write('\t[%s] = { 0x%016x, 0x%016x },\n' % (ident(name), k1, k2))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
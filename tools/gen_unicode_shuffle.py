@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# gen_unicode_shuffle.py
+#
+# Generates src/unicode_shuffle_table.h, the shuffle masks with which the
+# vectorized utf-8 writer compacts four encoded code points. Run it from the
+# root of the repository.
+
+
+def masks():
+    for idx in range(256):
+        mask = []
+
+        # each 2-bit field of the index is the encoded length minus one of a
+        # code point, whose candidate bytes occupy one 4-byte lane
+        for lane in range(4):
+            mask += [4 * lane + k for k in range((idx >> 2 * lane & 3) + 1)]
+
+        # unused bytes are zeroed by the shuffle
+        yield mask + [0x80] * (16 - len(mask))
+
+
+def main():
+    with open('src/unicode_shuffle_table.h', 'w') as f:
+        f.write('''/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * unicode_shuffle_table.h
+ *
+ * Copyright (C) 2021  Imran Haider
+ */
+
+/* Generated by tools/gen_unicode_shuffle.py. Do not edit. */
+
+/* Included by unicode.c only, which defines the table that
+ * unicode_kernels.h declares
+ */
+const uint8_t unicode_utf8_compact_shuffle[256][16] = {
+''')
+        for mask in masks():
+            f.write('\t{ ' + ', '.join('0x%02x' % b for b in mask) + ' },\n')
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()